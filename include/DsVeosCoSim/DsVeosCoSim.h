@@ -98,6 +98,12 @@ typedef int64_t DsVeosCoSim_SimulationTime;
  */
 typedef uint32_t DsVeosCoSim_IoSignalId;
 
+/**
+ * \brief Represents a resolved IO signal. Valid until the connection is closed. Handles of incoming signals are rejected
+ *        for outgoing signals and vice versa.
+ */
+typedef uint32_t DsVeosCoSim_IoSignalHandle;
+
 /**
  * \brief Represents a bus controller id.
  */
@@ -642,6 +648,46 @@ typedef struct DsVeosCoSim_IoSignal {
     const char* name;
 } DsVeosCoSim_IoSignal;
 
+/**
+ * \brief Contains the value of an incoming signal, which is read together with other incoming signals.
+ */
+typedef struct DsVeosCoSim_IncomingSignalValue {
+    /**
+     * \brief The handle of the incoming signal.
+     */
+    DsVeosCoSim_IoSignalHandle incomingSignalHandle;
+
+    /**
+     * \brief The read length in element count.
+     */
+    uint32_t length;
+
+    /**
+     * \brief The buffer, which receives the read value.
+     */
+    void* value;
+} DsVeosCoSim_IncomingSignalValue;
+
+/**
+ * \brief Contains the value of an outgoing signal, which is written together with other outgoing signals.
+ */
+typedef struct DsVeosCoSim_OutgoingSignalValue {
+    /**
+     * \brief The handle of the outgoing signal.
+     */
+    DsVeosCoSim_IoSignalHandle outgoingSignalHandle;
+
+    /**
+     * \brief The length of the value to write in element count.
+     */
+    uint32_t length;
+
+    /**
+     * \brief The value to write.
+     */
+    const void* value;
+} DsVeosCoSim_OutgoingSignalValue;
+
 /**
  * \brief Contains information about a CAN controller.
  */
@@ -1228,6 +1274,86 @@ typedef void (*DsVeosCoSim_FrMessageContainerReceivedCallback)(DsVeosCoSim_Simul
                                                                const DsVeosCoSim_FrMessageContainer* messageContainer,
                                                                void* userData);
 
+/**
+ * \brief Contains an incoming signal that changed within a simulation step.
+ */
+typedef struct DsVeosCoSim_IncomingSignalChange {
+    /**
+     * \brief The IO signal that changed.
+     */
+    const DsVeosCoSim_IoSignal* incomingSignal;
+
+    /**
+     * \brief The length of the changed data in element count.
+     */
+    uint32_t length;
+
+    /**
+     * \brief The changed data.
+     */
+    const void* value;
+} DsVeosCoSim_IncomingSignalChange;
+
+/**
+ * \brief Represents an incoming signals changed callback function pointer, which is called once per simulation step.
+ * \param simulationTime    The current simulation time.
+ * \param changes           The incoming signals that changed in this step. Only valid during the call.
+ * \param count             The number of changed incoming signals.
+ * \param userData          The user data passed via DsVeosCoSim_Callbacks.
+ */
+typedef void (*DsVeosCoSim_IncomingSignalsChangedCallback)(DsVeosCoSim_SimulationTime simulationTime,
+                                                           const DsVeosCoSim_IncomingSignalChange* changes,
+                                                           uint32_t count,
+                                                           void* userData);
+
+/**
+ * \brief Represents a CAN message containers received callback function pointer, which is called once per simulation step.
+ * \param simulationTime    The current simulation time.
+ * \param messageContainers The message containers received in this step. Only valid during the call.
+ * \param count             The number of received message containers.
+ * \param userData          The user data passed via DsVeosCoSim_Callbacks.
+ */
+typedef void (*DsVeosCoSim_CanMessageContainersReceivedCallback)(DsVeosCoSim_SimulationTime simulationTime,
+                                                                 const DsVeosCoSim_CanMessageContainer* messageContainers,
+                                                                 uint32_t count,
+                                                                 void* userData);
+
+/**
+ * \brief Represents an Ethernet message containers received callback function pointer, which is called once per simulation step.
+ * \param simulationTime    The current simulation time.
+ * \param messageContainers The message containers received in this step. Only valid during the call.
+ * \param count             The number of received message containers.
+ * \param userData          The user data passed via DsVeosCoSim_Callbacks.
+ */
+typedef void (*DsVeosCoSim_EthMessageContainersReceivedCallback)(DsVeosCoSim_SimulationTime simulationTime,
+                                                                 const DsVeosCoSim_EthMessageContainer* messageContainers,
+                                                                 uint32_t count,
+                                                                 void* userData);
+
+/**
+ * \brief Represents a LIN message containers received callback function pointer, which is called once per simulation step.
+ * \param simulationTime    The current simulation time.
+ * \param messageContainers The message containers received in this step. Only valid during the call.
+ * \param count             The number of received message containers.
+ * \param userData          The user data passed via DsVeosCoSim_Callbacks.
+ */
+typedef void (*DsVeosCoSim_LinMessageContainersReceivedCallback)(DsVeosCoSim_SimulationTime simulationTime,
+                                                                 const DsVeosCoSim_LinMessageContainer* messageContainers,
+                                                                 uint32_t count,
+                                                                 void* userData);
+
+/**
+ * \brief Represents a FlexRay message containers received callback function pointer, which is called once per simulation step.
+ * \param simulationTime    The current simulation time.
+ * \param messageContainers The message containers received in this step. Only valid during the call.
+ * \param count             The number of received message containers.
+ * \param userData          The user data passed via DsVeosCoSim_Callbacks.
+ */
+typedef void (*DsVeosCoSim_FrMessageContainersReceivedCallback)(DsVeosCoSim_SimulationTime simulationTime,
+                                                                const DsVeosCoSim_FrMessageContainer* messageContainers,
+                                                                uint32_t count,
+                                                                void* userData);
+
 /**
  * \brief Contains the callbacks that can be called during the co-simulation.
  */
@@ -1318,6 +1444,42 @@ typedef struct DsVeosCoSim_Callbacks {
     DsVeosCoSim_FrMessageReceivedCallback frMessageReceivedCallback;
 } DsVeosCoSim_Callbacks;
 
+/**
+ * \brief Contains the callbacks that are called once per simulation step with all items of that step. The user data
+ *        of DsVeosCoSim_Callbacks is passed to every callback.
+ */
+typedef struct DsVeosCoSim_BatchCallbacks {
+    /**
+     * \brief Called once per simulation step with all incoming signals that changed in this step. If set,
+     *        incomingSignalChangedCallback is not called.
+     */
+    DsVeosCoSim_IncomingSignalsChangedCallback incomingSignalsChangedCallback;
+
+    /**
+     * \brief Called once per simulation step with all CAN message containers received in this step. If set, the
+     *        other CAN message callbacks are not called.
+     */
+    DsVeosCoSim_CanMessageContainersReceivedCallback canMessageContainersReceivedCallback;
+
+    /**
+     * \brief Called once per simulation step with all Ethernet message containers received in this step. If set,
+     *        the other Ethernet message callbacks are not called.
+     */
+    DsVeosCoSim_EthMessageContainersReceivedCallback ethMessageContainersReceivedCallback;
+
+    /**
+     * \brief Called once per simulation step with all LIN message containers received in this step. If set, the
+     *        other LIN message callbacks are not called.
+     */
+    DsVeosCoSim_LinMessageContainersReceivedCallback linMessageContainersReceivedCallback;
+
+    /**
+     * \brief Called once per simulation step with all FlexRay message containers received in this step. If set,
+     *        the other FlexRay message callbacks are not called.
+     */
+    DsVeosCoSim_FrMessageContainersReceivedCallback frMessageContainersReceivedCallback;
+} DsVeosCoSim_BatchCallbacks;
+
 /**
  * \brief Contains the data that is required for establishing a connection to VEOS.
  */
@@ -1401,6 +1563,28 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_RunCallbackBasedCoSimulation(DsV
  */
 DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_StartPollingBasedCoSimulation(DsVeosCoSim_Handle handle, DsVeosCoSim_Callbacks callbacks);
 
+/**
+ * \brief Runs a callback based co-simulation for the given handle with additional batch callbacks.
+ *        This function will only return if DsVeosCoSim_Disconnect is called in one of the callbacks
+ *        or the dSPACE VEOS CoSim server is unloaded.
+ * \param handle            The handle.
+ * \param callbacks         The callbacks to register.
+ * \param batchCallbacks    The batch callbacks to register.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_RunCallbackBasedCoSimulation2(DsVeosCoSim_Handle handle,
+                                                                             DsVeosCoSim_Callbacks callbacks,
+                                                                             DsVeosCoSim_BatchCallbacks batchCallbacks);
+
+/**
+ * \brief Starts a polling based co-simulation for the given handle with additional batch callbacks.
+ * \param handle            The handle.
+ * \param callbacks         The callbacks to register.
+ * \param batchCallbacks    The batch callbacks to register.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_StartPollingBasedCoSimulation2(DsVeosCoSim_Handle handle,
+                                                                              DsVeosCoSim_Callbacks callbacks,
+                                                                              DsVeosCoSim_BatchCallbacks batchCallbacks);
+
 /**
  * \brief Polls a command for the co-simulation for the given handle.
  * \param handle            The handle.
@@ -1466,6 +1650,38 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignal(DsVeosCoSim_H
                                                                    uint32_t* length,
                                                                    void* value);
 
+/**
+ * \brief Resolves the incoming signal with the given id to a handle, which can be read without looking up the id.
+ * \param handle                The handle.
+ * \param incomingSignalId      The incoming signal id.
+ * \param incomingSignalHandle  The incoming signal handle.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ResolveIncomingSignal(DsVeosCoSim_Handle handle,
+                                                                      DsVeosCoSim_IoSignalId incomingSignalId,
+                                                                      DsVeosCoSim_IoSignalHandle* incomingSignalHandle);
+
+/**
+ * \brief Reads a value from the incoming signal identified by the given incoming signal handle.
+ * \param handle                The handle.
+ * \param incomingSignalHandle  The incoming signal handle.
+ * \param length                The read length.
+ * \param value                 The read value.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignalByHandle(DsVeosCoSim_Handle handle,
+                                                                           DsVeosCoSim_IoSignalHandle incomingSignalHandle,
+                                                                           uint32_t* length,
+                                                                           void* value);
+
+/**
+ * \brief Reads the values of several incoming signals at once. Stops at the first signal, which cannot be read.
+ * \param handle                      The handle.
+ * \param incomingSignalValuesCount   The incoming signal values count.
+ * \param incomingSignalValues        The incoming signal values. The lengths are set and the values are copied into the buffers.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignals(DsVeosCoSim_Handle handle,
+                                                                    uint32_t incomingSignalValuesCount,
+                                                                    DsVeosCoSim_IncomingSignalValue* incomingSignalValues);
+
 /**
  * \brief Gets all available outgoing signals.
  * \param handle                The handle.
@@ -1488,6 +1704,38 @@ DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignal(DsVeosCoSim_
                                                                     uint32_t length,
                                                                     const void* value);
 
+/**
+ * \brief Resolves the outgoing signal with the given id to a handle, which can be written without looking up the id.
+ * \param handle                The handle.
+ * \param outgoingSignalId      The outgoing signal id.
+ * \param outgoingSignalHandle  The outgoing signal handle.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_ResolveOutgoingSignal(DsVeosCoSim_Handle handle,
+                                                                      DsVeosCoSim_IoSignalId outgoingSignalId,
+                                                                      DsVeosCoSim_IoSignalHandle* outgoingSignalHandle);
+
+/**
+ * \brief Writes the given value to the outgoing signal identified by the given outgoing signal handle.
+ * \param handle                The handle.
+ * \param outgoingSignalHandle  The outgoing signal handle.
+ * \param length                The length of the value to write.
+ * \param value                 The value to write.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignalByHandle(DsVeosCoSim_Handle handle,
+                                                                            DsVeosCoSim_IoSignalHandle outgoingSignalHandle,
+                                                                            uint32_t length,
+                                                                            const void* value);
+
+/**
+ * \brief Writes the values of several outgoing signals at once. Stops at the first signal, which cannot be written.
+ * \param handle                      The handle.
+ * \param outgoingSignalValuesCount   The outgoing signal values count.
+ * \param outgoingSignalValues        The outgoing signal values.
+ */
+DSVEOSCOSIM_DECL DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignals(DsVeosCoSim_Handle handle,
+                                                                     uint32_t outgoingSignalValuesCount,
+                                                                     const DsVeosCoSim_OutgoingSignalValue* outgoingSignalValues);
+
 /**
  * \brief Gets all available CAN controllers.
  * \param handle                The handle.
@@ -119,20 +119,32 @@ void BusExchange::ClearData() const {
 }
 
 [[nodiscard]] Result BusExchange::Deserialize(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) const {
-    CheckResultWithMessage(
-        _canBusExchange->Deserialize(reader, simulationTime, callbacks.canMessageReceivedCallback, callbacks.canMessageContainerReceivedCallback),
-        "Could not receive CAN messages.");
-    CheckResultWithMessage(
-        _ethBusExchange->Deserialize(reader, simulationTime, callbacks.ethMessageReceivedCallback, callbacks.ethMessageContainerReceivedCallback),
-        "Could not receive Ethernet messages.");
-    CheckResultWithMessage(
-        _linBusExchange->Deserialize(reader, simulationTime, callbacks.linMessageReceivedCallback, callbacks.linMessageContainerReceivedCallback),
-        "Could not receive LIN messages.");
+    CheckResultWithMessage(_canBusExchange->Deserialize(reader,
+                                                        simulationTime,
+                                                        callbacks.canMessageReceivedCallback,
+                                                        callbacks.canMessageContainerReceivedCallback,
+                                                        callbacks.canMessageContainersReceivedCallback),
+                           "Could not receive CAN messages.");
+    CheckResultWithMessage(_ethBusExchange->Deserialize(reader,
+                                                        simulationTime,
+                                                        callbacks.ethMessageReceivedCallback,
+                                                        callbacks.ethMessageContainerReceivedCallback,
+                                                        callbacks.ethMessageContainersReceivedCallback),
+                           "Could not receive Ethernet messages.");
+    CheckResultWithMessage(_linBusExchange->Deserialize(reader,
+                                                        simulationTime,
+                                                        callbacks.linMessageReceivedCallback,
+                                                        callbacks.linMessageContainerReceivedCallback,
+                                                        callbacks.linMessageContainersReceivedCallback),
+                           "Could not receive LIN messages.");
 
     if (_doFlexRayOperations) {
-        CheckResultWithMessage(
-            _frBusExchange->Deserialize(reader, simulationTime, callbacks.frMessageReceivedCallback, callbacks.frMessageContainerReceivedCallback),
-            "Could not receive FlexRay messages.");
+        CheckResultWithMessage(_frBusExchange->Deserialize(reader,
+                                                           simulationTime,
+                                                           callbacks.frMessageReceivedCallback,
+                                                           callbacks.frMessageContainerReceivedCallback,
+                                                           callbacks.frMessageContainersReceivedCallback),
+                               "Could not receive FlexRay messages.");
     }
 
     return CreateOk();
@@ -58,6 +58,9 @@ using BusMessageCallback = std::function<void(SimulationTime, const typename TBu
 template <typename TBus>
 using BusMessageContainerCallback = std::function<void(SimulationTime, const typename TBus::Controller&, const typename TBus::MessageContainer&)>;
 
+template <typename TBus>
+using BusMessageContainersCallback = std::function<void(SimulationTime, const typename TBus::MessageContainer*, uint32_t)>;
+
 template <typename TBus>
 struct ControllerState {
     typename TBus::Controller controller{};
@@ -173,7 +176,8 @@ public:
     [[nodiscard]] virtual Result Deserialize(ChannelReader& reader,
                                              SimulationTime simulationTime,
                                              const BusMessageCallback<TBus>& messageCallback,
-                                             const BusMessageContainerCallback<TBus>& messageContainerCallback) = 0;
+                                             const BusMessageContainerCallback<TBus>& messageContainerCallback,
+                                             const BusMessageContainersCallback<TBus>& messageContainersCallback) = 0;
 };
 
 }  // namespace DsVeosCoSim::BusExchangeDetail
@@ -2,13 +2,12 @@
 
 #pragma once
 
-#ifdef _WIN32
-
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "BusExchangeCommon.hpp"
 #include "Environment.hpp"
@@ -170,15 +169,18 @@ public:
     [[nodiscard]] Result Deserialize(ChannelReader& reader,
                                      SimulationTime simulationTime,
                                      const BusMessageCallback<TBus>& messageCallback,
-                                     const BusMessageContainerCallback<TBus>& messageContainerCallback) override {
+                                     const BusMessageContainerCallback<TBus>& messageContainerCallback,
+                                     const BusMessageContainersCallback<TBus>& messageContainersCallback) override {
         size_t receivedNotificationCount{};
         CheckResultWithMessage(_protocol.ReadSize(reader, receivedNotificationCount), "Could not read receive count.");
         _pendingReceiveCount += receivedNotificationCount;
 
-        if (!messageCallback && !messageContainerCallback) {
+        if (!messageCallback && !messageContainerCallback && !messageContainersCallback) {
             return CreateOk();
         }
 
+        _receivedMessageContainers.clear();
+
         while (_pendingReceiveCount > 0) {
             TMessageContainer& messageContainer = _sharedMessageQueue->PopFront();
 
@@ -192,6 +194,12 @@ public:
             sharedQueuedMessageCount.fetch_sub(1);
             _pendingReceiveCount--;
 
+            // The queue entry can be reused by the sender as soon as the count was decremented
+            if (messageContainersCallback) {
+                _receivedMessageContainers.push_back(messageContainer);
+                continue;
+            }
+
             if (messageContainerCallback) {
                 messageContainerCallback(simulationTime, controllerState->controller, messageContainer);
                 continue;
@@ -204,6 +212,10 @@ public:
             }
         }
 
+        if (messageContainersCallback && !_receivedMessageContainers.empty()) {
+            messageContainersCallback(simulationTime, _receivedMessageContainers.data(), static_cast<uint32_t>(_receivedMessageContainers.size()));
+        }
+
         return CreateOk();
     }
 
@@ -228,9 +240,9 @@ private:
     size_t _pendingTransmitNotificationCount{};
     std::atomic<uint32_t>* _sharedMessageCountByController{};
     RingBufferView<TMessageContainer>* _sharedMessageQueue{};
+    // Collected while deserializing a step, if the batch callback is set
+    std::vector<TMessageContainer> _receivedMessageContainers;
     SharedMemory _sharedMemory;
 };
 
 }  // namespace DsVeosCoSim::BusExchangeDetail
-
-#endif
@@ -60,9 +60,10 @@ public:
     [[nodiscard]] Result Deserialize(ChannelReader& reader,
                                      SimulationTime simulationTime,
                                      const BusMessageCallback<TBus>& messageCallback,
-                                     const BusMessageContainerCallback<TBus>& messageContainerCallback) override {
+                                     const BusMessageContainerCallback<TBus>& messageContainerCallback,
+                                     const BusMessageContainersCallback<TBus>& messageContainersCallback) override {
         std::scoped_lock lock(_mutex);
-        return _proxiedPart->Deserialize(reader, simulationTime, messageCallback, messageContainerCallback);
+        return _proxiedPart->Deserialize(reader, simulationTime, messageCallback, messageContainerCallback, messageContainersCallback);
     }
 
 private:
@@ -11,6 +11,7 @@
 #include "Environment.hpp"
 #include "Protocol.hpp"
 #include "RingBuffer.hpp"
+#include "StepCodec.hpp"
 
 namespace DsVeosCoSim::BusExchangeDetail {
 
@@ -123,8 +124,35 @@ public:
     }
 
     [[nodiscard]] Result Serialize(ChannelWriter& writer) override {
+        StepContext context = _protocol.GetStepContext();
+        return WithStepCodec(context.encoding, context.writeReferenceTime, [&](auto& codec) {
+            return Serialize(writer, codec);
+        });
+    }
+
+    [[nodiscard]] Result Deserialize(ChannelReader& reader,
+                                     SimulationTime simulationTime,
+                                     const BusMessageCallback<TBus>& messageCallback,
+                                     const BusMessageContainerCallback<TBus>& messageContainerCallback,
+                                     const BusMessageContainersCallback<TBus>& messageContainersCallback) override {
+        StepContext context = _protocol.GetStepContext();
+        _receivedMessageContainers.clear();
+        CheckResult(WithStepCodec(context.encoding, context.readReferenceTime, [&](auto& codec) {
+            return Deserialize(reader, codec, simulationTime, messageCallback, messageContainerCallback, messageContainersCallback);
+        }));
+
+        if (messageContainersCallback && !_receivedMessageContainers.empty()) {
+            messageContainersCallback(simulationTime, _receivedMessageContainers.data(), static_cast<uint32_t>(_receivedMessageContainers.size()));
+        }
+
+        return CreateOk();
+    }
+
+private:
+    template <typename TCodec>
+    [[nodiscard]] Result Serialize(ChannelWriter& writer, TCodec& codec) {
         size_t queuedMessageCount = _queuedMessageContainers.Size();
-        CheckResultWithMessage(_protocol.WriteSize(writer, queuedMessageCount), "Could not write count of messages.");
+        CheckResultWithMessage(codec.WriteSize(writer, queuedMessageCount), "Could not write count of messages.");
 
         TMessageContainer messageContainer{};
         while (_queuedMessageContainers.TryPopFront(messageContainer)) {
@@ -132,7 +160,7 @@ public:
                 LogProtData(format_as(messageContainer));
             }
 
-            CheckResultWithMessage(_protocol.WriteMessage(writer, messageContainer), "Could not serialize message.");
+            CheckResultWithMessage(codec.WriteMessage(writer, messageContainer), "Could not serialize message.");
         }
 
         for (auto& [controllerId, controllerState] : _controllerRegistry.GetControllerStatesById()) {
@@ -142,16 +170,19 @@ public:
         return CreateOk();
     }
 
+    template <typename TCodec>
     [[nodiscard]] Result Deserialize(ChannelReader& reader,
+                                     TCodec& codec,
                                      SimulationTime simulationTime,
                                      const BusMessageCallback<TBus>& messageCallback,
-                                     const BusMessageContainerCallback<TBus>& messageContainerCallback) override {
+                                     const BusMessageContainerCallback<TBus>& messageContainerCallback,
+                                     const BusMessageContainersCallback<TBus>& messageContainersCallback) {
         size_t totalCount{};
-        CheckResultWithMessage(_protocol.ReadSize(reader, totalCount), "Could not read count of messages.");
+        CheckResultWithMessage(codec.ReadSize(reader, totalCount), "Could not read count of messages.");
 
         for (size_t i = 0; i < totalCount; i++) {
             TMessageContainer messageContainer{};
-            CheckResultWithMessage(_protocol.ReadMessage(reader, messageContainer), "Could not deserialize message.");
+            CheckResultWithMessage(codec.ReadMessage(reader, messageContainer), "Could not deserialize message.");
 
             if (IsProtocolTracingEnabled()) {
                 LogProtData(format_as(messageContainer));
@@ -160,6 +191,11 @@ public:
             ControllerStatePtr<TBus> controllerState{};
             CheckResult(_controllerRegistry.FindController(messageContainer.controllerId, controllerState));
 
+            if (messageContainersCallback) {
+                _receivedMessageContainers.push_back(std::move(messageContainer));
+                continue;
+            }
+
             if (messageContainerCallback) {
                 messageContainerCallback(simulationTime, controllerState->controller, messageContainer);
                 continue;
@@ -191,7 +227,6 @@ public:
         return CreateOk();
     }
 
-private:
     [[nodiscard]] Result CheckTransmitCapacity(ControllerState<TBus>& controllerState) {
         if (_queuedMessageCountByController[controllerState.controllerSlot] == controllerState.controller.queueSize) {
             if (!controllerState.transmitWarningSent) {
@@ -209,6 +244,8 @@ private:
     ControllerRegistry<TBus> _controllerRegistry;
     std::vector<uint32_t> _queuedMessageCountByController;
     RingBuffer<TMessageContainer> _queuedMessageContainers;
+    // Collected while deserializing a step, if the batch callback is set
+    std::vector<TMessageContainer> _receivedMessageContainers;
 };
 
 }  // namespace DsVeosCoSim::BusExchangeDetail
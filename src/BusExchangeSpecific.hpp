@@ -10,13 +10,10 @@
 #include <fmt/format.h>
 
 #include "BusExchangeCommon.hpp"
+#include "BusExchangeLocal.hpp"
 #include "BusExchangeLocked.hpp"
 #include "BusExchangeRemote.hpp"
 
-#ifdef _WIN32
-#include "BusExchangeLocalWin.hpp"
-#endif
-
 namespace DsVeosCoSim::BusExchangeDetail {
 
 // This layer selects the transport backend and keeps bus-specific length checks
@@ -41,15 +38,14 @@ public:
     BusExchangeSpecific& operator=(BusExchangeSpecific&&) = delete;
 
     [[nodiscard]] static Result Create(CoSimType coSimType,
-                                       [[maybe_unused]] ConnectionKind connectionKind,
-                                       [[maybe_unused]] std::string_view name,
+                                       ConnectionKind connectionKind,
+                                       std::string_view name,
                                        const std::vector<TController>& controllers,
                                        IProtocol& protocol,
                                        std::unique_ptr<BusExchangeSpecific>& busExchangeSpecific) {
         std::unique_ptr<IBusExchangePart<TBus>> outboundPart;
         std::unique_ptr<IBusExchangePart<TBus>> inboundPart;
 
-#ifdef _WIN32
         if (connectionKind == ConnectionKind::Local) {
             std::string_view suffixForTransmit = coSimType == CoSimType::Client ? "Transmit" : "Receive";
             std::string_view suffixForReceive = coSimType == CoSimType::Client ? "Receive" : "Transmit";
@@ -62,12 +58,10 @@ public:
             CheckResult(LocalBusExchangePart<TBus>::Create(protocol, std::move(transmitPartName), controllers, outboundPart));
             CheckResult(LocalBusExchangePart<TBus>::Create(protocol, std::move(receivePartName), controllers, inboundPart));
         } else {
-#endif
             CheckResult(RemoteBusExchangePart<TBus>::Create(protocol, controllers, outboundPart));
             CheckResult(RemoteBusExchangePart<TBus>::Create(protocol, controllers, inboundPart));
-#ifdef _WIN32
         }
-#endif
+
         if (coSimType == CoSimType::Client) {
             outboundPart = std::make_unique<LockedBusExchangePart<TBus>>(std::move(outboundPart));
             inboundPart = std::make_unique<LockedBusExchangePart<TBus>>(std::move(inboundPart));
@@ -107,8 +101,9 @@ public:
     [[nodiscard]] Result Deserialize(ChannelReader& reader,
                                      SimulationTime simulationTime,
                                      const BusMessageCallback<TBus>& messageCallback,
-                                     const BusMessageContainerCallback<TBus>& messageContainerCallback) const {
-        return _inboundPart->Deserialize(reader, simulationTime, messageCallback, messageContainerCallback);
+                                     const BusMessageContainerCallback<TBus>& messageContainerCallback,
+                                     const BusMessageContainersCallback<TBus>& messageContainersCallback) const {
+        return _inboundPart->Deserialize(reader, simulationTime, messageCallback, messageContainerCallback, messageContainersCallback);
     }
 
 private:
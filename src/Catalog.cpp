@@ -0,0 +1,375 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include "Catalog.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Channel.hpp"
+#include "CoSimTypes.hpp"
+#include "Logger.hpp"
+#include "OsUtilities.hpp"
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+namespace {
+
+constexpr uint32_t CatalogFormatVersion = 1;
+
+// Format version, the six counts and the size of the string table
+constexpr size_t CatalogHeaderSize = 8 * sizeof(uint32_t);
+
+// Offset into the string table and length
+constexpr size_t StringReferenceSize = 2 * sizeof(uint32_t);
+
+constexpr size_t IoSignalRecordSize = sizeof(IoSignalId) + sizeof(uint32_t) + sizeof(DataType) + sizeof(SizeKind) + StringReferenceSize;
+constexpr size_t ControllerRecordSize = sizeof(BusControllerId) + sizeof(uint32_t) + sizeof(uint64_t) + (3 * StringReferenceSize);
+constexpr size_t CanControllerRecordSize = ControllerRecordSize + sizeof(uint64_t);
+constexpr size_t EthControllerRecordSize = ControllerRecordSize + EthAddressLength;
+constexpr size_t LinControllerRecordSize = ControllerRecordSize + sizeof(LinControllerType);
+constexpr size_t FrControllerRecordSize = ControllerRecordSize;
+
+[[nodiscard]] uint64_t GetFnv1aHash(const void* data, size_t size) {
+    constexpr uint64_t offsetBasis = 14695981039346656037ULL;
+    constexpr uint64_t prime = 1099511628211ULL;
+
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = offsetBasis;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= prime;
+    }
+
+    return hash;
+}
+
+class StringTableWriter final {
+public:
+    void Add(std::string_view value) {
+        if (_offsets.find(value) == _offsets.end()) {
+            _offsets.emplace(value, _data.size());
+            _data.append(value);
+        }
+    }
+
+    void WriteReference(BlockWriter& writer, std::string_view value) const {
+        writer.Write(static_cast<uint32_t>(_offsets.at(value)));
+        writer.Write(static_cast<uint32_t>(value.size()));
+    }
+
+    [[nodiscard]] const std::string& GetData() const {
+        return _data;
+    }
+
+private:
+    std::unordered_map<std::string_view, size_t> _offsets;
+    std::string _data;
+};
+
+class StringTableReader final {
+public:
+    StringTableReader(const uint8_t* data, size_t size) : _data(data), _size(size) {
+    }
+
+    [[nodiscard]] Result ReadReference(BlockReader& reader, std::string& value) const {
+        uint32_t offset{};
+        uint32_t length{};
+        reader.Read(offset);
+        reader.Read(length);
+
+        if ((offset > _size) || (length > _size - offset)) {
+            LogError("Catalog contains an invalid name reference.");
+            return CreateError();
+        }
+
+        value.assign(reinterpret_cast<const char*>(_data + offset), length);
+        return CreateOk();
+    }
+
+private:
+    const uint8_t* _data{};
+    size_t _size{};
+};
+
+template <typename TController>
+void AddNames(StringTableWriter& stringTable, const std::vector<TController>& controllers) {
+    for (const auto& controller : controllers) {
+        stringTable.Add(controller.name);
+        stringTable.Add(controller.channelName);
+        stringTable.Add(controller.clusterName);
+    }
+}
+
+template <typename TController>
+void WriteNames(BlockWriter& writer, const StringTableWriter& stringTable, const TController& controller) {
+    stringTable.WriteReference(writer, controller.name);
+    stringTable.WriteReference(writer, controller.channelName);
+    stringTable.WriteReference(writer, controller.clusterName);
+}
+
+template <typename TController>
+[[nodiscard]] Result ReadNames(BlockReader& reader, const StringTableReader& stringTable, TController& controller) {
+    CheckResult(stringTable.ReadReference(reader, controller.name));
+    CheckResult(stringTable.ReadReference(reader, controller.channelName));
+    CheckResult(stringTable.ReadReference(reader, controller.clusterName));
+    return CreateOk();
+}
+
+[[nodiscard]] std::filesystem::path GetCachePath(std::string_view directory, std::string_view key) {
+    return std::filesystem::path(directory) / fmt::format("dSPACE.VEOS.CoSim.Catalog.{:016x}", GetFnv1aHash(key.data(), key.size()));
+}
+
+}  // namespace
+
+[[nodiscard]] Result SerializeCatalog(const std::vector<IoSignalContainer>& incomingSignals,
+                                      const std::vector<IoSignalContainer>& outgoingSignals,
+                                      const std::vector<CanControllerContainer>& canControllers,
+                                      const std::vector<EthControllerContainer>& ethControllers,
+                                      const std::vector<LinControllerContainer>& linControllers,
+                                      const std::vector<FrControllerContainer>& frControllers,
+                                      std::vector<uint8_t>& catalog) {
+    StringTableWriter stringTable;
+    for (const auto* signals : {&incomingSignals, &outgoingSignals}) {
+        for (const auto& signal : *signals) {
+            stringTable.Add(signal.name);
+        }
+    }
+
+    AddNames(stringTable, canControllers);
+    AddNames(stringTable, ethControllers);
+    AddNames(stringTable, linControllers);
+    AddNames(stringTable, frControllers);
+
+    const std::string& stringTableData = stringTable.GetData();
+    if (stringTableData.size() > UINT32_MAX) {
+        LogError("Names of the catalog exceed the maximum supported size.");
+        return CreateError();
+    }
+
+    size_t size = CatalogHeaderSize + ((incomingSignals.size() + outgoingSignals.size()) * IoSignalRecordSize) +
+                  (canControllers.size() * CanControllerRecordSize) + (ethControllers.size() * EthControllerRecordSize) +
+                  (linControllers.size() * LinControllerRecordSize) + (frControllers.size() * FrControllerRecordSize) + stringTableData.size();
+    catalog.resize(size);
+
+    BlockWriter writer(catalog.data(), catalog.size());
+    writer.Write(CatalogFormatVersion);
+    writer.Write(static_cast<uint32_t>(incomingSignals.size()));
+    writer.Write(static_cast<uint32_t>(outgoingSignals.size()));
+    writer.Write(static_cast<uint32_t>(canControllers.size()));
+    writer.Write(static_cast<uint32_t>(ethControllers.size()));
+    writer.Write(static_cast<uint32_t>(linControllers.size()));
+    writer.Write(static_cast<uint32_t>(frControllers.size()));
+    writer.Write(static_cast<uint32_t>(stringTableData.size()));
+
+    for (const auto* signals : {&incomingSignals, &outgoingSignals}) {
+        for (const auto& signal : *signals) {
+            writer.Write(signal.id);
+            writer.Write(signal.length);
+            writer.Write(signal.dataType);
+            writer.Write(signal.sizeKind);
+            stringTable.WriteReference(writer, signal.name);
+        }
+    }
+
+    for (const auto& controller : canControllers) {
+        writer.Write(controller.id);
+        writer.Write(controller.queueSize);
+        writer.Write(controller.bitsPerSecond);
+        writer.Write(controller.flexibleDataRateBitsPerSecond);
+        WriteNames(writer, stringTable, controller);
+    }
+
+    for (const auto& controller : ethControllers) {
+        writer.Write(controller.id);
+        writer.Write(controller.queueSize);
+        writer.Write(controller.bitsPerSecond);
+        writer.Write(controller.macAddress.data(), controller.macAddress.size());
+        WriteNames(writer, stringTable, controller);
+    }
+
+    for (const auto& controller : linControllers) {
+        writer.Write(controller.id);
+        writer.Write(controller.queueSize);
+        writer.Write(controller.bitsPerSecond);
+        writer.Write(controller.type);
+        WriteNames(writer, stringTable, controller);
+    }
+
+    for (const auto& controller : frControllers) {
+        writer.Write(controller.id);
+        writer.Write(controller.queueSize);
+        writer.Write(controller.bitsPerSecond);
+        WriteNames(writer, stringTable, controller);
+    }
+
+    writer.Write(stringTableData.data(), stringTableData.size());
+    writer.EndWrite();
+    return CreateOk();
+}
+
+[[nodiscard]] Result DeserializeCatalog(const std::vector<uint8_t>& catalog,
+                                        std::vector<IoSignalContainer>& incomingSignals,
+                                        std::vector<IoSignalContainer>& outgoingSignals,
+                                        std::vector<CanControllerContainer>& canControllers,
+                                        std::vector<EthControllerContainer>& ethControllers,
+                                        std::vector<LinControllerContainer>& linControllers,
+                                        std::vector<FrControllerContainer>& frControllers) {
+    if (catalog.size() < CatalogHeaderSize) {
+        LogError("Catalog is too small.");
+        return CreateError();
+    }
+
+    BlockReader headerReader(catalog.data(), CatalogHeaderSize);
+
+    uint32_t formatVersion{};
+    uint32_t incomingSignalsCount{};
+    uint32_t outgoingSignalsCount{};
+    uint32_t canControllersCount{};
+    uint32_t ethControllersCount{};
+    uint32_t linControllersCount{};
+    uint32_t frControllersCount{};
+    uint32_t stringTableSize{};
+    headerReader.Read(formatVersion);
+    headerReader.Read(incomingSignalsCount);
+    headerReader.Read(outgoingSignalsCount);
+    headerReader.Read(canControllersCount);
+    headerReader.Read(ethControllersCount);
+    headerReader.Read(linControllersCount);
+    headerReader.Read(frControllersCount);
+    headerReader.Read(stringTableSize);
+    headerReader.EndRead();
+
+    if (formatVersion != CatalogFormatVersion) {
+        LogError("Catalog format version {} is not supported.", formatVersion);
+        return CreateError();
+    }
+
+    // 64 bit arithmetic, so the counts cannot overflow the expected size
+    uint64_t recordsSize = ((static_cast<uint64_t>(incomingSignalsCount) + outgoingSignalsCount) * IoSignalRecordSize) +
+                           (static_cast<uint64_t>(canControllersCount) * CanControllerRecordSize) +
+                           (static_cast<uint64_t>(ethControllersCount) * EthControllerRecordSize) +
+                           (static_cast<uint64_t>(linControllersCount) * LinControllerRecordSize) +
+                           (static_cast<uint64_t>(frControllersCount) * FrControllerRecordSize);
+    if (CatalogHeaderSize + recordsSize + stringTableSize != catalog.size()) {
+        LogError("Catalog size does not match its content.");
+        return CreateError();
+    }
+
+    StringTableReader stringTable(catalog.data() + CatalogHeaderSize + recordsSize, stringTableSize);
+    BlockReader reader(catalog.data() + CatalogHeaderSize, static_cast<size_t>(recordsSize));
+
+    incomingSignals.resize(incomingSignalsCount);
+    outgoingSignals.resize(outgoingSignalsCount);
+    for (auto* signals : {&incomingSignals, &outgoingSignals}) {
+        for (auto& signal : *signals) {
+            reader.Read(signal.id);
+            reader.Read(signal.length);
+            reader.Read(signal.dataType);
+            reader.Read(signal.sizeKind);
+            CheckResult(stringTable.ReadReference(reader, signal.name));
+        }
+    }
+
+    canControllers.resize(canControllersCount);
+    for (auto& controller : canControllers) {
+        reader.Read(controller.id);
+        reader.Read(controller.queueSize);
+        reader.Read(controller.bitsPerSecond);
+        reader.Read(controller.flexibleDataRateBitsPerSecond);
+        CheckResult(ReadNames(reader, stringTable, controller));
+    }
+
+    ethControllers.resize(ethControllersCount);
+    for (auto& controller : ethControllers) {
+        reader.Read(controller.id);
+        reader.Read(controller.queueSize);
+        reader.Read(controller.bitsPerSecond);
+        reader.Read(controller.macAddress.data(), controller.macAddress.size());
+        CheckResult(ReadNames(reader, stringTable, controller));
+    }
+
+    linControllers.resize(linControllersCount);
+    for (auto& controller : linControllers) {
+        reader.Read(controller.id);
+        reader.Read(controller.queueSize);
+        reader.Read(controller.bitsPerSecond);
+        reader.Read(controller.type);
+        CheckResult(ReadNames(reader, stringTable, controller));
+    }
+
+    frControllers.resize(frControllersCount);
+    for (auto& controller : frControllers) {
+        reader.Read(controller.id);
+        reader.Read(controller.queueSize);
+        reader.Read(controller.bitsPerSecond);
+        CheckResult(ReadNames(reader, stringTable, controller));
+    }
+
+    reader.EndRead();
+    return CreateOk();
+}
+
+[[nodiscard]] uint64_t GetCatalogHash(const std::vector<uint8_t>& catalog) {
+    uint64_t hash = GetFnv1aHash(catalog.data(), catalog.size());
+    return hash == 0 ? 1 : hash;
+}
+
+[[nodiscard]] Result LoadCachedCatalog(std::string_view directory, std::string_view key, std::vector<uint8_t>& catalog) {
+    std::ifstream file(GetCachePath(directory, key), std::ios::binary | std::ios::ate);
+    if (!file) {
+        return CreateError();
+    }
+
+    auto size = static_cast<std::streamoff>(file.tellg());
+    if (size < 0) {
+        return CreateError();
+    }
+
+    catalog.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(catalog.data()), size)) {
+        catalog.clear();
+        return CreateError();
+    }
+
+    return CreateOk();
+}
+
+[[nodiscard]] Result StoreCachedCatalog(std::string_view directory, std::string_view key, const std::vector<uint8_t>& catalog) {
+    std::error_code errorCode;
+    std::filesystem::create_directories(std::filesystem::path(directory), errorCode);
+
+    // Other clients might read the same file, so it is replaced as a whole
+    std::filesystem::path path = GetCachePath(directory, key);
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += fmt::format(".{}.tmp", GetCurrentProcessIdCached());
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(reinterpret_cast<const char*>(catalog.data()), static_cast<std::streamsize>(catalog.size()))) {
+            LogWarning("Could not write catalog to cache directory '{}'.", directory);
+            return CreateError();
+        }
+    }
+
+    std::filesystem::rename(temporaryPath, path, errorCode);
+    if (errorCode) {
+        std::filesystem::remove(temporaryPath, errorCode);
+        LogWarning("Could not write catalog to cache directory '{}'.", directory);
+        return CreateError();
+    }
+
+    return CreateOk();
+}
+
+}  // namespace DsVeosCoSim
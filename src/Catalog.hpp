@@ -0,0 +1,39 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "CoSimTypes.hpp"
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+// Compact representation of the signals and controllers of a server. Fixed size records reference their names in one
+// string table, in which every distinct name is stored only once
+[[nodiscard]] Result SerializeCatalog(const std::vector<IoSignalContainer>& incomingSignals,
+                                      const std::vector<IoSignalContainer>& outgoingSignals,
+                                      const std::vector<CanControllerContainer>& canControllers,
+                                      const std::vector<EthControllerContainer>& ethControllers,
+                                      const std::vector<LinControllerContainer>& linControllers,
+                                      const std::vector<FrControllerContainer>& frControllers,
+                                      std::vector<uint8_t>& catalog);
+
+[[nodiscard]] Result DeserializeCatalog(const std::vector<uint8_t>& catalog,
+                                        std::vector<IoSignalContainer>& incomingSignals,
+                                        std::vector<IoSignalContainer>& outgoingSignals,
+                                        std::vector<CanControllerContainer>& canControllers,
+                                        std::vector<EthControllerContainer>& ethControllers,
+                                        std::vector<LinControllerContainer>& linControllers,
+                                        std::vector<FrControllerContainer>& frControllers);
+
+// Never 0, so 0 can stand for no catalog
+[[nodiscard]] uint64_t GetCatalogHash(const std::vector<uint8_t>& catalog);
+
+// Catalogs are cached per server in the given directory. Returns an error, if there is no cached catalog
+[[nodiscard]] Result LoadCachedCatalog(std::string_view directory, std::string_view key, std::vector<uint8_t>& catalog);
+[[nodiscard]] Result StoreCachedCatalog(std::string_view directory, std::string_view key, const std::vector<uint8_t>& catalog);
+
+}  // namespace DsVeosCoSim
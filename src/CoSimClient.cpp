@@ -2,21 +2,27 @@
 
 #include "CoSimClient.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
 #include "BusExchange.hpp"
+#include "Catalog.hpp"
 #include "Channel.hpp"
 #include "CoSimTypes.hpp"
+#include "Environment.hpp"
 #include "Logger.hpp"
 #include "OsUtilities.hpp"
 #include "PortMapper.hpp"
+#include "PortRegistry.hpp"
 #include "Protocol.hpp"
 #include "Result.hpp"
 #include "SignalExchange.hpp"
@@ -24,6 +30,7 @@
 namespace DsVeosCoSim {
 
 constexpr uint32_t ClientTimeoutInMilliseconds = 1000;
+constexpr uint32_t SessionResumeRetryIntervalInMilliseconds = 100;
 
 CoSimClient::CoSimClient()
     : _serializeIoData([this](ChannelWriter& writer) {
@@ -46,6 +53,11 @@ CoSimClient::CoSimClient()
         return CreateInvalidArgument();
     }
 
+    if (connectConfig.useInProcessChannel && connectConfig.serverName.empty()) {
+        LogError("ConnectConfig.serverName must be set for in-process connections.");
+        return CreateInvalidArgument();
+    }
+
     if (_isConnected) {
         return CreateOk();
     }
@@ -56,6 +68,8 @@ CoSimClient::CoSimClient()
     _serverName = connectConfig.serverName;
     _clientName = connectConfig.clientName;
     _remotePort = connectConfig.remotePort;
+    _configuredRemotePort = connectConfig.remotePort;
+    _useInProcessChannel = connectConfig.useInProcessChannel;
 
     CheckResult(CreateProtocol(ProtocolVersion1, _protocol));
 
@@ -110,6 +124,10 @@ void CoSimClient::Disconnect() {
     SetThreadAffinity(_serverName);
 
     Result result = RunCallbackBasedCoSimulationInternal();
+    while (IsNotConnected(result) && TryResumeSession()) {
+        result = RunCallbackBasedCoSimulationInternal();
+    }
+
     if (!IsOk(result)) {
         CloseConnection();
     }
@@ -137,6 +155,10 @@ void CoSimClient::Disconnect() {
     }
 
     Result result = PollCommandInternal(simulationTime, command, timeoutInMilliseconds);
+    while (IsNotConnected(result) && TryResumeSession()) {
+        result = PollCommandInternal(simulationTime, command, timeoutInMilliseconds);
+    }
+
     if (IsOk(result)) {
         return result;
     }
@@ -160,6 +182,12 @@ void CoSimClient::Disconnect() {
     }
 
     Result result = FinishCommandInternal();
+    if (IsNotConnected(result) && TryResumeSession()) {
+        // The server continues with the next command after the session got resumed
+        _currentCommand = Command::None;
+        return CreateOk();
+    }
+
     if (!IsOk(result)) {
         CloseConnection();
     }
@@ -273,6 +301,48 @@ void CoSimClient::Disconnect() {
     return _signalExchange->Read(incomingSignalId, length, value);
 }
 
+[[nodiscard]] Result CoSimClient::ResolveIncomingSignal(IoSignalId incomingSignalId, IoSignalHandle& incomingSignalHandle) const {
+    CheckResult(EnsureIsConnected());
+
+    return _signalExchange->ResolveReadSignal(incomingSignalId, incomingSignalHandle);
+}
+
+[[nodiscard]] Result CoSimClient::ResolveOutgoingSignal(IoSignalId outgoingSignalId, IoSignalHandle& outgoingSignalHandle) const {
+    CheckResult(EnsureIsConnected());
+
+    return _signalExchange->ResolveWriteSignal(outgoingSignalId, outgoingSignalHandle);
+}
+
+[[nodiscard]] Result CoSimClient::Write(IoSignalHandle outgoingSignalHandle, uint32_t length, const void* value) const {
+    CheckResult(EnsureIsConnected());
+
+    return _signalExchange->Write(outgoingSignalHandle, length, value);
+}
+
+[[nodiscard]] Result CoSimClient::Read(IoSignalHandle incomingSignalHandle, uint32_t& length, void* value) const {
+    CheckResult(EnsureIsConnected());
+
+    return _signalExchange->Read(incomingSignalHandle, length, value);
+}
+
+[[nodiscard]] Result CoSimClient::Read(IoSignalHandle incomingSignalHandle, uint32_t& length, const void** value) const {
+    CheckResult(EnsureIsConnected());
+
+    return _signalExchange->Read(incomingSignalHandle, length, value);
+}
+
+[[nodiscard]] Result CoSimClient::Write(const OutgoingSignalValue* outgoingSignalValues, uint32_t count) const {
+    CheckResult(EnsureIsConnected());
+
+    return _signalExchange->Write(outgoingSignalValues, count);
+}
+
+[[nodiscard]] Result CoSimClient::Read(IncomingSignalValue* incomingSignalValues, uint32_t count) const {
+    CheckResult(EnsureIsConnected());
+
+    return _signalExchange->Read(incomingSignalValues, count);
+}
+
 [[nodiscard]] Result CoSimClient::GetCanControllers(uint32_t& controllersCount, const CanController*& controllers) const {
     CheckResult(EnsureIsConnected());
 
@@ -437,6 +507,9 @@ void CoSimClient::ResetDataFromPreviousConnect() {
     _isConnected = {};
     _currentSimulationTime = {};
     _nextSimulationTime = {};
+    _stepSequenceNumber = {};
+    _sessionToken = {};
+    _sessionResumeTimeoutInMilliseconds = {};
     _nextCommand.exchange({});
     _callbacks = {};
     if (_channel) {
@@ -458,6 +531,10 @@ void CoSimClient::ResetDataFromPreviousConnect() {
 }
 
 [[nodiscard]] Result CoSimClient::ConnectInternal() {
+    if (_useInProcessChannel) {
+        return InProcessConnect();
+    }
+
     if (!_serverName.empty() && _remoteIpAddress.empty() && (_remotePort == 0)) {
         if (IsOk(LocalConnect())) {
             return CreateOk();
@@ -477,23 +554,54 @@ void CoSimClient::ResetDataFromPreviousConnect() {
     return CreateOk();
 }
 
+[[nodiscard]] Result CoSimClient::InProcessConnect() {
+    CheckResultWithMessage(TryConnectToInProcessChannel(_serverName, _channel),
+                           fmt::format("Could not connect to in-process dSPACE VEOS CoSim server '{}'.", _serverName));
+
+    _connectionKind = ConnectionKind::InProcess;
+    return CreateOk();
+}
+
 [[nodiscard]] Result CoSimClient::RemoteConnect() {
+    // Servers on the same host can be found without asking the port mapper
+    bool isPortFromRegistry{};
+    if ((_remotePort == 0) && (_remoteIpAddress == "127.0.0.1")) {
+        isPortFromRegistry = IsOk(PortRegistryGetPort(_serverName, _remotePort));
+    }
+
     if (_remotePort == 0) {
-        LogInfo("Obtaining TCP port of dSPACE VEOS CoSim server '{}' at {} ...", _serverName, _remoteIpAddress);
-        CheckResultWithMessage(PortMapperGetPort(_remoteIpAddress, _serverName, _remotePort), "Could not get port from port mapper.");
+        CheckResult(GetPortFromPortMapper());
+    }
+
+    Result result = ConnectToTcpChannel();
+    if (!IsOk(result) && isPortFromRegistry) {
+        // The registry entry might belong to another server, so the port mapper has the final say
+        LogInfo("Could not connect to the port from the port registry. Falling back to the port mapper.");
+        _remotePort = _configuredRemotePort;
+        CheckResult(GetPortFromPortMapper());
+        result = ConnectToTcpChannel();
     }
 
+    CheckResultWithMessage(result, "Could not connect to dSPACE VEOS CoSim server.");
+
+    _connectionKind = ConnectionKind::Remote;
+    return CreateOk();
+}
+
+[[nodiscard]] Result CoSimClient::GetPortFromPortMapper() {
+    LogInfo("Obtaining TCP port of dSPACE VEOS CoSim server '{}' at {} ...", _serverName, _remoteIpAddress);
+    CheckResultWithMessage(PortMapperGetPort(_remoteIpAddress, _serverName, _remotePort), "Could not get port from port mapper.");
+    return CreateOk();
+}
+
+[[nodiscard]] Result CoSimClient::ConnectToTcpChannel() {
     if (_serverName.empty()) {
         LogInfo("Connecting to dSPACE VEOS CoSim server at {}:{} ...", _remoteIpAddress, _remotePort);
     } else {
         LogInfo("Connecting to dSPACE VEOS CoSim server '{}' at {}:{} ...", _serverName, _remoteIpAddress, _remotePort);
     }
 
-    CheckResultWithMessage(TryConnectToTcpChannel(_remoteIpAddress, _remotePort, _localPort, ClientTimeoutInMilliseconds, _channel),
-                           "Could not connect to dSPACE VEOS CoSim server.");
-
-    _connectionKind = ConnectionKind::Remote;
-    return CreateOk();
+    return TryConnectToTcpChannel(_remoteIpAddress, _remotePort, _localPort, ClientTimeoutInMilliseconds, _channel);
 }
 
 [[nodiscard]] Result CoSimClient::SendConnectRequest() const {
@@ -510,6 +618,7 @@ void CoSimClient::ResetDataFromPreviousConnect() {
     }
 
     Mode mode{};
+    uint32_t maxFrameSize{};
     CheckResultWithMessage(_protocol->ReadConnectOk(_channel->GetReader(),
                                                     mode,
                                                     _stepSize,
@@ -519,9 +628,25 @@ void CoSimClient::ResetDataFromPreviousConnect() {
                                                     _canControllers,
                                                     _ethControllers,
                                                     _linControllers,
-                                                    _frControllers),
+                                                    _frControllers,
+                                                    maxFrameSize),
                            "Could not read connect ok frame.");
 
+    // The server announces the largest frame it accepts. Frames of the server are bounded by the same value
+    if ((_connectionKind == ConnectionKind::Remote) && (serverProtocolVersion >= ProtocolVersion3)) {
+        _channel->GetWriter().SetMaxFrameSize(std::min(maxFrameSize, GetMaxFrameSize()));
+        _channel->GetReader().SetMaxFrameSize(maxFrameSize);
+    }
+
+    _maxFrameSize = maxFrameSize;
+    if (_protocol->GetVersion() >= ProtocolVersion5) {
+        CheckResultWithMessage(ReceiveSession(), "Could not receive session frame.");
+    }
+
+    if (_protocol->GetVersion() >= ProtocolVersion6) {
+        CheckResultWithMessage(ReceiveCatalog(), "Could not receive catalog.");
+    }
+
     _incomingSignalsExtern = Convert(_incomingSignals);
     _outgoingSignalsExtern = Convert(_outgoingSignals);
 
@@ -532,6 +657,8 @@ void CoSimClient::ResetDataFromPreviousConnect() {
 
     if (_connectionKind == ConnectionKind::Local) {
         LogInfo("Connected to local dSPACE VEOS CoSim server '{}'.", _serverName);
+    } else if (_connectionKind == ConnectionKind::InProcess) {
+        LogInfo("Connected to in-process dSPACE VEOS CoSim server '{}'.", _serverName);
     } else {
         if (_serverName.empty()) {
             LogInfo("Connected to dSPACE VEOS CoSim server at {}:{}.", _remoteIpAddress, _remotePort);
@@ -580,6 +707,108 @@ void CoSimClient::ResetDataFromPreviousConnect() {
     }
 }
 
+[[nodiscard]] Result CoSimClient::ReceiveSession() {
+    FrameKind frameKind{};
+    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+
+    switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
+        case FrameKind::Session:
+            CheckResultWithMessage(_protocol->ReadSession(_channel->GetReader(), _sessionToken, _sessionResumeTimeoutInMilliseconds),
+                                   "Could not read session frame.");
+            return CreateOk();
+        default:
+            return OnUnexpectedFrame(frameKind);
+    }
+}
+
+[[nodiscard]] Result CoSimClient::ReceiveCatalog() {
+    const std::string& cacheDirectory = GetCatalogCacheDirectory();
+    std::string cacheKey = _serverName.empty() ? fmt::format("{}:{}", _remoteIpAddress, _remotePort) : fmt::format("{}@{}", _serverName, _remoteIpAddress);
+
+    std::vector<uint8_t> cachedCatalog;
+    uint64_t cachedCatalogHash{};
+    if (!cacheDirectory.empty() && IsOk(LoadCachedCatalog(cacheDirectory, cacheKey, cachedCatalog))) {
+        cachedCatalogHash = GetCatalogHash(cachedCatalog);
+    }
+
+    CheckResultWithMessage(_protocol->SendGetCatalog(_channel->GetWriter(), cachedCatalogHash), "Could not send get catalog frame.");
+
+    FrameKind frameKind{};
+    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+    if (frameKind != FrameKind::Catalog) {
+        return OnUnexpectedFrame(frameKind);
+    }
+
+    uint64_t catalogHash{};
+    std::vector<uint8_t> catalog;
+    CheckResultWithMessage(_protocol->ReadCatalog(_channel->GetReader(), catalogHash, catalog), "Could not read catalog frame.");
+
+    if (catalog.empty()) {
+        if ((cachedCatalogHash == 0) || (catalogHash != cachedCatalogHash)) {
+            LogError("Protocol error. Received no catalog, although none is cached.");
+            return CreateError();
+        }
+
+        catalog = std::move(cachedCatalog);
+    } else if (!cacheDirectory.empty()) {
+        (void)StoreCachedCatalog(cacheDirectory, cacheKey, catalog);
+    }
+
+    return DeserializeCatalog(catalog, _incomingSignals, _outgoingSignals, _canControllers, _ethControllers, _linControllers, _frControllers);
+}
+
+// Reconnects within the time the server keeps the session. Signal values and bus messages are kept on both sides
+[[nodiscard]] bool CoSimClient::TryResumeSession() {
+    if (!_isConnected || (_sessionToken == 0)) {
+        return false;
+    }
+
+    LogWarning("Lost connection to dSPACE VEOS CoSim server. Trying to resume the session ...");
+    _channel->Disconnect();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(_sessionResumeTimeoutInMilliseconds);
+    while (_isConnected && (_sessionToken != 0) && (std::chrono::steady_clock::now() < deadline)) {
+        if (IsOk(ResumeSession())) {
+            LogInfo("Resumed session with dSPACE VEOS CoSim server.");
+            return true;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(SessionResumeRetryIntervalInMilliseconds));
+    }
+
+    return false;
+}
+
+[[nodiscard]] Result CoSimClient::ResumeSession() {
+    // The server listens on a new port, if it was not configured
+    _remotePort = _configuredRemotePort;
+    CheckResult(RemoteConnect());
+
+    _channel->GetWriter().SetMaxFrameSize(std::min(_maxFrameSize, GetMaxFrameSize()));
+    _channel->GetReader().SetMaxFrameSize(_maxFrameSize);
+
+    CheckResultWithMessage(_protocol->SendResume(_channel->GetWriter(), _sessionToken), "Could not send resume frame.");
+
+    FrameKind frameKind{};
+    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+
+    switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
+        case FrameKind::Ok:
+            CheckResultWithMessage(_protocol->ReadOk(_channel->GetReader()), "Could not read ok frame.");
+            break;
+        case FrameKind::Error:
+            // The server does not know the session anymore, so there is no point in trying again
+            _sessionToken = 0;
+            return OnConnectError();
+        default:
+            return OnUnexpectedFrame(frameKind);
+    }
+
+    // Values written in the meantime might have been sent over the broken connection
+    _signalExchange->MarkAllAsChanged();
+    return CreateOk();
+}
+
 [[nodiscard]] Result CoSimClient::RunCallbackBasedCoSimulationInternal() {
     while (_isConnected) {
         FrameKind frameKind{};
@@ -714,8 +943,9 @@ void CoSimClient::ResetDataFromPreviousConnect() {
 }
 
 [[nodiscard]] Result CoSimClient::OnStep() {
-    CheckResultWithMessage(_protocol->ReadStep(_channel->GetReader(), _currentSimulationTime, _deserializeIoData, _deserializeBusMessages, _callbacks),
-                           "Could not read step frame.");
+    CheckResultWithMessage(
+        _protocol->ReadStep(_channel->GetReader(), _stepSequenceNumber, _currentSimulationTime, _deserializeIoData, _deserializeBusMessages, _callbacks),
+        "Could not read step frame.");
 
     if (_callbacks.simulationEndStepCallback) {
         _callbacks.simulationEndStepCallback(_currentSimulationTime);
@@ -751,6 +981,9 @@ void CoSimClient::ResetDataFromPreviousConnect() {
     TerminateReason reason{};
     CheckResultWithMessage(_protocol->ReadTerminate(_channel->GetReader(), _currentSimulationTime, reason), "Could not read terminate frame.");
 
+    // The server goes away after the simulation terminated, which must not be taken for a connection loss
+    _sessionToken = 0;
+
     if (_callbacks.simulationTerminatedCallback) {
         _callbacks.simulationTerminatedCallback(_currentSimulationTime, reason);
     }
@@ -785,8 +1018,9 @@ void CoSimClient::ResetDataFromPreviousConnect() {
 
 [[nodiscard]] Result CoSimClient::FinishStep() {
     Command nextCommand = _nextCommand.exchange({});
-    CheckResultWithMessage(_protocol->SendStepOk(_channel->GetWriter(), _nextSimulationTime, nextCommand, _serializeIoData, _serializeBusMessages),
-                           "Could not send step ok frame.");
+    CheckResultWithMessage(
+        _protocol->SendStepOk(_channel->GetWriter(), _stepSequenceNumber, _nextSimulationTime, nextCommand, _serializeIoData, _serializeBusMessages),
+        "Could not send step ok frame.");
     return CreateOk();
 }
 
@@ -60,6 +60,19 @@ public:
     [[nodiscard]] Result Read(IoSignalId incomingSignalId, uint32_t& length, void* value) const;
     [[nodiscard]] Result Read(IoSignalId incomingSignalId, uint32_t& length, const void** value) const;
 
+    // Handles stay valid until the client disconnects
+    [[nodiscard]] Result ResolveIncomingSignal(IoSignalId incomingSignalId, IoSignalHandle& incomingSignalHandle) const;
+    [[nodiscard]] Result ResolveOutgoingSignal(IoSignalId outgoingSignalId, IoSignalHandle& outgoingSignalHandle) const;
+
+    [[nodiscard]] Result Write(IoSignalHandle outgoingSignalHandle, uint32_t length, const void* value) const;
+
+    [[nodiscard]] Result Read(IoSignalHandle incomingSignalHandle, uint32_t& length, void* value) const;
+    [[nodiscard]] Result Read(IoSignalHandle incomingSignalHandle, uint32_t& length, const void** value) const;
+
+    // Processes all values under one lock. Stops at the first value, which cannot be written or read
+    [[nodiscard]] Result Write(const OutgoingSignalValue* outgoingSignalValues, uint32_t count) const;
+    [[nodiscard]] Result Read(IncomingSignalValue* incomingSignalValues, uint32_t count) const;
+
     [[nodiscard]] Result GetCanControllers(uint32_t& controllersCount, const CanController*& controllers) const;
     [[nodiscard]] Result GetEthControllers(uint32_t& controllersCount, const EthController*& controllers) const;
     [[nodiscard]] Result GetLinControllers(uint32_t& controllersCount, const LinController*& controllers) const;
@@ -100,11 +113,18 @@ private:
     void ResetDataFromPreviousConnect();
     [[nodiscard]] Result ConnectInternal();
     [[nodiscard]] Result LocalConnect();
+    [[nodiscard]] Result InProcessConnect();
     [[nodiscard]] Result RemoteConnect();
+    [[nodiscard]] Result GetPortFromPortMapper();
+    [[nodiscard]] Result ConnectToTcpChannel();
     [[nodiscard]] Result SendConnectRequest() const;
     [[nodiscard]] Result OnConnectOk();
     [[nodiscard]] Result OnConnectError() const;
     [[nodiscard]] Result ReceiveConnectResponse();
+    [[nodiscard]] Result ReceiveSession();
+    [[nodiscard]] Result ReceiveCatalog();
+    [[nodiscard]] bool TryResumeSession();
+    [[nodiscard]] Result ResumeSession();
     [[nodiscard]] Result RunCallbackBasedCoSimulationInternal();
     [[nodiscard]] Result PollCommandInternal(SimulationTime& simulationTime, Command& command, uint32_t timeoutInMilliseconds);
     [[nodiscard]] Result FinishCommandInternal();
@@ -134,17 +154,24 @@ private:
     Callbacks _callbacks{};
     SimulationTime _currentSimulationTime{};
     SimulationTime _nextSimulationTime{};
+    uint32_t _stepSequenceNumber{};
     SimulationTime _roundTripTime{};
 
     SimulationTime _stepSize{};
 
     SimulationState _simulationState{};
 
+    uint64_t _sessionToken{};
+    uint32_t _sessionResumeTimeoutInMilliseconds{};
+    uint32_t _maxFrameSize{};
+
     std::string _remoteIpAddress;
     std::string _serverName;
     std::string _clientName;
     uint16_t _remotePort{};
+    uint16_t _configuredRemotePort{};
     uint16_t _localPort{};
+    bool _useInProcessChannel{};
 
     ResponderMode _responderMode{};
     Command _currentCommand{};
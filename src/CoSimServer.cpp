@@ -2,20 +2,28 @@
 
 #include "CoSimServer.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <random>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "BusExchange.hpp"
+#include "Catalog.hpp"
 #include "Channel.hpp"
 #include "CoSimTypes.hpp"
+#include "Environment.hpp"
 #include "Logger.hpp"
 #include "OsUtilities.hpp"
 #include "PortMapper.hpp"
+#include "PortRegistry.hpp"
 #include "Protocol.hpp"
 #include "Result.hpp"
 #include "SignalExchange.hpp"
@@ -24,24 +32,49 @@ using namespace std::chrono;
 
 namespace DsVeosCoSim {
 
-CoSimServer::CoSimServer() {
-    _serializeIoData = [this](ChannelWriter& writer) {
-        return _signalExchange->Serialize(writer);
+namespace {
+
+#ifndef _WIN32
+
+// Clients of older versions do not notify local servers, so those are still checked from time to time
+constexpr uint32_t ConnectionCheckIntervalInMilliseconds = 100;
+
+#endif
+
+// Identifies the session of a client. 0 is reserved for sessions that cannot be resumed
+[[nodiscard]] uint64_t CreateSessionToken() {
+    static std::mt19937_64 generator{std::random_device{}()};
+
+    uint64_t sessionToken{};
+    while (sessionToken == 0) {
+        sessionToken = generator();
+    }
+
+    return sessionToken;
+}
+
+}  // namespace
+
+CoSimServer::Connection::Connection() {
+    serializeIoData = [this](ChannelWriter& writer) {
+        return signalExchange->Serialize(writer);
     };
 
-    _serializeBusMessages = [this](ChannelWriter& writer) {
-        return _busExchange->Serialize(writer);
+    serializeBusMessages = [this](ChannelWriter& writer) {
+        return busExchange->Serialize(writer);
     };
 
-    _deserializeIoData = [this](ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) {
-        return _signalExchange->Deserialize(reader, simulationTime, callbacks);
+    deserializeIoData = [this](ChannelReader& reader, SimulationTime simulationTime, const Callbacks& connectionCallbacks) {
+        return signalExchange->Deserialize(reader, simulationTime, connectionCallbacks);
     };
 
-    _deserializeBusMessages = [this](ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) {
-        return _busExchange->Deserialize(reader, simulationTime, callbacks);
+    deserializeBusMessages = [this](ChannelReader& reader, SimulationTime simulationTime, const Callbacks& connectionCallbacks) {
+        return busExchange->Deserialize(reader, simulationTime, connectionCallbacks);
     };
 }
 
+CoSimServer::CoSimServer() = default;
+
 CoSimServer::~CoSimServer() noexcept {
     Unload();
 }
@@ -53,6 +86,9 @@ Result CoSimServer::Load(const CoSimServerConfig& config) {
     _isClientOptional = config.isClientOptional;
     _stepSize = config.stepSize;
     _registerAtPortMapper = config.registerAtPortMapper;
+    _enablePipelinedStepping = config.enablePipelinedStepping;
+    _maxClientCount = std::max(config.maxClientCount, 1U);
+    _sessionResumeTimeoutInMilliseconds = config.sessionResumeTimeoutInMilliseconds;
     _incomingSignals = config.incomingSignals;
     _outgoingSignals = config.outgoingSignals;
     _canControllers = config.canControllers;
@@ -60,6 +96,10 @@ Result CoSimServer::Load(const CoSimServerConfig& config) {
     _linControllers = config.linControllers;
     _frControllers = config.frControllers;
 
+    // Serialized once, since all clients of protocol version 6 and newer receive the same catalog
+    CheckResult(SerializeCatalog(_incomingSignals, _outgoingSignals, _canControllers, _ethControllers, _linControllers, _frControllers, _catalog));
+    _catalogHash = GetCatalogHash(_catalog);
+
     _callbacks.simulationStartedCallback = config.simulationStartedCallback;
     _callbacks.simulationStoppedCallback = config.simulationStoppedCallback;
     _callbacks.simulationPausedCallback = config.simulationPausedCallback;
@@ -71,12 +111,15 @@ Result CoSimServer::Load(const CoSimServerConfig& config) {
     _callbacks.frMessageContainerReceivedCallback = config.frMessageContainerReceivedCallback;
     _callbacks.ethMessageContainerReceivedCallback = config.ethMessageContainerReceivedCallback;
 
-    CheckResult(CreateProtocol(ProtocolVersion1, _protocol));
-
     if (config.startPortMapper) {
         CheckResult(CreatePortMapperServer(_enableRemoteAccess, _portMapperServer));
     }
 
+#ifndef _WIN32
+    CheckResult(Poller::Create(_acceptPoller));
+    CheckResult(Poller::Create(_poller));
+#endif
+
     CheckResult(StartAccepting());
     _simulationState = SimulationState::Stopped;
     return CreateOk();
@@ -85,9 +128,9 @@ Result CoSimServer::Load(const CoSimServerConfig& config) {
 void CoSimServer::Unload() {
     _simulationState = SimulationState::Unloaded;
 
-    if (_channel) {
-        _channel.reset();
-    }
+    _signalOwners.clear();
+    _connections.clear();
+    _suspendedConnections.clear();
 
     StopAccepting();
 
@@ -96,223 +139,264 @@ void CoSimServer::Unload() {
     }
 }
 
+// Sends to all clients first and only then receives their responses, so the clients work at the same time.
+// Connections that failed are closed afterwards
+template <typename SendFunction, typename ReceiveFunction>
+Result CoSimServer::ForEachConnection(const SendFunction& send, const ReceiveFunction& receive) {
+    for (const auto& connection : _connections) {
+        connection->isFailed = !IsOk(send(*connection));
+    }
+
+    for (const auto& connection : _connections) {
+        if (!connection->isFailed) {
+            connection->isFailed = !IsOk(receive(*connection));
+        }
+    }
+
+    CheckResult(CloseFailedConnections());
+    HandlePendingCommands();
+    return CreateOk();
+}
+
+template <typename Function>
+Result CoSimServer::ForEachSession(const Function& function) const {
+    for (const auto* connections : {&_connections, &_suspendedConnections}) {
+        for (const auto& connection : *connections) {
+            CheckResult(function(*connection));
+        }
+    }
+
+    return CreateOk();
+}
+
 Result CoSimServer::Start(SimulationTime simulationTime) {
     _simulationState = SimulationState::Running;
 
-    if (!_channel) {
-        if (_isClientOptional) {
-            return CreateOk();
-        }
+    CheckResult(HandleSuspendedConnections(true));
 
+    if (!_isClientOptional && (_connections.size() < _maxClientCount)) {
         LogInfo("Waiting for dSPACE VEOS CoSim client to connect to dSPACE VEOS CoSim server '{}' ...", _serverName);
 
-        while (true) {
-            Result result = AcceptChannel();
-            if (IsOk(result)) {
-                break;
-            }
-
+        while (_connections.size() < _maxClientCount) {
+            Result result = AcceptConnection();
             if (IsNotConnected(result)) {
-                std::this_thread::sleep_for(milliseconds(1));
+                WaitForConnection();
                 continue;
             }
 
-            return result;
-        }
+            CheckResult(result);
 
-        if (!IsOk(OnHandleConnect())) {
-            return CloseConnection();
+            if (!IsOk(OnHandleConnect(*_connections.back()))) {
+                _connections.back()->isFailed = true;
+                return CloseFailedConnections();
+            }
         }
     }
 
-    if (!IsOk(StartInternal(simulationTime))) {
-        return CloseConnection();
-    }
-
-    return CreateOk();
+    return ForEachConnection(
+        [this, simulationTime](Connection& connection) {
+            return StartInternal(connection, simulationTime);
+        },
+        [this](Connection& connection) {
+            return ReceiveOk(connection);
+        });
 }
 
 Result CoSimServer::Stop(SimulationTime simulationTime) {
     _simulationState = SimulationState::Stopped;
 
-    if (!_channel) {
-        return CreateOk();
-    }
+    CheckResult(HandleSuspendedConnections(true));
 
-    if (!IsOk(StopInternal(simulationTime))) {
-        return CloseConnection();
-    }
-
-    return CreateOk();
+    return ForEachConnection(
+        [this, simulationTime](Connection& connection) {
+            return StopInternal(connection, simulationTime);
+        },
+        [this](Connection& connection) {
+            return ReceiveOk(connection);
+        });
 }
 
 Result CoSimServer::Terminate(SimulationTime simulationTime, TerminateReason reason) {
     _simulationState = SimulationState::Terminated;
 
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    if (!IsOk(TerminateInternal(simulationTime, reason))) {
-        return CloseConnection();
-    }
+    CheckResult(HandleSuspendedConnections(true));
 
-    return CreateOk();
+    return ForEachConnection(
+        [this, simulationTime, reason](Connection& connection) {
+            return TerminateInternal(connection, simulationTime, reason);
+        },
+        [this](Connection& connection) {
+            return ReceiveOk(connection);
+        });
 }
 
 Result CoSimServer::Pause(SimulationTime simulationTime) {
     _simulationState = SimulationState::Paused;
 
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    if (!IsOk(PauseInternal(simulationTime))) {
-        return CloseConnection();
-    }
+    CheckResult(HandleSuspendedConnections(true));
 
-    return CreateOk();
+    return ForEachConnection(
+        [this, simulationTime](Connection& connection) {
+            return PauseInternal(connection, simulationTime);
+        },
+        [this](Connection& connection) {
+            return ReceiveOk(connection);
+        });
 }
 
 Result CoSimServer::Continue(SimulationTime simulationTime) {
     _simulationState = SimulationState::Running;
 
-    if (!_channel) {
-        return CreateOk();
-    }
+    CheckResult(HandleSuspendedConnections(true));
 
-    if (!IsOk(ContinueInternal(simulationTime))) {
-        return CloseConnection();
-    }
-
-    return CreateOk();
+    return ForEachConnection(
+        [this, simulationTime](Connection& connection) {
+            return ContinueInternal(connection, simulationTime);
+        },
+        [this](Connection& connection) {
+            return ReceiveOk(connection);
+        });
 }
 
 Result CoSimServer::Step(SimulationTime simulationTime, SimulationTime& nextSimulationTime) {
     nextSimulationTime = {};
 
-    if (!_channel) {
+    CheckResult(HandleSuspendedConnections(false));
+
+    if (_connections.empty()) {
         return CreateOk();
     }
 
-    Command command{};
-    if (!IsOk(StepInternal(simulationTime, nextSimulationTime, command))) {
-        return CloseConnection();
+    if (_firstStep) {
+        SetThreadAffinity(_serverName);
+        _firstStep = false;
     }
 
-    HandlePendingCommand(command);
-    return CreateOk();
+    // With more than one client, all step frames must be sent before the first response is awaited
+    bool deferSend = _connections.size() == 1;
+
+    return ForEachConnection(
+        [this, simulationTime, deferSend](Connection& connection) {
+            return StepInternal(connection, simulationTime, deferSend);
+        },
+        [this, &nextSimulationTime](Connection& connection) {
+            SimulationTime clientNextSimulationTime{};
+            CheckResult(ReceiveStepOk(connection, clientNextSimulationTime));
+
+            // The earliest time any client asked for wins
+            if ((clientNextSimulationTime > SimulationTime{}) &&
+                ((nextSimulationTime == SimulationTime{}) || (clientNextSimulationTime < nextSimulationTime))) {
+                nextSimulationTime = clientNextSimulationTime;
+            }
+
+            return CreateOk();
+        });
 }
 
 Result CoSimServer::Write(IoSignalId signalId, uint32_t length, const void* value) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _signalExchange->Write(signalId, length, value);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.signalExchange->Write(signalId, length, value);
+    });
 }
 
 Result CoSimServer::Read(IoSignalId signalId, uint32_t& length, const void** value, bool& valueRead) const {
-    if (!_channel) {
+    const Connection* connection{};
+    if (!_connections.empty()) {
+        connection = _connections.front().get();
+    } else if (!_suspendedConnections.empty()) {
+        connection = _suspendedConnections.front().get();
+    } else {
         valueRead = false;
         return CreateOk();
     }
 
+    if (auto search = _signalOwners.find(signalId); search != _signalOwners.end()) {
+        connection = search->second;
+    }
+
     valueRead = true;
-    return _signalExchange->Read(signalId, length, value);
+    return connection->signalExchange->Read(signalId, length, value);
 }
 
 Result CoSimServer::Transmit(const CanMessage& message) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(message);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(message);
+    });
 }
 
 Result CoSimServer::Transmit(const EthMessage& message) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(message);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(message);
+    });
 }
 
 Result CoSimServer::Transmit(const LinMessage& message) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(message);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(message);
+    });
 }
 
 Result CoSimServer::Transmit(const FrMessage& message) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(message);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(message);
+    });
 }
 
 Result CoSimServer::Transmit(const CanMessageContainer& messageContainer) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(messageContainer);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(messageContainer);
+    });
 }
 
 Result CoSimServer::Transmit(const EthMessageContainer& messageContainer) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(messageContainer);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(messageContainer);
+    });
 }
 
 Result CoSimServer::Transmit(const LinMessageContainer& messageContainer) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(messageContainer);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(messageContainer);
+    });
 }
 
 Result CoSimServer::Transmit(const FrMessageContainer& messageContainer) const {
-    if (!_channel) {
-        return CreateOk();
-    }
-
-    return _busExchange->Transmit(messageContainer);
+    return ForEachSession([&](const Connection& connection) {
+        return connection.busExchange->Transmit(messageContainer);
+    });
 }
 
 Result CoSimServer::BackgroundService(SimulationTime& roundTripTime) {
     roundTripTime = {};
-    if (!_channel) {
-        Result result = AcceptChannel();
-        if (IsNotConnected(result)) {
+    ExpireSuspendedConnections(false);
+
+    if (_connections.size() < _maxClientCount) {
+        Result result = AcceptConnection();
+        if (IsOk(result)) {
+            if (!IsOk(OnHandleConnect(*_connections.back()))) {
+                _connections.back()->isFailed = true;
+                return CloseFailedConnections();
+            }
+
             return CreateOk();
         }
 
-        if (!IsOk(result)) {
+        if (!IsNotConnected(result)) {
             return result;
         }
-
-        if (!IsOk(OnHandleConnect())) {
-            return CloseConnection();
-        }
-
-        return CreateOk();
     }
 
-    Command command{};
-    if (!IsOk(Ping(command))) {
-        return CloseConnection();
-    }
+    bool deferSend = _connections.size() == 1;
 
-    roundTripTime = _roundTripTime;
-    HandlePendingCommand(command);
-    return CreateOk();
+    return ForEachConnection(
+        [this, deferSend](Connection& connection) {
+            return Ping(connection, deferSend);
+        },
+        [this, &roundTripTime](Connection& connection) {
+            CheckResult(ReceivePingOk(connection));
+            roundTripTime = std::max(roundTripTime, connection.roundTripTime);
+            return CreateOk();
+        });
 }
 
 Result CoSimServer::GetLocalPort(uint16_t& localPort) const {
@@ -325,65 +409,263 @@ Result CoSimServer::GetLocalPort(uint16_t& localPort) const {
     return CreateError();
 }
 
-Result CoSimServer::StartInternal(SimulationTime simulationTime) {
-    CheckResultWithMessage(_protocol->SendStart(_channel->GetWriter(), simulationTime), "Could not send start frame.");
-    CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+Result CoSimServer::GetWaitHandle([[maybe_unused]] int32_t& fileDescriptor) const {
+#ifdef _WIN32
+    LogError("Wait handles are not supported on this platform.");
+    return CreateError();
+#else
+    if (!_poller.IsValid()) {
+        LogError("dSPACE VEOS CoSim server is not loaded.");
+        return CreateError();
+    }
+
+    fileDescriptor = _poller.GetFileDescriptor();
     return CreateOk();
+#endif
 }
 
-Result CoSimServer::StopInternal(SimulationTime simulationTime) {
-    CheckResultWithMessage(_protocol->SendStop(_channel->GetWriter(), simulationTime), "Could not send stop frame.");
-    CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+Result CoSimServer::StartInternal(Connection& connection, SimulationTime simulationTime) {
+    CheckResult(FinishPendingStep(connection));
+    CheckResultWithMessage(connection.protocol->SendStart(connection.channel->GetWriter(), simulationTime), "Could not send start frame.");
+    // The client clears its incoming signals on start
+    connection.signalExchange->RequireFullValues();
     return CreateOk();
 }
 
-Result CoSimServer::TerminateInternal(SimulationTime simulationTime, TerminateReason reason) {
-    CheckResultWithMessage(_protocol->SendTerminate(_channel->GetWriter(), simulationTime, reason), "Could not send terminate frame.");
-    CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+Result CoSimServer::StopInternal(Connection& connection, SimulationTime simulationTime) {
+    CheckResult(FinishPendingStep(connection));
+    CheckResultWithMessage(connection.protocol->SendStop(connection.channel->GetWriter(), simulationTime), "Could not send stop frame.");
     return CreateOk();
 }
 
-Result CoSimServer::PauseInternal(SimulationTime simulationTime) {
-    CheckResultWithMessage(_protocol->SendPause(_channel->GetWriter(), simulationTime), "Could not send pause frame.");
-    CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+Result CoSimServer::TerminateInternal(Connection& connection, SimulationTime simulationTime, TerminateReason reason) {
+    CheckResult(FinishPendingStep(connection));
+    CheckResultWithMessage(connection.protocol->SendTerminate(connection.channel->GetWriter(), simulationTime, reason),
+                           "Could not send terminate frame.");
     return CreateOk();
 }
 
-Result CoSimServer::ContinueInternal(SimulationTime simulationTime) {
-    CheckResultWithMessage(_protocol->SendContinue(_channel->GetWriter(), simulationTime), "Could not send continue frame.");
-    CheckResultWithMessage(WaitForOkFrame(), "Could not receive ok frame.");
+Result CoSimServer::PauseInternal(Connection& connection, SimulationTime simulationTime) {
+    CheckResult(FinishPendingStep(connection));
+    CheckResultWithMessage(connection.protocol->SendPause(connection.channel->GetWriter(), simulationTime), "Could not send pause frame.");
     return CreateOk();
 }
 
-Result CoSimServer::StepInternal(SimulationTime simulationTime, SimulationTime& nextSimulationTime, Command& command) {
-    if (_firstStep) {
-        SetThreadAffinity(_serverName);
-        _firstStep = false;
+Result CoSimServer::ContinueInternal(Connection& connection, SimulationTime simulationTime) {
+    CheckResult(FinishPendingStep(connection));
+    CheckResultWithMessage(connection.protocol->SendContinue(connection.channel->GetWriter(), simulationTime), "Could not send continue frame.");
+    return CreateOk();
+}
+
+Result CoSimServer::StepInternal(Connection& connection, SimulationTime simulationTime, bool deferSend) {
+    connection.stepSequenceNumber++;
+
+    // Without pipelining, the step ok frame of this step follows. Otherwise the one of the previous step, if there is any
+    if (deferSend && (!connection.isPipelined || connection.isStepPending)) {
+        connection.channel->GetWriter().DeferSendUntilRead();
     }
 
-    CheckResultWithMessage(_protocol->SendStep(_channel->GetWriter(), simulationTime, _serializeIoData, _serializeBusMessages), "Could not send step frame.");
-    CheckResultWithMessage(WaitForStepOkFrame(nextSimulationTime, command), "Could not receive step ok frame");
+    CheckResultWithMessage(connection.protocol->SendStep(connection.channel->GetWriter(),
+                                                         connection.stepSequenceNumber,
+                                                         simulationTime,
+                                                         connection.serializeIoData,
+                                                         connection.serializeBusMessages),
+                           "Could not send step frame.");
     return CreateOk();
 }
 
-Result CoSimServer::CloseConnection() {
-    LogWarning("dSPACE VEOS CoSim client disconnected.");
+Result CoSimServer::ReceiveStepOk(Connection& connection, SimulationTime& nextSimulationTime) {
+    Command command{};
+    if (!connection.isPipelined) {
+        CheckResultWithMessage(WaitForStepOkFrame(connection, connection.stepSequenceNumber, nextSimulationTime, command), "Could not receive step ok frame");
+        AddPendingCommand(command);
+        return CreateOk();
+    }
+
+    if (connection.isStepPending) {
+        CheckResultWithMessage(WaitForStepOkFrame(connection, connection.stepSequenceNumber - 1, nextSimulationTime, command),
+                               "Could not receive step ok frame");
+        AddPendingCommand(command);
+    }
+
+    connection.isStepPending = true;
+    return CreateOk();
+}
+
+Result CoSimServer::ReceiveOk(Connection& connection) const {
+    CheckResultWithMessage(WaitForOkFrame(connection), "Could not receive ok frame.");
+    return CreateOk();
+}
+
+Result CoSimServer::FinishPendingStep(Connection& connection) {
+    if (!connection.isStepPending) {
+        return CreateOk();
+    }
+
+    connection.isStepPending = false;
+
+    SimulationTime nextSimulationTime{};
+    Command command{};
+    CheckResultWithMessage(WaitForStepOkFrame(connection, connection.stepSequenceNumber, nextSimulationTime, command), "Could not receive step ok frame");
+    AddPendingCommand(command);
+    return CreateOk();
+}
+
+Result CoSimServer::CloseFailedConnections() {
+    auto firstFailed = std::stable_partition(_connections.begin(), _connections.end(), [](const auto& connection) {
+        return !connection->isFailed;
+    });
+
+    auto failedCount = static_cast<size_t>(std::distance(firstFailed, _connections.end()));
+    if (failedCount == 0) {
+        return CreateOk();
+    }
+
+    std::vector<std::unique_ptr<Connection>> failedConnections(std::make_move_iterator(firstFailed), std::make_move_iterator(_connections.end()));
+    _connections.erase(firstFailed, _connections.end());
+
+    for (auto& connection : failedConnections) {
+        // The state of the session is kept, so the client can continue where it left off
+        if ((connection->sessionToken != 0) && (_simulationState != SimulationState::Unloaded)) {
+            LogWarning("dSPACE VEOS CoSim client disconnected. Waiting up to {} ms for it to resume its session.", _sessionResumeTimeoutInMilliseconds);
+            connection->isFailed = false;
+            connection->isStepPending = false;
+            connection->channel.reset();
+            connection->resumeDeadline = steady_clock::now() + milliseconds(_sessionResumeTimeoutInMilliseconds);
+            _suspendedConnections.push_back(std::move(connection));
+            continue;
+        }
+
+        LogWarning("dSPACE VEOS CoSim client disconnected.");
+        OnConnectionClosed(*connection);
+    }
+
+    return StartAccepting();
+}
 
-    _channel.reset();
+void CoSimServer::OnConnectionClosed(const Connection& connection) {
+    for (auto owner = _signalOwners.begin(); owner != _signalOwners.end();) {
+        owner = owner->second == &connection ? _signalOwners.erase(owner) : std::next(owner);
+    }
 
     if (!_isClientOptional && _callbacks.simulationStoppedCallback) {
         _callbacks.simulationStoppedCallback(SimulationTime{});
     }
+}
 
-    return StartAccepting();
+// Required clients hold the simulation until they resumed their session. Optional ones miss the steps in the meantime,
+// but not a change of the simulation state
+Result CoSimServer::HandleSuspendedConnections(bool isStateChange) {
+    if (_suspendedConnections.empty()) {
+        return CreateOk();
+    }
+
+    if (!_isClientOptional) {
+        return WaitForResumedConnections();
+    }
+
+    ExpireSuspendedConnections(isStateChange);
+    return CreateOk();
 }
 
-Result CoSimServer::Ping(Command& command) {
-    auto start = high_resolution_clock::now();
-    CheckResultWithMessage(_protocol->SendPing(_channel->GetWriter(), _roundTripTime), "Could not send ping frame.");
-    CheckResultWithMessage(WaitForPingOkFrame(command), "Could not receive ping ok frame.");
+Result CoSimServer::WaitForResumedConnections() {
+    LogInfo("Waiting for dSPACE VEOS CoSim client to resume its session ...");
+
+    while (true) {
+        ExpireSuspendedConnections(false);
+        if (_suspendedConnections.empty()) {
+            return CreateOk();
+        }
+
+        Result result = AcceptConnection();
+        if (IsNotConnected(result)) {
+            WaitForConnection();
+            continue;
+        }
+
+        CheckResult(result);
+
+        if (!IsOk(OnHandleConnect(*_connections.back()))) {
+            _connections.back()->isFailed = true;
+            CheckResult(CloseFailedConnections());
+        }
+    }
+}
+
+void CoSimServer::ExpireSuspendedConnections(bool expireAll) {
+    auto now = steady_clock::now();
+    auto firstExpired = std::stable_partition(_suspendedConnections.begin(), _suspendedConnections.end(), [&](const auto& connection) {
+        return !expireAll && (now < connection->resumeDeadline);
+    });
+
+    std::vector<std::unique_ptr<Connection>> expiredConnections(std::make_move_iterator(firstExpired),
+                                                                std::make_move_iterator(_suspendedConnections.end()));
+    _suspendedConnections.erase(firstExpired, _suspendedConnections.end());
+
+    for (const auto& connection : expiredConnections) {
+        LogWarning("dSPACE VEOS CoSim client did not resume its session.");
+        OnConnectionClosed(*connection);
+    }
+}
+
+// Continues a suspended session over the channel of the given connection, which is replaced by the suspended one
+Result CoSimServer::ResumeConnection(Connection& connection, uint64_t sessionToken) {
+    auto search = std::find_if(_suspendedConnections.begin(), _suspendedConnections.end(), [sessionToken](const auto& suspendedConnection) {
+        return suspendedConnection->sessionToken == sessionToken;
+    });
+    if ((search == _suspendedConnections.end()) || (connection.connectionKind != ConnectionKind::Remote)) {
+        LogWarning("dSPACE VEOS CoSim client tried to resume an unknown or expired session.");
+        CheckResultWithMessage(connection.protocol->SendError(connection.channel->GetWriter(), "Session is unknown or expired."),
+                               "Could not send error frame.");
+        return CreateError();
+    }
+
+    std::unique_ptr<Connection> resumedConnection = std::move(*search);
+    _suspendedConnections.erase(search);
+
+    resumedConnection->channel = std::move(connection.channel);
+    resumedConnection->channel->GetWriter().SetMaxFrameSize(GetMaxFrameSize());
+    resumedConnection->channel->GetReader().SetMaxFrameSize(GetMaxFrameSize());
+
+    // Values written in the meantime might have been sent over the broken connection
+    resumedConnection->signalExchange->MarkAllAsChanged();
+
+    auto position = std::find_if(_connections.begin(), _connections.end(), [&connection](const auto& otherConnection) {
+        return otherConnection.get() == &connection;
+    });
+    *position = std::move(resumedConnection);
+
+    Connection& newConnection = **position;
+    CheckResultWithMessage(newConnection.protocol->SendOk(newConnection.channel->GetWriter()), "Could not send ok frame.");
+
+    if (_connections.size() >= _maxClientCount) {
+        StopAccepting();
+    }
+
+    CheckResult(UpdatePollers());
+
+    LogInfo("dSPACE VEOS CoSim client resumed its session.");
+    return CreateOk();
+}
+
+Result CoSimServer::Ping(Connection& connection, bool deferSend) {
+    CheckResult(FinishPendingStep(connection));
+
+    connection.pingStartTime = high_resolution_clock::now();
+    if (deferSend) {
+        connection.channel->GetWriter().DeferSendUntilRead();
+    }
+
+    CheckResultWithMessage(connection.protocol->SendPing(connection.channel->GetWriter(), connection.roundTripTime), "Could not send ping frame.");
+    return CreateOk();
+}
+
+Result CoSimServer::ReceivePingOk(Connection& connection) {
+    Command command{};
+    CheckResultWithMessage(WaitForPingOkFrame(connection, command), "Could not receive ping ok frame.");
     auto stop = high_resolution_clock::now();
-    _roundTripTime = duration_cast<nanoseconds>(stop - start);
+    connection.roundTripTime = duration_cast<nanoseconds>(stop - connection.pingStartTime);
+    AddPendingCommand(command);
     return CreateOk();
 }
 
@@ -394,12 +676,20 @@ Result CoSimServer::StartAccepting() {
         port = _tcpChannelServer->GetLocalPort();
     }
 
-    if (!_localChannelServer) {
+    if (!_localChannelServer && !HasLocalConnection()) {
         CheckResult(CreateLocalChannelServer(_serverName, _localChannelServer));
     }
 
+    if (!_inProcessChannelServer && !_serverName.empty()) {
+        CheckResult(CreateInProcessChannelServer(_serverName, _inProcessChannelServer));
+    }
+
     if (port != 0) {
         if (_registerAtPortMapper) {
+            if (!IsOk(PortRegistrySetPort(_serverName, port))) {
+                LogTrace("Could not set port in port registry.");
+            }
+
             if (!IsOk(PortMapperSetPort(_serverName, port))) {
                 LogTrace("Could not set port in port mapper.");
             }
@@ -410,11 +700,12 @@ Result CoSimServer::StartAccepting() {
         LogInfo("dSPACE VEOS CoSim server '{}' is listening on {}:{}.", _serverName, address, port);
     }
 
-    return CreateOk();
+    return UpdatePollers();
 }
 
 void CoSimServer::StopAccepting() {
     if (_registerAtPortMapper) {
+        (void)PortRegistryUnsetPort(_serverName);
         (void)PortMapperUnsetPort(_serverName);
     }
 
@@ -425,18 +716,85 @@ void CoSimServer::StopAccepting() {
     if (_localChannelServer) {
         _localChannelServer.reset();
     }
+
+    if (_inProcessChannelServer) {
+        _inProcessChannelServer.reset();
+    }
 }
 
-Result CoSimServer::AcceptChannel() {
-    if (_channel) {
+Result CoSimServer::UpdatePollers() {
+#ifndef _WIN32
+    if (!_poller.IsValid()) {
         return CreateOk();
     }
 
+    std::vector<int32_t> fileDescriptors;
+    for (const auto* channelServer : {_localChannelServer.get(), _inProcessChannelServer.get(), _tcpChannelServer.get()}) {
+        if (channelServer) {
+            channelServer->GetFileDescriptors(fileDescriptors);
+        }
+    }
+
+    CheckResult(_acceptPoller.SetFileDescriptors(fileDescriptors));
+
+    fileDescriptors.clear();
+    fileDescriptors.push_back(_acceptPoller.GetFileDescriptor());
+    for (const auto& connection : _connections) {
+        connection->channel->GetFileDescriptors(fileDescriptors);
+    }
+
+    CheckResult(_poller.SetFileDescriptors(fileDescriptors));
+#endif
+
+    return CreateOk();
+}
+
+void CoSimServer::WaitForConnection() const {
+#ifdef _WIN32
+    std::this_thread::sleep_for(milliseconds(1));
+#else
+    (void)_acceptPoller.Wait(ConnectionCheckIntervalInMilliseconds);
+#endif
+}
+
+Result CoSimServer::AcceptConnection() {
+    auto connection = std::make_unique<Connection>();
+    CheckResult(AcceptChannel(connection->channel, connection->connectionKind));
+    CheckResult(CreateProtocol(ProtocolVersion1, connection->protocol));
+
+    connection->callbacks = _callbacks;
+    if (_maxClientCount > 1) {
+        connection->callbacks.incomingSignalChangedCallback =
+            [this, owner = connection.get()](SimulationTime simulationTime, const IoSignal& ioSignal, uint32_t length, const void* value) {
+                _signalOwners[ioSignal.id] = owner;
+                if (_callbacks.incomingSignalChangedCallback) {
+                    _callbacks.incomingSignalChangedCallback(simulationTime, ioSignal, length, value);
+                }
+            };
+    }
+
+    _firstStep = true;
+    _connections.push_back(std::move(connection));
+    return CreateOk();
+}
+
+Result CoSimServer::AcceptChannel(std::unique_ptr<Channel>& channel, ConnectionKind& connectionKind) const {
     if (_localChannelServer) {
-        Result result = _localChannelServer->TryAccept(_channel);
+        Result result = _localChannelServer->TryAccept(channel);
+        if (IsOk(result)) {
+            connectionKind = ConnectionKind::Local;
+            return CreateOk();
+        }
+
+        if (IsError(result)) {
+            return result;
+        }
+    }
+
+    if (_inProcessChannelServer) {
+        Result result = _inProcessChannelServer->TryAccept(channel);
         if (IsOk(result)) {
-            _connectionKind = ConnectionKind::Local;
-            _firstStep = true;
+            connectionKind = ConnectionKind::InProcess;
             return CreateOk();
         }
 
@@ -446,9 +804,8 @@ Result CoSimServer::AcceptChannel() {
     }
 
     if (_tcpChannelServer) {
-        CheckResult(_tcpChannelServer->TryAccept(_channel));
-        _connectionKind = ConnectionKind::Remote;
-        _firstStep = true;
+        CheckResult(_tcpChannelServer->TryAccept(channel));
+        connectionKind = ConnectionKind::Remote;
         return CreateOk();
     }
 
@@ -456,11 +813,22 @@ Result CoSimServer::AcceptChannel() {
     return CreateError();
 }
 
-Result CoSimServer::OnHandleConnect() {
+Result CoSimServer::OnHandleConnect(Connection& connection) {
     uint32_t clientProtocolVersion{};
     std::string clientName;
     uint32_t coSimProtocolVersion = ProtocolVersion1;
-    CheckResultWithMessage(WaitForConnectFrame(clientProtocolVersion, clientName), "Could not receive connect frame.");
+    uint64_t sessionToken{};
+    CheckResultWithMessage(WaitForConnectFrame(connection, clientProtocolVersion, clientName, sessionToken), "Could not receive connect frame.");
+
+    // The connection is gone afterward
+    if (sessionToken != 0) {
+        return ResumeConnection(connection, sessionToken);
+    }
+
+    // A new client replaces the ones, which might resume their sessions later
+    if (_connections.size() + _suspendedConnections.size() > _maxClientCount) {
+        ExpireSuspendedConnections(true);
+    }
 
     if (clientProtocolVersion >= ProtocolVersionLatest) {
         coSimProtocolVersion = ProtocolVersionLatest;
@@ -468,52 +836,116 @@ Result CoSimServer::OnHandleConnect() {
         coSimProtocolVersion = clientProtocolVersion;
     }
 
-    if (_protocol->GetVersion() != coSimProtocolVersion) {
-        CheckResult(CreateProtocol(coSimProtocolVersion, _protocol));
+    if (connection.protocol->GetVersion() != coSimProtocolVersion) {
+        CheckResult(CreateProtocol(coSimProtocolVersion, connection.protocol));
+    }
+
+    uint32_t maxFrameSize = GetMaxFrameSize();
+    if (coSimProtocolVersion >= ProtocolVersion6) {
+        // The catalog follows in its own frame
+        CheckResultWithMessage(connection.protocol->SendConnectOk(connection.channel->GetWriter(),
+                                                                  coSimProtocolVersion,
+                                                                  {},
+                                                                  _stepSize,
+                                                                  _simulationState,
+                                                                  {},
+                                                                  {},
+                                                                  {},
+                                                                  {},
+                                                                  {},
+                                                                  {},
+                                                                  maxFrameSize),
+                               "Could not send connect ok frame.");
+    } else {
+        CheckResultWithMessage(connection.protocol->SendConnectOk(connection.channel->GetWriter(),
+                                                                  coSimProtocolVersion,
+                                                                  {},
+                                                                  _stepSize,
+                                                                  _simulationState,
+                                                                  _incomingSignals,
+                                                                  _outgoingSignals,
+                                                                  _canControllers,
+                                                                  _ethControllers,
+                                                                  _linControllers,
+                                                                  _frControllers,
+                                                                  maxFrameSize),
+                               "Could not send connect ok frame.");
+    }
+
+    connection.sessionToken = 0;
+    if (coSimProtocolVersion >= ProtocolVersion5) {
+        // Only remote connections can break while both sides keep running
+        if ((connection.connectionKind == ConnectionKind::Remote) && (_sessionResumeTimeoutInMilliseconds > 0)) {
+            connection.sessionToken = CreateSessionToken();
+        }
+
+        CheckResultWithMessage(connection.protocol->SendSession(connection.channel->GetWriter(), connection.sessionToken, _sessionResumeTimeoutInMilliseconds),
+                               "Could not send session frame.");
+    }
+
+    // Older clients only understand frames up to the default size
+    if ((connection.connectionKind == ConnectionKind::Remote) && (coSimProtocolVersion >= ProtocolVersion3)) {
+        connection.channel->GetWriter().SetMaxFrameSize(maxFrameSize);
+        connection.channel->GetReader().SetMaxFrameSize(maxFrameSize);
+    }
+
+    if (coSimProtocolVersion >= ProtocolVersion6) {
+        CheckResultWithMessage(SendCatalog(connection), "Could not send catalog.");
     }
 
-    CheckResultWithMessage(_protocol->SendConnectOk(_channel->GetWriter(),
-                                                    coSimProtocolVersion,
-                                                    {},
-                                                    _stepSize,
-                                                    _simulationState,
-                                                    _incomingSignals,
-                                                    _outgoingSignals,
-                                                    _canControllers,
-                                                    _ethControllers,
-                                                    _linControllers,
-                                                    _frControllers),
-                           "Could not send connect ok frame.");
+    // Local connections share the signal values in memory, so the next step must not be sent before the client finished
+    connection.isPipelined =
+        _enablePipelinedStepping && (connection.connectionKind != ConnectionKind::Local) && (coSimProtocolVersion >= ProtocolVersion4);
+    connection.isStepPending = false;
+    connection.stepSequenceNumber = 0;
 
     std::vector<IoSignal> incomingSignalsExtern = Convert(_incomingSignals);
     std::vector<IoSignal> outgoingSignalsExtern = Convert(_outgoingSignals);
-    CheckResult(
-        CreateSignalExchange(CoSimType::Server, _connectionKind, _serverName, incomingSignalsExtern, outgoingSignalsExtern, *_protocol, _signalExchange));
+    CheckResult(CreateSignalExchange(CoSimType::Server,
+                                     connection.connectionKind,
+                                     _serverName,
+                                     incomingSignalsExtern,
+                                     outgoingSignalsExtern,
+                                     *connection.protocol,
+                                     connection.signalExchange));
 
     std::vector<CanController> canControllersExtern = Convert(_canControllers);
     std::vector<EthController> ethControllersExtern = Convert(_ethControllers);
     std::vector<LinController> linControllersExtern = Convert(_linControllers);
     std::vector<FrController> frControllersExtern = Convert(_frControllers);
     CheckResult(CreateBusExchange(CoSimType::Server,
-                                  _connectionKind,
+                                  connection.connectionKind,
                                   _serverName,
                                   canControllersExtern,
                                   ethControllersExtern,
                                   linControllersExtern,
                                   frControllersExtern,
-                                  *_protocol,
-                                  _busExchange));
+                                  *connection.protocol,
+                                  connection.busExchange));
 
-    StopAccepting();
+    if (_connections.size() >= _maxClientCount) {
+        StopAccepting();
+    } else if (connection.connectionKind == ConnectionKind::Local) {
+        // The shared memory of a local connection is named after the server, so there can only be one
+        _localChannelServer.reset();
+    }
+
+    CheckResult(UpdatePollers());
 
-    if (_connectionKind == ConnectionKind::Remote) {
+    if (connection.connectionKind == ConnectionKind::Remote) {
         std::string remoteAddress;
-        CheckResult(_channel->GetRemoteAddress(remoteAddress));
+        CheckResult(connection.channel->GetRemoteAddress(remoteAddress));
         if (clientName.empty()) {
             LogInfo("dSPACE VEOS CoSim client at {} connected.", remoteAddress);
         } else {
             LogInfo("dSPACE VEOS CoSim client '{}' at {} connected.", clientName, remoteAddress);
         }
+    } else if (connection.connectionKind == ConnectionKind::InProcess) {
+        if (clientName.empty()) {
+            LogInfo("In-process dSPACE VEOS CoSim client connected.");
+        } else {
+            LogInfo("In-process dSPACE VEOS CoSim client '{}' connected.", clientName);
+        }
     } else {
         if (clientName.empty()) {
             LogInfo("Local dSPACE VEOS CoSim client connected.");
@@ -525,74 +957,149 @@ Result CoSimServer::OnHandleConnect() {
     return CreateOk();
 }
 
-Result CoSimServer::WaitForOkFrame() const {
+Result CoSimServer::SendCatalog(const Connection& connection) const {
+    uint64_t cachedCatalogHash{};
+    CheckResultWithMessage(WaitForGetCatalogFrame(connection, cachedCatalogHash), "Could not receive get catalog frame.");
+
+    // The client already holds the catalog, so only the hash is sent
+    if (cachedCatalogHash == _catalogHash) {
+        CheckResultWithMessage(connection.protocol->SendCatalog(connection.channel->GetWriter(), _catalogHash, {}), "Could not send catalog frame.");
+        return CreateOk();
+    }
+
+    CheckResultWithMessage(connection.protocol->SendCatalog(connection.channel->GetWriter(), _catalogHash, _catalog), "Could not send catalog frame.");
+    return CreateOk();
+}
+
+bool CoSimServer::HasLocalConnection() const {
+    return std::any_of(_connections.begin(), _connections.end(), [](const auto& connection) {
+        return connection->connectionKind == ConnectionKind::Local;
+    });
+}
+
+Result CoSimServer::WaitForOkFrame(const Connection& connection) const {
     FrameKind frameKind{};
-    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+    CheckResult(connection.protocol->ReceiveHeader(connection.channel->GetReader(), frameKind));
 
     switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
         case FrameKind::Ok:
-            CheckResultWithMessage(_protocol->ReadOk(_channel->GetReader()), "Could not read ok frame.");
+            CheckResultWithMessage(connection.protocol->ReadOk(connection.channel->GetReader()), "Could not read ok frame.");
             return CreateOk();
         case FrameKind::Error:
-            return OnError();
+            return OnError(connection);
         default:
             return OnUnexpectedFrame(frameKind);
     }
 }
 
-Result CoSimServer::WaitForPingOkFrame(Command& command) const {
+Result CoSimServer::WaitForPingOkFrame(const Connection& connection, Command& command) const {
     FrameKind frameKind{};
-    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+    CheckResult(connection.protocol->ReceiveHeader(connection.channel->GetReader(), frameKind));
 
     switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
         case FrameKind::PingOk:
-            CheckResultWithMessage(_protocol->ReadPingOk(_channel->GetReader(), command), "Could not read ping ok frame.");
+            CheckResultWithMessage(connection.protocol->ReadPingOk(connection.channel->GetReader(), command), "Could not read ping ok frame.");
             return CreateOk();
         default:
             return OnUnexpectedFrame(frameKind);
     }
 }
 
-Result CoSimServer::WaitForConnectFrame(uint32_t& version, std::string& clientName) const {
+Result CoSimServer::WaitForGetCatalogFrame(const Connection& connection, uint64_t& cachedCatalogHash) const {
     FrameKind frameKind{};
-    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+    CheckResult(connection.protocol->ReceiveHeader(connection.channel->GetReader(), frameKind));
+
+    switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
+        case FrameKind::GetCatalog:
+            CheckResultWithMessage(connection.protocol->ReadGetCatalog(connection.channel->GetReader(), cachedCatalogHash),
+                                   "Could not read get catalog frame.");
+            return CreateOk();
+        default:
+            return OnUnexpectedFrame(frameKind);
+    }
+}
+
+Result CoSimServer::WaitForConnectFrame(const Connection& connection, uint32_t& version, std::string& clientName, uint64_t& sessionToken) const {
+    FrameKind frameKind{};
+    CheckResult(connection.protocol->ReceiveHeader(connection.channel->GetReader(), frameKind));
 
     switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
         case FrameKind::Connect: {
             Mode mode{};
             std::string serverName;
-            CheckResultWithMessage(_protocol->ReadConnect(_channel->GetReader(), version, mode, serverName, clientName), "Could not read connect frame.");
+            CheckResultWithMessage(connection.protocol->ReadConnect(connection.channel->GetReader(), version, mode, serverName, clientName),
+                                   "Could not read connect frame.");
+            sessionToken = 0;
             return CreateOk();
         }
+        case FrameKind::Resume:
+            CheckResultWithMessage(connection.protocol->ReadResume(connection.channel->GetReader(), sessionToken), "Could not read resume frame.");
+            if (sessionToken == 0) {
+                LogError("Protocol error. Received resume frame without session token.");
+                return CreateError();
+            }
+
+            return CreateOk();
         default:
             return OnUnexpectedFrame(frameKind);
     }
 }
 
-Result CoSimServer::WaitForStepOkFrame(SimulationTime& simulationTime, Command& command) const {
+Result CoSimServer::WaitForStepOkFrame(const Connection& connection, uint32_t sequenceNumber, SimulationTime& simulationTime, Command& command) const {
     FrameKind frameKind{};
-    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+    CheckResult(connection.protocol->ReceiveHeader(connection.channel->GetReader(), frameKind));
 
     switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
-        case FrameKind::StepOk:
-            CheckResultWithMessage(
-                _protocol->ReadStepOk(_channel->GetReader(), simulationTime, command, _deserializeIoData, _deserializeBusMessages, _callbacks),
-                "Could not receive step ok frame.");
+        case FrameKind::StepOk: {
+            uint32_t receivedSequenceNumber{};
+            CheckResultWithMessage(connection.protocol->ReadStepOk(connection.channel->GetReader(),
+                                                                   receivedSequenceNumber,
+                                                                   simulationTime,
+                                                                   command,
+                                                                   connection.deserializeIoData,
+                                                                   connection.deserializeBusMessages,
+                                                                   connection.callbacks),
+                                   "Could not receive step ok frame.");
+            if ((connection.protocol->GetVersion() >= ProtocolVersion4) && (receivedSequenceNumber != sequenceNumber)) {
+                LogError("Protocol error. Expected step ok frame for step {}, but received the one for step {}.", sequenceNumber, receivedSequenceNumber);
+                return CreateError();
+            }
+
             return CreateOk();
+        }
         case FrameKind::Error:
-            return OnError();
+            return OnError(connection);
         default:
             return OnUnexpectedFrame(frameKind);
     }
 }
 
-Result CoSimServer::OnError() const {
+Result CoSimServer::OnError(const Connection& connection) const {
     std::string errorMessage;
-    CheckResultWithMessage(_protocol->ReadError(_channel->GetReader(), errorMessage), "Could not read error frame.");
+    CheckResultWithMessage(connection.protocol->ReadError(connection.channel->GetReader(), errorMessage), "Could not read error frame.");
     LogError(errorMessage);
     return CreateError();
 }
 
+void CoSimServer::AddPendingCommand(Command command) {
+    if (command != Command::None) {
+        _pendingCommands.push_back(command);
+    }
+}
+
+void CoSimServer::HandlePendingCommands() {
+    if (_pendingCommands.empty()) {
+        return;
+    }
+
+    // The callbacks might call back into the server
+    std::vector<Command> commands = std::move(_pendingCommands);
+    _pendingCommands.clear();
+    for (Command command : commands) {
+        HandlePendingCommand(command);
+    }
+}
+
 void CoSimServer::HandlePendingCommand(Command command) const {
     switch (command) {
         case Command::Start:
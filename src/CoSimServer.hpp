@@ -2,14 +2,17 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "BusExchange.hpp"
 #include "Channel.hpp"
 #include "CoSimTypes.hpp"
+#include "Poller.hpp"
 #include "PortMapper.hpp"
 #include "Protocol.hpp"
 #include "Result.hpp"
@@ -24,6 +27,15 @@ struct CoSimServerConfig {
     bool isClientOptional{};
     bool startPortMapper{};
     bool registerAtPortMapper = true;
+    // Sends the next step before the client finished the previous one. The outputs of the client are applied one step later.
+    // Only used for connections that transfer the data within the frames and for clients supporting protocol version 4
+    bool enablePipelinedStepping{};
+    // Number of clients, that can be connected at the same time. All of them receive the outgoing signals and bus messages.
+    // Only one of them can be connected locally, since the shared memory is named after the server
+    uint32_t maxClientCount = 1;
+    // Time a remote client, that lost its connection, has to resume its session. Signal values and bus messages are kept in
+    // the meantime. 0 disables it. Needs protocol version 5 on both sides
+    uint32_t sessionResumeTimeoutInMilliseconds{};
     SimulationTime stepSize{};
     SimulationCallback simulationStartedCallback;
     SimulationCallback simulationStoppedCallback;
@@ -82,55 +94,119 @@ public:
 
     [[nodiscard]] Result GetLocalPort(uint16_t& port) const;
 
+    // File descriptor, which becomes readable when a client connects or a connected client sends data or disconnects.
+    // BackgroundService should be called then. Only available on Linux
+    [[nodiscard]] Result GetWaitHandle(int32_t& fileDescriptor) const;
+
 private:
-    [[nodiscard]] Result StartInternal(SimulationTime simulationTime);
-    [[nodiscard]] Result StopInternal(SimulationTime simulationTime);
-    [[nodiscard]] Result TerminateInternal(SimulationTime simulationTime, TerminateReason reason);
-    [[nodiscard]] Result PauseInternal(SimulationTime simulationTime);
-    [[nodiscard]] Result ContinueInternal(SimulationTime simulationTime);
-    [[nodiscard]] Result StepInternal(SimulationTime simulationTime, SimulationTime& nextSimulationTime, Command& command);
-    [[nodiscard]] Result CloseConnection();
-    [[nodiscard]] Result Ping(Command& command);
+    struct Connection {
+        Connection();
+        ~Connection() noexcept = default;
+
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        Connection(Connection&&) = delete;
+        Connection& operator=(Connection&&) = delete;
+
+        std::unique_ptr<Channel> channel;
+        std::unique_ptr<IProtocol> protocol;
+        ConnectionKind connectionKind = ConnectionKind::Remote;
+        std::unique_ptr<SignalExchange> signalExchange;
+        std::unique_ptr<BusExchange> busExchange;
+        Callbacks callbacks{};
+        SerializeFunction serializeIoData;
+        SerializeFunction serializeBusMessages;
+        DeserializeFunction deserializeIoData;
+        DeserializeFunction deserializeBusMessages;
+        SimulationTime roundTripTime{};
+        std::chrono::high_resolution_clock::time_point pingStartTime{};
+        bool isPipelined{};
+        bool isStepPending{};
+        uint32_t stepSequenceNumber{};
+        bool isFailed{};
+        uint64_t sessionToken{};
+        std::chrono::steady_clock::time_point resumeDeadline{};
+    };
+
+    template <typename SendFunction, typename ReceiveFunction>
+    [[nodiscard]] Result ForEachConnection(const SendFunction& send, const ReceiveFunction& receive);
+
+    // Includes the connections waiting for their client to resume the session
+    template <typename Function>
+    [[nodiscard]] Result ForEachSession(const Function& function) const;
+
+    [[nodiscard]] Result StartInternal(Connection& connection, SimulationTime simulationTime);
+    [[nodiscard]] Result StopInternal(Connection& connection, SimulationTime simulationTime);
+    [[nodiscard]] Result TerminateInternal(Connection& connection, SimulationTime simulationTime, TerminateReason reason);
+    [[nodiscard]] Result PauseInternal(Connection& connection, SimulationTime simulationTime);
+    [[nodiscard]] Result ContinueInternal(Connection& connection, SimulationTime simulationTime);
+    [[nodiscard]] Result StepInternal(Connection& connection, SimulationTime simulationTime, bool deferSend);
+    [[nodiscard]] Result ReceiveStepOk(Connection& connection, SimulationTime& nextSimulationTime);
+    [[nodiscard]] Result ReceiveOk(Connection& connection) const;
+    [[nodiscard]] Result Ping(Connection& connection, bool deferSend);
+    [[nodiscard]] Result ReceivePingOk(Connection& connection);
+    [[nodiscard]] Result FinishPendingStep(Connection& connection);
+    [[nodiscard]] Result CloseFailedConnections();
+    void OnConnectionClosed(const Connection& connection);
+    [[nodiscard]] Result HandleSuspendedConnections(bool isStateChange);
+    [[nodiscard]] Result WaitForResumedConnections();
+    void ExpireSuspendedConnections(bool expireAll);
+    [[nodiscard]] Result ResumeConnection(Connection& connection, uint64_t sessionToken);
     [[nodiscard]] Result StartAccepting();
     void StopAccepting();
-    [[nodiscard]] Result AcceptChannel();
-    [[nodiscard]] Result OnHandleConnect();
-    [[nodiscard]] Result WaitForOkFrame() const;
-    [[nodiscard]] Result WaitForPingOkFrame(Command& command) const;
-    [[nodiscard]] Result WaitForConnectFrame(uint32_t& version, std::string& clientName) const;
-    [[nodiscard]] Result WaitForStepOkFrame(SimulationTime& simulationTime, Command& command) const;
-    [[nodiscard]] Result OnError() const;
+    [[nodiscard]] Result UpdatePollers();
+    void WaitForConnection() const;
+    [[nodiscard]] Result AcceptConnection();
+    [[nodiscard]] Result AcceptChannel(std::unique_ptr<Channel>& channel, ConnectionKind& connectionKind) const;
+    [[nodiscard]] Result OnHandleConnect(Connection& connection);
+    [[nodiscard]] Result SendCatalog(const Connection& connection) const;
+    [[nodiscard]] bool HasLocalConnection() const;
+    [[nodiscard]] Result WaitForOkFrame(const Connection& connection) const;
+    [[nodiscard]] Result WaitForPingOkFrame(const Connection& connection, Command& command) const;
+    [[nodiscard]] Result WaitForGetCatalogFrame(const Connection& connection, uint64_t& cachedCatalogHash) const;
+    [[nodiscard]] Result WaitForConnectFrame(const Connection& connection, uint32_t& version, std::string& clientName, uint64_t& sessionToken) const;
+    [[nodiscard]] Result WaitForStepOkFrame(const Connection& connection, uint32_t sequenceNumber, SimulationTime& simulationTime, Command& command) const;
+    [[nodiscard]] Result OnError(const Connection& connection) const;
+    void AddPendingCommand(Command command);
+    void HandlePendingCommands();
     void HandlePendingCommand(Command command) const;
     [[nodiscard]] static Result OnUnexpectedFrame(FrameKind frameKind);
 
-    std::unique_ptr<Channel> _channel;
-    std::unique_ptr<IProtocol> _protocol;
+    std::vector<std::unique_ptr<Connection>> _connections;
+    std::vector<std::unique_ptr<Connection>> _suspendedConnections;
+    uint32_t _maxClientCount = 1;
+    uint32_t _sessionResumeTimeoutInMilliseconds{};
+    // Client, which most recently sent a value of the incoming signal. Only tracked with more than one client
+    std::unordered_map<IoSignalId, const Connection*> _signalOwners;
+    std::vector<Command> _pendingCommands;
     uint16_t _localPort{};
     bool _enableRemoteAccess{};
     std::unique_ptr<PortMapperServer> _portMapperServer;
     std::unique_ptr<ChannelServer> _tcpChannelServer;
     std::unique_ptr<ChannelServer> _localChannelServer;
-    ConnectionKind _connectionKind = ConnectionKind::Remote;
+    std::unique_ptr<ChannelServer> _inProcessChannelServer;
+#ifndef _WIN32
+    // Watches the listeners. It is part of the other poller, which also watches the connected clients
+    Poller _acceptPoller;
+    Poller _poller;
+#endif
     std::string _serverName;
     Callbacks _callbacks{};
     bool _isClientOptional{};
     SimulationTime _stepSize{};
     SimulationState _simulationState{};
     bool _registerAtPortMapper{};
-    SimulationTime _roundTripTime{};
     bool _firstStep{true};
+    bool _enablePipelinedStepping{};
     std::vector<IoSignalContainer> _incomingSignals;
     std::vector<IoSignalContainer> _outgoingSignals;
     std::vector<CanControllerContainer> _canControllers;
     std::vector<EthControllerContainer> _ethControllers;
     std::vector<LinControllerContainer> _linControllers;
     std::vector<FrControllerContainer> _frControllers;
-    std::unique_ptr<SignalExchange> _signalExchange;
-    std::unique_ptr<BusExchange> _busExchange;
-    SerializeFunction _serializeIoData;
-    SerializeFunction _serializeBusMessages;
-    DeserializeFunction _deserializeIoData;
-    DeserializeFunction _deserializeBusMessages;
+    std::vector<uint8_t> _catalog;
+    uint64_t _catalogHash{};
 };
 
 }  // namespace DsVeosCoSim
@@ -34,6 +34,7 @@ constexpr uint32_t EthAddressLength = 6U;
 enum class TerminateReason : uint32_t;
 
 struct IoSignal;
+struct IncomingSignalChange;
 struct CanController;
 struct CanMessage;
 struct CanMessageContainer;
@@ -65,6 +66,17 @@ using LinMessageContainerReceivedCallback =
 using FrMessageContainerReceivedCallback =
     std::function<void(SimulationTime simulationTime, const FrController& frController, const FrMessageContainer& frMessageContainer)>;
 
+// Batch callbacks are called once per step with everything received in that step
+using IncomingSignalsChangedCallback = std::function<void(SimulationTime simulationTime, const IncomingSignalChange* changes, uint32_t count)>;
+using CanMessageContainersReceivedCallback =
+    std::function<void(SimulationTime simulationTime, const CanMessageContainer* canMessageContainers, uint32_t count)>;
+using EthMessageContainersReceivedCallback =
+    std::function<void(SimulationTime simulationTime, const EthMessageContainer* ethMessageContainers, uint32_t count)>;
+using LinMessageContainersReceivedCallback =
+    std::function<void(SimulationTime simulationTime, const LinMessageContainer* linMessageContainers, uint32_t count)>;
+using FrMessageContainersReceivedCallback =
+    std::function<void(SimulationTime simulationTime, const FrMessageContainer* frMessageContainers, uint32_t count)>;
+
 enum class CoSimType : uint32_t {
     Client,
     Server
@@ -83,7 +95,8 @@ enum class CoSimType : uint32_t {
 
 enum class ConnectionKind : uint32_t {
     Remote,
-    Local
+    Local,
+    InProcess
 };
 
 [[nodiscard]] constexpr std::string_view format_as(ConnectionKind connectionKind) noexcept {
@@ -92,6 +105,8 @@ enum class ConnectionKind : uint32_t {
             return "Remote";
         case ConnectionKind::Local:
             return "Local";
+        case ConnectionKind::InProcess:
+            return "InProcess";
     }
 
     return "<Invalid ConnectionKind>";
@@ -201,6 +216,11 @@ enum class Mode : uint32_t {
 enum class IoSignalId : uint32_t {
 };
 
+// Dense index of a signal within the incoming or outgoing signals. Avoids the id lookup on every read and write. Handles of
+// the written signals have the highest bit set, so that they are rejected for reads and vice versa
+enum class IoSignalHandle : uint32_t {
+};
+
 enum class DataType : uint32_t {
     Bool = 1,
     Int8,
@@ -355,7 +375,17 @@ enum class FrameKind : uint32_t {
     GetPort,
     GetPortOk,
     SetPort,
-    UnsetPort
+    UnsetPort,
+
+    GetPorts,
+    GetPortsOk,
+    SetPorts,
+
+    Session,
+    Resume,
+
+    GetCatalog,
+    Catalog
 };
 
 [[nodiscard]] constexpr std::string_view format_as(FrameKind frameKind) noexcept {
@@ -394,6 +424,20 @@ enum class FrameKind : uint32_t {
             return "SetPort";
         case FrameKind::UnsetPort:
             return "UnsetPort";
+        case FrameKind::GetPorts:
+            return "GetPorts";
+        case FrameKind::GetPortsOk:
+            return "GetPortsOk";
+        case FrameKind::SetPorts:
+            return "SetPorts";
+        case FrameKind::Session:
+            return "Session";
+        case FrameKind::Resume:
+            return "Resume";
+        case FrameKind::GetCatalog:
+            return "GetCatalog";
+        case FrameKind::Catalog:
+            return "Catalog";
     }
 
     return "<Invalid FrameKind>";
@@ -416,6 +460,12 @@ struct Callbacks {
     LinMessageContainerReceivedCallback linMessageContainerReceivedCallback;
     EthMessageContainerReceivedCallback ethMessageContainerReceivedCallback;
     FrMessageContainerReceivedCallback frMessageContainerReceivedCallback;
+    // Take precedence over the corresponding per signal or per message callbacks
+    IncomingSignalsChangedCallback incomingSignalsChangedCallback;
+    CanMessageContainersReceivedCallback canMessageContainersReceivedCallback;
+    EthMessageContainersReceivedCallback ethMessageContainersReceivedCallback;
+    LinMessageContainersReceivedCallback linMessageContainersReceivedCallback;
+    FrMessageContainersReceivedCallback frMessageContainersReceivedCallback;
 };
 
 struct ConnectConfig {
@@ -424,6 +474,8 @@ struct ConnectConfig {
     std::string clientName;
     uint16_t remotePort{};
     uint16_t localPort{};
+    // Connects to a server with the given serverName running in the same process
+    bool useInProcessChannel{};
 };
 
 struct IoSignal {
@@ -434,6 +486,26 @@ struct IoSignal {
     const char* name{};
 };
 
+struct IncomingSignalChange {
+    const IoSignal* signal{};
+    uint32_t length{};
+    const void* value{};
+};
+
+// Reads the value of an incoming signal into the given buffer. Used to read several signals at once
+struct IncomingSignalValue {
+    IoSignalHandle signalHandle{};
+    uint32_t length{};
+    void* value{};
+};
+
+// Used to write several outgoing signals at once
+struct OutgoingSignalValue {
+    IoSignalHandle signalHandle{};
+    uint32_t length{};
+    const void* value{};
+};
+
 struct IoSignalContainer {
     IoSignalId id{};
     uint32_t length{};
@@ -3,12 +3,12 @@
 #pragma once
 
 #include <algorithm>
-#include <array>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Logger.hpp"
 #include "Result.hpp"
@@ -17,6 +17,11 @@ namespace DsVeosCoSim {
 
 constexpr int32_t HeaderSize = 4;
 constexpr int32_t BufferSize = 65536;
+constexpr int32_t MaxFrameSizeLimit = 0x40000000;
+
+[[nodiscard]] inline int32_t ClampFrameSize(uint32_t frameSize) {
+    return static_cast<int32_t>(std::clamp(frameSize, static_cast<uint32_t>(BufferSize), static_cast<uint32_t>(MaxFrameSizeLimit)));
+}
 
 template <typename TValue>
 void WriteScalarToBuffer(uint8_t* destination, TValue value) {
@@ -99,16 +104,14 @@ public:
     ChannelWriter(ChannelWriter&&) = delete;
     ChannelWriter& operator=(ChannelWriter&&) = delete;
 
+    // Frames may grow up to this size. Both sides of a channel have to agree on it, so it is only raised after negotiation
+    void SetMaxFrameSize(uint32_t maxFrameSize) {
+        _maxFrameSize = ClampFrameSize(maxFrameSize);
+    }
+
     [[nodiscard]] Result Reserve(size_t size, BlockWriter& blockWriter) {
         auto sizeToReserve = static_cast<int32_t>(size);
-        if (BufferSize - _writeIndex < sizeToReserve) {
-            CheckResult(EndWrite());
-
-            if (BufferSize - _writeIndex < sizeToReserve) {
-                LogError("No more space available.");
-                return CreateError();
-            }
-        }
+        CheckResult(EnsureSpace(sizeToReserve));
 
         blockWriter = BlockWriter(&_writeBuffer[static_cast<size_t>(_writeIndex)], size);
         _writeIndex += sizeToReserve;
@@ -118,14 +121,7 @@ public:
     template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
     [[nodiscard]] Result Write(T value) {
         auto size = static_cast<int32_t>(sizeof(value));
-        if (BufferSize - _writeIndex < size) {
-            CheckResult(EndWrite());
-
-            if (BufferSize - _writeIndex < size) {
-                LogError("No more space available.");
-                return CreateError();
-            }
-        }
+        CheckResult(EnsureSpace(size));
 
         WriteScalarToBuffer(&_writeBuffer[static_cast<size_t>(_writeIndex)], value);
         _writeIndex += size;
@@ -137,12 +133,24 @@ public:
         auto sizeToCopy = static_cast<int32_t>(size);
 
         while (sizeToCopy > 0) {
-            if (BufferSize == _writeIndex) {
+            if (_maxFrameSize == _writeIndex) {
                 CheckResult(EndWrite());
                 continue;
             }
 
-            int32_t sizeOfChunkToCopy = std::min(sizeToCopy, BufferSize - _writeIndex);
+            // Data that does not fit into the current frame anymore is handed over without copying, if the channel supports it
+            if (sizeToCopy > _maxFrameSize - _writeIndex) {
+                size_t sentSize{};
+                CheckResult(SendWithData(bufferPointer, static_cast<size_t>(sizeToCopy), sentSize));
+                if (sentSize > 0) {
+                    bufferPointer += sentSize;
+                    sizeToCopy -= static_cast<int32_t>(sentSize);
+                    continue;
+                }
+            }
+
+            int32_t sizeOfChunkToCopy = std::min(sizeToCopy, _maxFrameSize - _writeIndex);
+            GrowWriteBuffer(_writeIndex + sizeOfChunkToCopy);
             memcpy(&_writeBuffer[static_cast<size_t>(_writeIndex)], bufferPointer, static_cast<size_t>(sizeOfChunkToCopy));
             _writeIndex += sizeOfChunkToCopy;
             bufferPointer += sizeOfChunkToCopy;
@@ -160,17 +168,59 @@ public:
 
     [[nodiscard]] virtual Result EndWrite() = 0;
 
+    // Allows the channel to hold back the frames finished until the next read and to hand them over together with that read.
+    // Only call this, if a read on the same channel follows
+    virtual void DeferSendUntilRead() {
+    }
+
 protected:
     [[nodiscard]] virtual Result Send(const uint8_t* buffer, size_t size) = 0;
 
+    // Sends the pending frame followed by the leading part of the data. sentSize receives the count of bytes taken from data.
+    // The remaining bytes are copied into the write buffer as usual.
+    [[nodiscard]] virtual Result SendWithData([[maybe_unused]] const uint8_t* data, [[maybe_unused]] size_t size, size_t& sentSize) {
+        sentSize = 0;
+        return CreateOk();
+    }
+
     int32_t _writeIndex = HeaderSize;
-    std::array<uint8_t, BufferSize> _writeBuffer{};
+    int32_t _maxFrameSize = BufferSize;
+    std::vector<uint8_t> _writeBuffer = std::vector<uint8_t>(BufferSize);
+
+private:
+    [[nodiscard]] Result EnsureSpace(int32_t size) {
+        if (_maxFrameSize - _writeIndex < size) {
+            CheckResult(EndWrite());
+
+            if (_maxFrameSize - _writeIndex < size) {
+                LogError("No more space available.");
+                return CreateError();
+            }
+        }
+
+        GrowWriteBuffer(_writeIndex + size);
+        return CreateOk();
+    }
+
+    // The buffer keeps its size afterwards, so it settles at the size of the largest frame
+    void GrowWriteBuffer(int32_t requiredSize) {
+        size_t newSize = _writeBuffer.size();
+        if (static_cast<size_t>(requiredSize) <= newSize) {
+            return;
+        }
+
+        while (newSize < static_cast<size_t>(requiredSize)) {
+            newSize *= 2;
+        }
+
+        _writeBuffer.resize(std::min(newSize, static_cast<size_t>(_maxFrameSize)));
+    }
 };
 
 class BlockReader final {
 public:
     BlockReader() = default;
-    BlockReader(uint8_t* data, size_t size) : _data(data), _size(size) {
+    BlockReader(const uint8_t* data, size_t size) : _data(data), _size(size) {
     }
 
     ~BlockReader() noexcept = default;
@@ -219,10 +269,15 @@ public:
     }
 
 private:
-    uint8_t* _data{};
+    const uint8_t* _data{};
     size_t _size{};
 };
 
+struct ChannelReaderStatistics {
+    uint64_t frameCount{};
+    uint64_t receiveCount{};
+};
+
 class ChannelReader {
 protected:
     ChannelReader() = default;
@@ -236,6 +291,11 @@ public:
     ChannelReader(ChannelReader&&) = delete;
     ChannelReader& operator=(ChannelReader&&) = delete;
 
+    // Frames up to this size are accepted. The read buffer grows on demand
+    void SetMaxFrameSize(uint32_t maxFrameSize) {
+        _maxFrameSize = ClampFrameSize(maxFrameSize);
+    }
+
     [[nodiscard]] Result ReadBlock(size_t size, BlockReader& blockReader) {
         auto blockSize = static_cast<int32_t>(size);
         while (_endFrameIndex - _readIndex < blockSize) {
@@ -287,6 +347,10 @@ public:
 
     virtual void EndRead() const = 0;
 
+    [[nodiscard]] const ChannelReaderStatistics& GetStatistics() const {
+        return _statistics;
+    }
+
     [[nodiscard]] Result WaitForData(uint32_t timeoutInMilliseconds) {
         if (_writeIndex > _endFrameIndex) {
             return CreateOk();
@@ -295,72 +359,107 @@ public:
         return WaitForDataInternal(timeoutInMilliseconds);
     }
 
+    // Receives the data, which is available without blocking. Returns Ok, if the next frame is complete then, and Timeout
+    // otherwise. Lets a thread, which serves several channels, skip a counterpart that sent only part of a frame. The
+    // previous frame must have been read completely
+    [[nodiscard]] virtual Result TryReceiveFrame() {
+        int32_t frameStart{};
+        int32_t frameSize{};
+        Result result = ReceiveFrame(true, frameStart, frameSize);
+
+        // The next read starts at the beginning of the frame
+        _readIndex = frameStart;
+        _endFrameIndex = frameStart;
+        return result;
+    }
+
 protected:
     [[nodiscard]] virtual Result WaitForDataInternal(uint32_t timeoutInMilliseconds) = 0;
     [[nodiscard]] virtual Result Receive(void* destination, size_t size, size_t& receivedSize) = 0;
 
+    // Frames are parsed in place. Bytes of following frames, which arrived together with the current one, stay where they are.
+    // Every receive requests the whole free space of the buffer, so one call usually drains everything the peer has sent so far
     [[nodiscard]] virtual Result BeginRead() {
-        uint8_t* buffer = _readBuffer.data();
-
-        _readIndex = HeaderSize;
-        int32_t sizeToRead = _defaultSizeToRead;
-        bool readHeader = true;
+        int32_t frameStart{};
+        int32_t frameSize{};
+        CheckResult(ReceiveFrame(false, frameStart, frameSize));
+
+        _readIndex = frameStart + HeaderSize;
+        _endFrameIndex = frameStart + frameSize;
+        _lastFrameSize = frameSize;
+        _statistics.frameCount++;
+        return CreateOk();
+    }
 
-        // Did we read more than one frame the last time?
-        if (_writeIndex > _endFrameIndex) {
-            int32_t bytesToMove = _writeIndex - _endFrameIndex;
-            memmove(buffer, &buffer[static_cast<size_t>(_endFrameIndex)], static_cast<size_t>(bytesToMove));
+    // Receives until the frame following the previous one is complete. Without blocking, only the data, which is available
+    // already, is received and Timeout is returned, if the frame is still incomplete then
+    [[nodiscard]] Result ReceiveFrame(bool nonBlocking, int32_t& frameStart, int32_t& frameSize) {
+        frameStart = _endFrameIndex;
+        if (_writeIndex <= frameStart) {
+            frameStart = 0;
+            _writeIndex = 0;
+        }
 
-            _writeIndex = bytesToMove;
+        frameSize = 0;
+        while (true) {
+            int32_t availableSize = _writeIndex - frameStart;
+            if ((frameSize == 0) && (availableSize >= HeaderSize)) {
+                ReadScalarFromBuffer(&_readBuffer[static_cast<size_t>(frameStart)], frameSize);
+                if ((frameSize < HeaderSize) || (frameSize > _maxFrameSize)) {
+                    LogError("Protocol error. The buffer size is too small.");
+                    return CreateError();
+                }
+            }
 
-            // Did we read at least HeaderSize bytes more?
-            if (bytesToMove >= HeaderSize) {
-                readHeader = false;
-                ReadScalarFromBuffer(buffer, _endFrameIndex);
+            if ((frameSize > 0) && (availableSize >= frameSize)) {
+                break;
+            }
 
-                // Did we read at least an entire second frame?
-                if (_writeIndex >= _endFrameIndex) {
-                    return CreateOk();
+            // The previous frame sizes are the best guess for the size of an unknown frame
+            int32_t requiredSize = frameSize > 0 ? frameSize : std::max(_lastFrameSize, _defaultSizeToRead);
+            if (frameStart + requiredSize > static_cast<int32_t>(_readBuffer.size())) {
+                GrowReadBuffer(requiredSize);
+                if (frameStart + requiredSize > static_cast<int32_t>(_readBuffer.size())) {
+                    memmove(_readBuffer.data(), &_readBuffer[static_cast<size_t>(frameStart)], static_cast<size_t>(availableSize));
+                    frameStart = 0;
+                    _writeIndex = availableSize;
                 }
+            }
 
-                sizeToRead = _endFrameIndex - _writeIndex;
+            if (nonBlocking) {
+                CheckResult(WaitForDataInternal(0));
             }
-        } else {
-            _writeIndex = 0;
-        }
 
-        while (sizeToRead > 0) {
             size_t receivedSize{};
-            CheckResult(Receive(&buffer[static_cast<size_t>(_writeIndex)], static_cast<size_t>(sizeToRead), receivedSize));
-
-            sizeToRead -= static_cast<int32_t>(receivedSize);
+            CheckResult(Receive(&_readBuffer[static_cast<size_t>(_writeIndex)], _readBuffer.size() - static_cast<size_t>(_writeIndex), receivedSize));
+            _statistics.receiveCount++;
             _writeIndex += static_cast<int32_t>(receivedSize);
+        }
 
-            if (readHeader && (_writeIndex >= HeaderSize)) {
-                readHeader = false;
-                ReadScalarFromBuffer(buffer, _endFrameIndex);
-
-                if (_endFrameIndex > BufferSize) {
-                    LogError("Protocol error. The buffer size is too small.");
-                    return CreateError();
-                }
+        return CreateOk();
+    }
 
-                if (_writeIndex >= _endFrameIndex) {
-                    return CreateOk();
-                }
+    void GrowReadBuffer(int32_t requiredSize) {
+        size_t newSize = _readBuffer.size();
+        if (static_cast<size_t>(requiredSize) <= newSize) {
+            return;
+        }
 
-                sizeToRead = _endFrameIndex - _writeIndex;
-            }
+        while (newSize < static_cast<size_t>(requiredSize)) {
+            newSize *= 2;
         }
 
-        return CreateOk();
+        _readBuffer.resize(std::min(newSize, static_cast<size_t>(_maxFrameSize)));
     }
 
     int32_t _defaultSizeToRead{};
     int32_t _readIndex{};
     int32_t _endFrameIndex{};
     int32_t _writeIndex{};
-    std::array<uint8_t, BufferSize> _readBuffer{};
+    int32_t _lastFrameSize{};
+    int32_t _maxFrameSize = BufferSize;
+    std::vector<uint8_t> _readBuffer = std::vector<uint8_t>(BufferSize);
+    ChannelReaderStatistics _statistics{};
 };
 
 class Channel {
@@ -382,6 +481,13 @@ public:
 
     [[nodiscard]] virtual ChannelWriter& GetWriter() = 0;
     [[nodiscard]] virtual ChannelReader& GetReader() = 0;
+
+#ifndef _WIN32
+    // Adds the file descriptors, which become readable on incoming data or on a disconnect. Channels, which do not read
+    // from a file descriptor, only signal them from then on
+    virtual void GetFileDescriptors([[maybe_unused]] std::vector<int32_t>& fileDescriptors) {
+    }
+#endif
 };
 
 class ChannelServer {
@@ -400,6 +506,12 @@ public:
     [[nodiscard]] virtual uint16_t GetLocalPort() const = 0;
 
     [[nodiscard]] virtual Result TryAccept(std::unique_ptr<Channel>& channel) = 0;
+
+#ifndef _WIN32
+    // Adds the file descriptors, which become readable when a client tries to connect
+    virtual void GetFileDescriptors([[maybe_unused]] std::vector<int32_t>& fileDescriptors) const {
+    }
+#endif
 };
 
 [[nodiscard]] Result TryConnectToTcpChannel(const std::string& remoteIpAddress,
@@ -413,4 +525,7 @@ public:
 [[nodiscard]] Result TryConnectToLocalChannel(const std::string& name, std::unique_ptr<Channel>& channel);
 [[nodiscard]] Result CreateLocalChannelServer(const std::string& name, std::unique_ptr<ChannelServer>& server);
 
+[[nodiscard]] Result TryConnectToInProcessChannel(const std::string& name, std::unique_ptr<Channel>& channel);
+[[nodiscard]] Result CreateInProcessChannelServer(const std::string& name, std::unique_ptr<ChannelServer>& server);
+
 }  // namespace DsVeosCoSim
@@ -0,0 +1,612 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/eventfd.h>
+
+#include <unistd.h>
+#endif
+
+#include "Channel.hpp"
+#include "Environment.hpp"
+#include "Logger.hpp"
+#include "OsUtilities.hpp"
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+namespace {
+
+constexpr uint32_t FrameQueueCapacity = 16;
+constexpr size_t CacheLineSize = 64;
+
+}  // namespace
+
+// Single producer single consumer queue of complete frames. The buffers are swapped in and out, so a frame is never copied.
+// The reader gets back the buffer of the previous frame, which the writer picks up again for a later frame
+class FrameQueue final {  // NOLINT(misc-use-internal-linkage)
+public:
+    FrameQueue() = default;
+
+    ~FrameQueue() noexcept {
+#ifndef _WIN32
+        int32_t wakeFd = _wakeFd.load(std::memory_order_acquire);
+        if (wakeFd >= 0) {
+            close(wakeFd);
+        }
+#endif
+    }
+
+    FrameQueue(const FrameQueue&) = delete;
+    FrameQueue& operator=(const FrameQueue&) = delete;
+
+    FrameQueue(FrameQueue&&) = delete;
+    FrameQueue& operator=(FrameQueue&&) = delete;
+
+    [[nodiscard]] bool HasSpace() const {
+        return _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_acquire) < FrameQueueCapacity;
+    }
+
+    [[nodiscard]] bool HasFrame() const {
+        return _tail.load(std::memory_order_acquire) != _head.load(std::memory_order_relaxed);
+    }
+
+    void Push(std::vector<uint8_t>& buffer, int32_t frameSize) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        Slot& slot = _slots[tail % FrameQueueCapacity];
+        slot.buffer.swap(buffer);
+        slot.frameSize = frameSize;
+        _tail.store(tail + 1, std::memory_order_release);
+    }
+
+    [[nodiscard]] int32_t Pop(std::vector<uint8_t>& buffer) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        Slot& slot = _slots[head % FrameQueueCapacity];
+        buffer.swap(slot.buffer);
+        int32_t frameSize = slot.frameSize;
+        _head.store(head + 1, std::memory_order_release);
+        return frameSize;
+    }
+
+#ifndef _WIN32
+    // Created on demand for a reader, which waits on a file descriptor. While the reader does not read, the writer signals
+    // new frames through it besides the condition variable
+    [[nodiscard]] Result CreateWakeFd(int32_t& wakeFd) {
+        wakeFd = _wakeFd.load(std::memory_order_relaxed);
+        if (wakeFd >= 0) {
+            return CreateOk();
+        }
+
+        // Blocking, since the reader only drains it after it has been signaled
+        wakeFd = eventfd(0, EFD_CLOEXEC);
+        if (wakeFd < 0) {
+            LogError(errno, "Could not create event file descriptor.");
+            return CreateError();
+        }
+
+        _wakeFd.store(wakeFd, std::memory_order_release);
+        return CreateOk();
+    }
+
+    [[nodiscard]] int32_t GetWakeFd() const {
+        return _wakeFd.load(std::memory_order_relaxed);
+    }
+
+    // Called by the reader when it stops reading. Returns true, if a frame is available already, since the writer might not
+    // have signaled it then
+    [[nodiscard]] bool RequestWake() {
+        _isWakePending.store(false, std::memory_order_relaxed);
+        _isWakeRequested.store(true, std::memory_order_relaxed);
+
+        // Pairs with the fence in SignalWake, so that either the writer sees the request or the reader sees the frame
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return HasFrame();
+    }
+
+    [[nodiscard]] bool IsWakePending() const {
+        return _isWakePending.load(std::memory_order_acquire);
+    }
+
+    void CancelWake() {
+        if (_isWakeRequested.load(std::memory_order_relaxed)) {
+            _isWakeRequested.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // Called by the writer after pushing a frame and by the reader for frames, which are left over when it stops reading
+    void SignalWake() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // A reader, which consumed the frames already, does not need to be woken up
+        if (_isWakeRequested.load(std::memory_order_relaxed) && HasFrame() && !_isWakePending.exchange(true, std::memory_order_acq_rel)) {
+            Wake();
+        }
+    }
+
+    void Wake() const {
+        int32_t wakeFd = _wakeFd.load(std::memory_order_acquire);
+        if (wakeFd >= 0) {
+            (void)eventfd_write(wakeFd, 1);
+        }
+    }
+#endif
+
+private:
+    struct Slot {
+        std::vector<uint8_t> buffer;
+        int32_t frameSize{};
+    };
+
+    std::array<Slot, FrameQueueCapacity> _slots{};
+    alignas(CacheLineSize) std::atomic<uint32_t> _head{};
+    alignas(CacheLineSize) std::atomic<uint32_t> _tail{};
+#ifndef _WIN32
+    std::atomic<int32_t> _wakeFd{-1};
+    std::atomic<bool> _isWakeRequested{};
+    std::atomic<bool> _isWakePending{};
+#endif
+};
+
+// Shared by both ends of an in-process connection. Waiting threads spin first and only block, if the counterpart is slow
+class InProcessPipe final {  // NOLINT(misc-use-internal-linkage)
+public:
+    InProcessPipe() : _spinCount(GetSpinCount()) {
+    }
+
+    ~InProcessPipe() noexcept = default;
+
+    InProcessPipe(const InProcessPipe&) = delete;
+    InProcessPipe& operator=(const InProcessPipe&) = delete;
+
+    InProcessPipe(InProcessPipe&&) = delete;
+    InProcessPipe& operator=(InProcessPipe&&) = delete;
+
+    [[nodiscard]] FrameQueue& GetQueue(bool isServer, bool isWriter) {
+        return isServer == isWriter ? _serverToClient : _clientToServer;
+    }
+
+    [[nodiscard]] bool IsDisconnected() const {
+        return _isDisconnected.load(std::memory_order_acquire);
+    }
+
+    void Disconnect() {
+        _isDisconnected.store(true, std::memory_order_release);
+#ifndef _WIN32
+        _clientToServer.Wake();
+        _serverToClient.Wake();
+#endif
+
+        std::scoped_lock lock(_mutex);
+        _conditionVariable.notify_all();
+    }
+
+    void Notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiterCount.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        std::scoped_lock lock(_mutex);
+        _conditionVariable.notify_all();
+    }
+
+    template <typename Predicate>
+    [[nodiscard]] Result Wait(Predicate&& predicate, uint32_t timeoutInMilliseconds) {
+        auto isDone = [this, &predicate] {
+            return predicate() || IsDisconnected();
+        };
+
+        // Fast path
+        if (!SpinWait(isDone, _spinCount)) {
+            // Slow path
+            _waiterCount.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::unique_lock lock(_mutex);
+            if (timeoutInMilliseconds == Infinite) {
+                _conditionVariable.wait(lock, isDone);
+            } else {
+                (void)_conditionVariable.wait_for(lock, std::chrono::milliseconds(timeoutInMilliseconds), isDone);
+            }
+
+            _waiterCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // Frames, which arrived before the disconnect, can still be read
+        if (predicate()) {
+            return CreateOk();
+        }
+
+        return IsDisconnected() ? CreateNotConnected() : CreateTimeout();
+    }
+
+private:
+    FrameQueue _clientToServer;
+    FrameQueue _serverToClient;
+    std::atomic<bool> _isDisconnected{};
+    std::atomic<uint32_t> _waiterCount{};
+    std::mutex _mutex;
+    std::condition_variable _conditionVariable;
+    uint32_t _spinCount{};
+};
+
+class InProcessChannelWriter final : public ChannelWriter {  // NOLINT(misc-use-internal-linkage)
+public:
+    InProcessChannelWriter(InProcessPipe& pipe, FrameQueue& queue) : _pipe(pipe), _queue(queue) {
+    }
+
+    ~InProcessChannelWriter() noexcept override = default;
+
+    InProcessChannelWriter(const InProcessChannelWriter&) = delete;
+    InProcessChannelWriter& operator=(const InProcessChannelWriter&) = delete;
+
+    InProcessChannelWriter(InProcessChannelWriter&&) = delete;
+    InProcessChannelWriter& operator=(InProcessChannelWriter&&) = delete;
+
+    [[nodiscard]] Result EndWrite() override {
+        if (_pipe.IsDisconnected()) {
+            return CreateNotConnected();
+        }
+
+        WriteScalarToBuffer(_writeBuffer.data(), _writeIndex);
+
+        CheckResult(_pipe.Wait(
+            [this] {
+                return _queue.HasSpace();
+            },
+            Infinite));
+
+        _queue.Push(_writeBuffer, _writeIndex);
+        _pipe.Notify();
+#ifndef _WIN32
+        _queue.SignalWake();
+#endif
+
+        // The buffer handed back by the reader might not have been allocated yet
+        if (_writeBuffer.size() < static_cast<size_t>(BufferSize)) {
+            _writeBuffer.resize(BufferSize);
+        }
+
+        _writeIndex = HeaderSize;
+        return CreateOk();
+    }
+
+protected:
+    [[nodiscard]] Result Send([[maybe_unused]] const uint8_t* buffer, [[maybe_unused]] size_t size) override {
+        // Frames are handed over as a whole in EndWrite
+        LogError("Sending raw data is not supported by in-process channels.");
+        return CreateError();
+    }
+
+private:
+    InProcessPipe& _pipe;
+    FrameQueue& _queue;
+};
+
+class InProcessChannelReader final : public ChannelReader {  // NOLINT(misc-use-internal-linkage)
+public:
+    InProcessChannelReader(InProcessPipe& pipe, FrameQueue& queue) : _pipe(pipe), _queue(queue) {
+    }
+
+    ~InProcessChannelReader() noexcept override = default;
+
+    InProcessChannelReader(const InProcessChannelReader&) = delete;
+    InProcessChannelReader& operator=(const InProcessChannelReader&) = delete;
+
+    InProcessChannelReader(InProcessChannelReader&&) = delete;
+    InProcessChannelReader& operator=(InProcessChannelReader&&) = delete;
+
+    void EndRead() const override {
+        if (_readIndex != _endFrameIndex) {
+            // Runtime safety check that remains active in release builds
+            throw std::runtime_error("Not all data has been read.");
+        }
+
+#ifndef _WIN32
+        StopReading();
+#endif
+    }
+
+#ifndef _WIN32
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) {
+        bool isNew = _queue.GetWakeFd() < 0;
+        int32_t wakeFd{};
+        if (!IsOk(_queue.CreateWakeFd(wakeFd))) {
+            return;
+        }
+
+        if (isNew) {
+            StopReading();
+        }
+
+        fileDescriptors.push_back(wakeFd);
+    }
+#endif
+
+    [[nodiscard]] Result TryReceiveFrame() override {
+        // Frames are queued as a whole
+        return WaitForDataInternal(0);
+    }
+
+protected:
+    [[nodiscard]] Result WaitForDataInternal(uint32_t timeoutInMilliseconds) override {
+        return _pipe.Wait(
+            [this] {
+                return _queue.HasFrame();
+            },
+            timeoutInMilliseconds);
+    }
+
+    [[nodiscard]] Result Receive([[maybe_unused]] void* destination, [[maybe_unused]] size_t size, [[maybe_unused]] size_t& receivedSize) override {
+        // Frames are handed over as a whole in BeginRead
+        LogError("Receiving raw data is not supported by in-process channels.");
+        return CreateError();
+    }
+
+    [[nodiscard]] Result BeginRead() override {
+#ifndef _WIN32
+        // The writer does not need to signal frames, which are read anyway
+        _queue.CancelWake();
+#endif
+
+        CheckResult(WaitForDataInternal(Infinite));
+
+        int32_t frameSize = _queue.Pop(_readBuffer);
+        _pipe.Notify();
+
+        _readIndex = HeaderSize;
+        _endFrameIndex = frameSize;
+        _writeIndex = frameSize;
+        _statistics.frameCount++;
+        return CreateOk();
+    }
+
+private:
+#ifndef _WIN32
+    void StopReading() const {
+        int32_t wakeFd = _queue.GetWakeFd();
+        if (wakeFd < 0) {
+            return;
+        }
+
+        // The signaling side writes right after setting the pending flag, so this returns immediately
+        if (_queue.IsWakePending()) {
+            eventfd_t value{};
+            (void)eventfd_read(wakeFd, &value);
+        }
+
+        if (_queue.RequestWake()) {
+            _queue.SignalWake();
+        } else if (_pipe.IsDisconnected()) {
+            _queue.Wake();
+        }
+    }
+#endif
+
+    InProcessPipe& _pipe;
+    FrameQueue& _queue;
+};
+
+class InProcessChannel final : public Channel {  // NOLINT(misc-use-internal-linkage)
+public:
+    InProcessChannel(std::shared_ptr<InProcessPipe> pipe, bool isServer)
+        : _pipe(std::move(pipe)),
+          _writer(*_pipe, _pipe->GetQueue(isServer, true)),
+          _reader(*_pipe, _pipe->GetQueue(isServer, false)) {
+    }
+
+    ~InProcessChannel() noexcept override {
+        _pipe->Disconnect();
+    }
+
+    InProcessChannel(const InProcessChannel&) = delete;
+    InProcessChannel& operator=(const InProcessChannel&) = delete;
+
+    InProcessChannel(InProcessChannel&&) = delete;
+    InProcessChannel& operator=(InProcessChannel&&) = delete;
+
+    [[nodiscard]] Result GetRemoteAddress(std::string& remoteAddress) const override {
+        remoteAddress.clear();
+        return CreateOk();
+    }
+
+    void Disconnect() override {
+        _pipe->Disconnect();
+    }
+
+    [[nodiscard]] ChannelWriter& GetWriter() override {
+        return _writer;
+    }
+
+    [[nodiscard]] ChannelReader& GetReader() override {
+        return _reader;
+    }
+
+#ifndef _WIN32
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) override {
+        _reader.GetFileDescriptors(fileDescriptors);
+    }
+#endif
+
+private:
+    std::shared_ptr<InProcessPipe> _pipe;
+
+    InProcessChannelWriter _writer;
+    InProcessChannelReader _reader;
+};
+
+namespace {
+
+// Connections, which have been established by clients but not yet accepted by the server with the same name
+class InProcessRegistry final {
+public:
+    [[nodiscard]] Result Add(const std::string& name, int32_t notificationFd) {
+        std::scoped_lock lock(_mutex);
+        auto [search, isInserted] = _entries.try_emplace(name);
+        if (!isInserted) {
+            LogError("In-process dSPACE VEOS CoSim server '{}' already exists.", name);
+            return CreateError();
+        }
+
+        search->second.notificationFd = notificationFd;
+        return CreateOk();
+    }
+
+    void Remove(const std::string& name) {
+        std::scoped_lock lock(_mutex);
+        auto search = _entries.find(name);
+        if (search == _entries.end()) {
+            return;
+        }
+
+        for (const auto& pipe : search->second.pendingPipes) {
+            pipe->Disconnect();
+        }
+
+        _entries.erase(search);
+    }
+
+    [[nodiscard]] Result Connect(const std::string& name, std::shared_ptr<InProcessPipe>& pipe) {
+        std::scoped_lock lock(_mutex);
+        auto search = _entries.find(name);
+        if (search == _entries.end()) {
+            return CreateNotConnected();
+        }
+
+        pipe = std::make_shared<InProcessPipe>();
+        search->second.pendingPipes.push_back(pipe);
+
+#ifndef _WIN32
+        if (search->second.notificationFd >= 0) {
+            (void)eventfd_write(search->second.notificationFd, 1);
+        }
+#endif
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result TryAccept(const std::string& name, std::shared_ptr<InProcessPipe>& pipe) {
+        std::scoped_lock lock(_mutex);
+        auto search = _entries.find(name);
+        if ((search == _entries.end()) || search->second.pendingPipes.empty()) {
+            return CreateNotConnected();
+        }
+
+        pipe = std::move(search->second.pendingPipes.front());
+        search->second.pendingPipes.pop_front();
+
+#ifndef _WIN32
+        // The notification stays readable as long as connections are pending
+        if (search->second.pendingPipes.empty() && (search->second.notificationFd >= 0)) {
+            eventfd_t value{};
+            (void)eventfd_read(search->second.notificationFd, &value);
+        }
+#endif
+
+        return CreateOk();
+    }
+
+private:
+    struct Entry {
+        std::deque<std::shared_ptr<InProcessPipe>> pendingPipes;
+        int32_t notificationFd = -1;
+    };
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+};
+
+[[nodiscard]] InProcessRegistry& GetInProcessRegistry() {
+    static InProcessRegistry registry;
+    return registry;
+}
+
+}  // namespace
+
+class InProcessChannelServer final : public ChannelServer {  // NOLINT(misc-use-internal-linkage)
+public:
+    InProcessChannelServer(std::string name, int32_t notificationFd) : _name(std::move(name)), _notificationFd(notificationFd) {
+    }
+
+    ~InProcessChannelServer() noexcept override {
+        GetInProcessRegistry().Remove(_name);
+
+#ifndef _WIN32
+        if (_notificationFd >= 0) {
+            close(_notificationFd);
+        }
+#endif
+    }
+
+    InProcessChannelServer(const InProcessChannelServer&) = delete;
+    InProcessChannelServer& operator=(const InProcessChannelServer&) = delete;
+
+    InProcessChannelServer(InProcessChannelServer&&) = delete;
+    InProcessChannelServer& operator=(InProcessChannelServer&&) = delete;
+
+    [[nodiscard]] uint16_t GetLocalPort() const override {
+        return 0;
+    }
+
+    [[nodiscard]] Result TryAccept(std::unique_ptr<Channel>& channel) override {
+        std::shared_ptr<InProcessPipe> pipe;
+        CheckResult(GetInProcessRegistry().TryAccept(_name, pipe));
+        channel = std::make_unique<InProcessChannel>(std::move(pipe), true);
+        return CreateOk();
+    }
+
+#ifndef _WIN32
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) const override {
+        if (_notificationFd >= 0) {
+            fileDescriptors.push_back(_notificationFd);
+        }
+    }
+#endif
+
+private:
+    std::string _name;
+    int32_t _notificationFd = -1;
+};
+
+[[nodiscard]] Result TryConnectToInProcessChannel(const std::string& name, std::unique_ptr<Channel>& channel) {
+    std::shared_ptr<InProcessPipe> pipe;
+    CheckResult(GetInProcessRegistry().Connect(name, pipe));
+    channel = std::make_unique<InProcessChannel>(std::move(pipe), false);
+    return CreateOk();
+}
+
+[[nodiscard]] Result CreateInProcessChannelServer(const std::string& name, std::unique_ptr<ChannelServer>& server) {
+    int32_t notificationFd = -1;
+#ifndef _WIN32
+    notificationFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (notificationFd < 0) {
+        LogError(errno, "Could not create event file descriptor.");
+        return CreateError();
+    }
+#endif
+
+    if (!IsOk(GetInProcessRegistry().Add(name, notificationFd))) {
+#ifndef _WIN32
+        close(notificationFd);
+#endif
+        return CreateError();
+    }
+
+    server = std::make_unique<InProcessChannelServer>(name, notificationFd);
+    return CreateOk();
+}
+
+}  // namespace DsVeosCoSim
@@ -1,23 +1,58 @@
 // Copyright dSPACE SE & Co. KG. All rights reserved.
 
-#ifdef _WIN32
-
+#include <cerrno>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/eventfd.h>
+
+#include <unistd.h>
+#endif
 
 #include "Channel.hpp"
+#include "Logger.hpp"
 #include "OsUtilities.hpp"
 #include "Result.hpp"
+#include "Socket.hpp"
 
 namespace DsVeosCoSim {
 
+namespace {
+
+constexpr uint32_t WakeSocketTimeoutInMilliseconds = 1000;
+
+#ifndef _WIN32
+
+// Clients connect to this local socket after they registered in the shared memory, so a waiting server wakes up right away.
+// The client then sends the index of its pipe and keeps the socket connected as wake socket of the connection. It becomes
+// readable on a disconnect and on new data, while the counterpart does not read
+[[nodiscard]] std::string GetConnectNotificationName(const std::string& name) {
+    return name + ".Connect";
+}
+
+void SignalWake(const ShmPipeClient& client, const SocketClient& wakeSocket) {
+    if (wakeSocket.IsConnected() && client.TrySetWakePending()) {
+        uint8_t wake = 1;
+        (void)wakeSocket.Send(&wake, sizeof(wake));
+    }
+}
+
+#endif
+
+}  // namespace
+
 class LocalChannelWriter final : public ChannelWriter {  // NOLINT(misc-use-internal-linkage)
 public:
-    explicit LocalChannelWriter(ShmPipeClient& client) : _client(client) {
+    LocalChannelWriter(ShmPipeClient& client, SocketClient& wakeSocket) : _client(client), _wakeSocket(wakeSocket) {
         // The local channel does not include the length of the frame
         _writeIndex = 0;
     }
@@ -32,6 +67,9 @@ public:
 
     [[nodiscard]] Result EndWrite() override {
         CheckResult(Send(_writeBuffer.data(), static_cast<size_t>(_writeIndex)));
+#ifndef _WIN32
+        SignalWake(_client, _wakeSocket);
+#endif
 
         _writeIndex = 0;
         return CreateOk();
@@ -42,17 +80,37 @@ protected:
         return _client.Send(buffer, size);
     }
 
+    [[nodiscard]] Result SendWithData(const uint8_t* data, size_t size, size_t& sentSize) override {
+        // The pipe has no frame boundaries, so the data can be written in one go
+        CheckResult(Send(_writeBuffer.data(), static_cast<size_t>(_writeIndex)));
+        CheckResult(Send(data, size));
+#ifndef _WIN32
+        SignalWake(_client, _wakeSocket);
+#endif
+
+        _writeIndex = 0;
+        sentSize = size;
+        return CreateOk();
+    }
+
 private:
     ShmPipeClient& _client;
+    SocketClient& _wakeSocket;
 };
 
 class LocalChannelReader final : public ChannelReader {  // NOLINT(misc-use-internal-linkage)
 public:
-    explicit LocalChannelReader(ShmPipeClient& client) : _client(client) {
+    LocalChannelReader(ShmPipeClient& client, SocketClient& wakeSocket) : _client(client), _wakeSocket(wakeSocket) {
         _defaultSizeToRead = ShmPipePart::PipeBufferSize;
     }
 
-    ~LocalChannelReader() noexcept override = default;
+    ~LocalChannelReader() noexcept override {
+#ifndef _WIN32
+        if (_wakeFd >= 0) {
+            close(_wakeFd);
+        }
+#endif
+    }
 
     LocalChannelReader(const LocalChannelReader&) = delete;
     LocalChannelReader& operator=(const LocalChannelReader&) = delete;
@@ -62,10 +120,46 @@ public:
 
     void EndRead() const override {
         // The local channel does not include the length of the frame
+#ifndef _WIN32
+        StopReading();
+#endif
+    }
+
+#ifndef _WIN32
+    // While this side does not read, the counterpart signals new data through the wake socket. Data, which is left over
+    // when this side stops reading, is signaled through the own event file descriptor
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) {
+        if (!_wakeSocket.IsConnected()) {
+            return;
+        }
+
+        if (_wakeFd < 0) {
+            _wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (_wakeFd < 0) {
+                LogError(errno, "Could not create event file descriptor.");
+                return;
+            }
+
+            StopReading();
+        }
+
+        fileDescriptors.push_back(_wakeSocket.GetHandle().Get());
+        fileDescriptors.push_back(_wakeFd);
+    }
+#endif
+
+    [[nodiscard]] Result TryReceiveFrame() override {
+        // The pipe has no frame boundaries. Since the writer sends every frame in one go, available data is the best guess
+        return WaitForDataInternal(0);
     }
 
 protected:
     [[nodiscard]] Result WaitForDataInternal(uint32_t timeoutInMilliseconds) override {
+        // A previous receive might already have fetched the next frame (see BeginRead)
+        if (_endFrameIndex > _readIndex) {
+            return CreateOk();
+        }
+
         return _client.WaitForData(timeoutInMilliseconds);
     }
 
@@ -91,20 +185,53 @@ protected:
 
         auto maxSizeToRead = static_cast<uint32_t>(BufferSize - unreadSize);
 
+#ifndef _WIN32
+        // The counterpart does not need to signal data, which is read anyway
+        _client.CancelWake();
+#endif
+
         size_t receivedSize{};
         CheckResult(Receive(&_readBuffer[static_cast<size_t>(writeIndex)], maxSizeToRead, receivedSize));
+        _statistics.receiveCount++;
 
         writeIndex += static_cast<int32_t>(receivedSize);
         return CreateOk();
     }
 
 private:
+#ifndef _WIN32
+    void StopReading() const {
+        if (_wakeFd < 0) {
+            return;
+        }
+
+        // The counterpart sends exactly one byte after setting the pending flag, which might still be on its way
+        if (_client.IsWakePending()) {
+            uint8_t wake{};
+            size_t receivedSize{};
+            (void)_wakeSocket.Receive(&wake, sizeof(wake), receivedSize);
+        }
+
+        eventfd_t value{};
+        (void)eventfd_read(_wakeFd, &value);
+
+        if (_client.RequestWake() || (_endFrameIndex > _readIndex)) {
+            (void)eventfd_write(_wakeFd, 1);
+        }
+    }
+#endif
+
     ShmPipeClient& _client;
+    SocketClient& _wakeSocket;
+#ifndef _WIN32
+    int32_t _wakeFd = -1;
+#endif
 };
 
 class LocalChannel final : public Channel {  // NOLINT(misc-use-internal-linkage)
 public:
-    explicit LocalChannel(ShmPipeClient client) : _client(std::move(client)), _writer(_client), _reader(_client) {
+    LocalChannel(ShmPipeClient client, SocketClient wakeSocket)
+        : _client(std::move(client)), _wakeSocket(std::move(wakeSocket)), _writer(_client, _wakeSocket), _reader(_client, _wakeSocket) {
     }
 
     ~LocalChannel() noexcept override = default;
@@ -122,6 +249,7 @@ public:
 
     void Disconnect() override {
         _client.Disconnect();
+        _wakeSocket.Disconnect();
     }
 
     [[nodiscard]] ChannelWriter& GetWriter() override {
@@ -132,8 +260,15 @@ public:
         return _reader;
     }
 
+#ifndef _WIN32
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) override {
+        _reader.GetFileDescriptors(fileDescriptors);
+    }
+#endif
+
 private:
     ShmPipeClient _client;
+    SocketClient _wakeSocket;
 
     LocalChannelWriter _writer;
     LocalChannelReader _reader;
@@ -141,7 +276,8 @@ private:
 
 class LocalChannelServer final : public ChannelServer {  // NOLINT(misc-use-internal-linkage)
 public:
-    explicit LocalChannelServer(ShmPipeListener listener) : _listener(std::move(listener)) {
+    LocalChannelServer(ShmPipeListener listener, SocketListener connectNotificationListener)
+        : _listener(std::move(listener)), _connectNotificationListener(std::move(connectNotificationListener)) {
     }
 
     ~LocalChannelServer() noexcept override = default;
@@ -157,30 +293,104 @@ public:
     }
 
     [[nodiscard]] Result TryAccept(std::unique_ptr<Channel>& channel) override {
+        // A notification always follows the registration, so draining them first cannot lose a client
+        AcceptWakeSockets();
+
         ShmPipeClient client;
         CheckResult(_listener.TryAccept(client));
-        channel = std::make_unique<LocalChannel>(std::move(client));
+
+        SocketClient wakeSocket;
+        TakeWakeSocket(client.GetIndex(), wakeSocket);
+        channel = std::make_unique<LocalChannel>(std::move(client), std::move(wakeSocket));
         return CreateOk();
     }
 
+#ifndef _WIN32
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) const override {
+        if (_connectNotificationListener.IsRunning()) {
+            fileDescriptors.push_back(_connectNotificationListener.GetHandle().Get());
+        }
+    }
+#endif
+
 private:
+    void AcceptWakeSockets() {
+        while (_connectNotificationListener.IsRunning()) {
+            SocketClient wakeSocket;
+            if (!IsOk(_connectNotificationListener.TryAccept(wakeSocket))) {
+                break;
+            }
+
+            uint32_t index{};
+            size_t receivedSize{};
+            if (IsOk(wakeSocket.WaitForData(WakeSocketTimeoutInMilliseconds)) && IsOk(wakeSocket.Receive(&index, sizeof(index), receivedSize)) &&
+                (receivedSize == sizeof(index))) {
+                _pendingWakeSockets[index] = std::move(wakeSocket);
+            }
+        }
+    }
+
+    void TakeWakeSocket(uint32_t index, SocketClient& wakeSocket) {
+        if (!_connectNotificationListener.IsRunning()) {
+            return;
+        }
+
+        // The client connects its wake socket right after the registration, which might have been seen first
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(WakeSocketTimeoutInMilliseconds);
+        auto search = _pendingWakeSockets.find(index);
+        while ((search == _pendingWakeSockets.end()) && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            AcceptWakeSockets();
+            search = _pendingWakeSockets.find(index);
+        }
+
+        if (search == _pendingWakeSockets.end()) {
+            LogTrace("Local dSPACE VEOS CoSim client did not connect its wake socket.");
+            return;
+        }
+
+        wakeSocket = std::move(search->second);
+        _pendingWakeSockets.erase(search);
+    }
+
     ShmPipeListener _listener;
+    SocketListener _connectNotificationListener;
+    std::unordered_map<uint32_t, SocketClient> _pendingWakeSockets;
 };
 
 [[nodiscard]] Result TryConnectToLocalChannel(const std::string& name, std::unique_ptr<Channel>& channel) {
     ShmPipeClient client{};
     CheckResult(ShmPipeClient::TryConnect(name, client));
-    channel = std::make_unique<LocalChannel>(std::move(client));
+
+    SocketClient wakeSocket;
+#ifndef _WIN32
+    // Servers of older versions do not listen for the notification
+    if (IsOk(SocketClient::TryConnect(GetConnectNotificationName(name), wakeSocket))) {
+        uint32_t index = client.GetIndex();
+        if (!IsOk(wakeSocket.Send(&index, sizeof(index)))) {
+            wakeSocket.Disconnect();
+        }
+    }
+#endif
+
+    channel = std::make_unique<LocalChannel>(std::move(client), std::move(wakeSocket));
     return CreateOk();
 }
 
 [[nodiscard]] Result CreateLocalChannelServer(const std::string& name, std::unique_ptr<ChannelServer>& server) {
     ShmPipeListener listener;
     CheckResult(ShmPipeListener::Create(name, listener));
-    server = std::make_unique<LocalChannelServer>(std::move(listener));
+
+    SocketListener connectNotificationListener;
+#ifndef _WIN32
+    // Without the notification, the server still accepts clients when it is polled
+    if (IsLocalSocketSupported() && !IsOk(SocketListener::Create(GetConnectNotificationName(name), connectNotificationListener))) {
+        LogTrace("Could not create connect notification for local dSPACE VEOS CoSim server '{}'.", name);
+    }
+#endif
+
+    server = std::make_unique<LocalChannelServer>(std::move(listener), std::move(connectNotificationListener));
     return CreateOk();
 }
 
 }  // namespace DsVeosCoSim
-
-#endif
@@ -1,13 +1,17 @@
 // Copyright dSPACE SE & Co. KG. All rights reserved.
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "Channel.hpp"
+#include "Environment.hpp"
 #include "Result.hpp"
 #include "Socket.hpp"
 
@@ -15,9 +19,104 @@ namespace DsVeosCoSim {
 
 constexpr int32_t DefaultReadPacketSize = 1024;
 
+// Limits busy polling to the time the peer usually needs to answer. If the average waiting time exceeds the configured
+// maximum, spinning would only burn CPU time, so the reader blocks right away until the waiting times get shorter again
+class SpinBudget final {  // NOLINT(misc-use-internal-linkage)
+public:
+    explicit SpinBudget(std::chrono::nanoseconds maxSpinTime) : _maxSpinTime(maxSpinTime), _budget(maxSpinTime), _averageWaitTime(maxSpinTime) {
+    }
+
+    ~SpinBudget() noexcept = default;
+
+    SpinBudget(const SpinBudget&) = delete;
+    SpinBudget& operator=(const SpinBudget&) = delete;
+
+    SpinBudget(SpinBudget&&) = delete;
+    SpinBudget& operator=(SpinBudget&&) = delete;
+
+    [[nodiscard]] bool IsEnabled() const {
+        return _maxSpinTime.count() > 0;
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds Get() const {
+        return _budget;
+    }
+
+    void Update(std::chrono::nanoseconds waitTime) {
+        _averageWaitTime += (waitTime - _averageWaitTime) / 8;
+
+        if (_averageWaitTime > _maxSpinTime) {
+            _budget = std::chrono::nanoseconds(0);
+        } else {
+            _budget = std::min(_averageWaitTime * 2, _maxSpinTime);
+        }
+    }
+
+private:
+    std::chrono::nanoseconds _maxSpinTime{};
+    std::chrono::nanoseconds _budget{};
+    std::chrono::nanoseconds _averageWaitTime{};
+};
+
+// Frames held back by DeferSendUntilRead. The last one goes out together with the following receive in one system call
+class DeferredFrame final {  // NOLINT(misc-use-internal-linkage)
+public:
+    explicit DeferredFrame(SocketClient& client) : _client(client) {
+    }
+
+    ~DeferredFrame() noexcept = default;
+
+    DeferredFrame(const DeferredFrame&) = delete;
+    DeferredFrame& operator=(const DeferredFrame&) = delete;
+
+    DeferredFrame(DeferredFrame&&) = delete;
+    DeferredFrame& operator=(DeferredFrame&&) = delete;
+
+    void BeginDeferral() {
+        _isDeferring = _client.IsIoUringEnabled();
+    }
+
+    void EndDeferral() {
+        _isDeferring = false;
+    }
+
+    [[nodiscard]] bool IsDeferring() const {
+        return _isDeferring;
+    }
+
+    [[nodiscard]] bool IsPending() const {
+        return _size > 0;
+    }
+
+    // Takes over the frame. In exchange, the caller gets the previous buffer for writing the next frame
+    void Store(std::vector<uint8_t>& buffer, size_t size) {
+        std::swap(_buffer, buffer);
+        _size = size;
+    }
+
+    [[nodiscard]] Result Send() {
+        if (_size == 0) {
+            return CreateOk();
+        }
+
+        return _client.Send(_buffer.data(), std::exchange(_size, 0));
+    }
+
+    [[nodiscard]] Result SendAndReceive(void* destination, size_t size, size_t& receivedSize) {
+        _isDeferring = false;
+        return _client.SendAndReceive(_buffer.data(), std::exchange(_size, 0), destination, size, receivedSize);
+    }
+
+private:
+    SocketClient& _client;
+    std::vector<uint8_t> _buffer = std::vector<uint8_t>(BufferSize);
+    size_t _size{};
+    bool _isDeferring{};
+};
+
 class SocketChannelWriter final : public ChannelWriter {  // NOLINT(misc-use-internal-linkage)
 public:
-    explicit SocketChannelWriter(SocketClient& client) : _client(client) {
+    SocketChannelWriter(SocketClient& client, DeferredFrame& deferredFrame) : _client(client), _deferredFrame(deferredFrame) {
     }
 
     ~SocketChannelWriter() noexcept override = default;
@@ -29,29 +128,70 @@ public:
     SocketChannelWriter& operator=(SocketChannelWriter&&) = delete;
 
     [[nodiscard]] Result EndWrite() override {
+        CheckResult(_deferredFrame.Send());
+
         uint8_t* buffer = _writeBuffer.data();
 
         // Write header
         WriteScalarToBuffer(buffer, _writeIndex);
 
-        CheckResult(Send(buffer, static_cast<size_t>(_writeIndex)));
+        if (_deferredFrame.IsDeferring()) {
+            _deferredFrame.Store(_writeBuffer, static_cast<size_t>(_writeIndex));
+        } else {
+            CheckResult(Send(buffer, static_cast<size_t>(_writeIndex)));
+        }
 
         _writeIndex = HeaderSize;
         return CreateOk();
     }
 
+    void DeferSendUntilRead() override {
+        _deferredFrame.BeginDeferral();
+    }
+
 protected:
     [[nodiscard]] Result Send(const uint8_t* buffer, size_t size) override {
         return _client.Send(buffer, size);
     }
 
+    // Completes the pending frame and appends as many full frames as possible, all taken directly from data
+    [[nodiscard]] Result SendWithData(const uint8_t* data, size_t size, size_t& sentSize) override {
+        CheckResult(_deferredFrame.Send());
+
+        auto frameDataSize = static_cast<size_t>(_maxFrameSize - HeaderSize);
+        auto remainingFrameSize = static_cast<size_t>(_maxFrameSize - _writeIndex);
+
+        uint8_t* buffer = _writeBuffer.data();
+        WriteScalarToBuffer(buffer, _maxFrameSize);
+
+        _sendBuffers.clear();
+        _sendBuffers.push_back({buffer, static_cast<size_t>(_writeIndex)});
+        _sendBuffers.push_back({data, remainingFrameSize});
+        size_t offset = remainingFrameSize;
+
+        while (size - offset >= frameDataSize) {
+            _sendBuffers.push_back({&_maxFrameSize, sizeof(_maxFrameSize)});
+            _sendBuffers.push_back({data + offset, frameDataSize});
+            offset += frameDataSize;
+        }
+
+        CheckResult(_client.Send(_sendBuffers.data(), _sendBuffers.size()));
+
+        _writeIndex = HeaderSize;
+        sentSize = offset;
+        return CreateOk();
+    }
+
 private:
     SocketClient& _client;
+    DeferredFrame& _deferredFrame;
+    std::vector<SendBuffer> _sendBuffers;
 };
 
 class SocketChannelReader final : public ChannelReader {  // NOLINT(misc-use-internal-linkage)
 public:
-    explicit SocketChannelReader(SocketClient& client) : _client(client) {
+    SocketChannelReader(SocketClient& client, DeferredFrame& deferredFrame)
+        : _client(client), _deferredFrame(deferredFrame), _spinBudget(std::chrono::microseconds(GetSocketSpinTime())) {
         _defaultSizeToRead = DefaultReadPacketSize;
     }
 
@@ -72,20 +212,90 @@ public:
 
 protected:
     [[nodiscard]] Result WaitForDataInternal(uint32_t timeoutInMilliseconds) override {
-        return _client.WaitForData(timeoutInMilliseconds);
+        _deferredFrame.EndDeferral();
+        CheckResult(_deferredFrame.Send());
+
+        if (!_spinBudget.IsEnabled() || (timeoutInMilliseconds == 0)) {
+            return _client.WaitForData(timeoutInMilliseconds);
+        }
+
+        // Data that is already there does not tell anything about the waiting time
+        Result result = _client.WaitForData(0);
+        if (!IsTimeout(result)) {
+            return result;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto spinDeadline = start + std::min<std::chrono::nanoseconds>(_spinBudget.Get(), std::chrono::milliseconds(timeoutInMilliseconds));
+        while (std::chrono::steady_clock::now() < spinDeadline) {
+            result = _client.WaitForData(0);
+            if (!IsTimeout(result)) {
+                _spinBudget.Update(std::chrono::steady_clock::now() - start);
+                return result;
+            }
+        }
+
+        result = _client.WaitForData(timeoutInMilliseconds);
+        if (IsOk(result)) {
+            _spinBudget.Update(std::chrono::steady_clock::now() - start);
+        }
+
+        return result;
     }
 
     [[nodiscard]] Result Receive(void* destination, size_t size, size_t& receivedSize) override {
-        return _client.Receive(destination, size, receivedSize);
+        if (_deferredFrame.IsPending()) {
+            if ((_registeredBuffer != _readBuffer.data()) || (_registeredBufferSize != _readBuffer.size())) {
+                _client.RegisterReceiveBuffer(_readBuffer.data(), _readBuffer.size());
+                _registeredBuffer = _readBuffer.data();
+                _registeredBufferSize = _readBuffer.size();
+            }
+
+            return _deferredFrame.SendAndReceive(destination, size, receivedSize);
+        }
+
+        _deferredFrame.EndDeferral();
+
+        if (!_spinBudget.IsEnabled()) {
+            return _client.Receive(destination, size, receivedSize);
+        }
+
+        CheckResult(_client.TryReceive(destination, size, receivedSize));
+        if (receivedSize > 0) {
+            return CreateOk();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        auto spinDeadline = start + _spinBudget.Get();
+        while (std::chrono::steady_clock::now() < spinDeadline) {
+            CheckResult(_client.TryReceive(destination, size, receivedSize));
+            if (receivedSize > 0) {
+                _spinBudget.Update(std::chrono::steady_clock::now() - start);
+                return CreateOk();
+            }
+        }
+
+        CheckResult(_client.Receive(destination, size, receivedSize));
+        _spinBudget.Update(std::chrono::steady_clock::now() - start);
+        return CreateOk();
     }
 
 private:
     SocketClient& _client;
+    DeferredFrame& _deferredFrame;
+    SpinBudget _spinBudget;
+    const uint8_t* _registeredBuffer{};
+    size_t _registeredBufferSize{};
 };
 
 class SocketChannel final : public Channel {  // NOLINT(misc-use-internal-linkage)
 public:
-    explicit SocketChannel(SocketClient client) : _client(std::move(client)), _writer(_client), _reader(_client) {
+    explicit SocketChannel(SocketClient client)
+        : _client(std::move(client)), _deferredFrame(_client), _writer(_client, _deferredFrame), _reader(_client, _deferredFrame) {
+        if (IsSocketIoUringEnabled()) {
+            // Without io_uring, deferred frames are simply sent right away
+            (void)_client.TryEnableIoUring();
+        }
     }
 
     ~SocketChannel() noexcept override = default;
@@ -112,8 +322,17 @@ public:
         return _reader;
     }
 
+#ifndef _WIN32
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) override {
+        if (_client.IsConnected()) {
+            fileDescriptors.push_back(_client.GetHandle().Get());
+        }
+    }
+#endif
+
 private:
     SocketClient _client;
+    DeferredFrame _deferredFrame;
 
     SocketChannelWriter _writer;
     SocketChannelReader _reader;
@@ -161,44 +380,24 @@ public:
         return CreateNotConnected();
     }
 
-private:
-    SocketListener _listenerIpv4;
-    SocketListener _listenerIpv6;
-    uint16_t _port{};
-};
-
 #ifndef _WIN32
+    void GetFileDescriptors(std::vector<int32_t>& fileDescriptors) const override {
+        if (_listenerIpv4.IsRunning()) {
+            fileDescriptors.push_back(_listenerIpv4.GetHandle().Get());
+        }
 
-class LocalChannelServer final : public ChannelServer {
-public:
-    explicit LocalChannelServer(SocketListener listener) : _listener(std::move(listener)) {
-    }
-
-    ~LocalChannelServer() noexcept override = default;
-
-    LocalChannelServer(const LocalChannelServer&) = delete;
-    LocalChannelServer& operator=(const LocalChannelServer&) = delete;
-
-    LocalChannelServer(LocalChannelServer&&) = delete;
-    LocalChannelServer& operator=(LocalChannelServer&&) = delete;
-
-    [[nodiscard]] uint16_t GetLocalPort() const override {
-        return {};
-    }
-
-    [[nodiscard]] Result TryAccept(std::unique_ptr<Channel>& channel) override {
-        SocketClient client;
-        CheckResult(_listener.TryAccept(client));
-        channel = std::make_unique<SocketChannel>(std::move(client));
-        return CreateOk();
+        if (_listenerIpv6.IsRunning()) {
+            fileDescriptors.push_back(_listenerIpv6.GetHandle().Get());
+        }
     }
+#endif
 
 private:
-    SocketListener _listener;
+    SocketListener _listenerIpv4;
+    SocketListener _listenerIpv6;
+    uint16_t _port{};
 };
 
-#endif
-
 [[nodiscard]] Result TryConnectToTcpChannel(const std::string& remoteIpAddress,
                                             uint16_t remotePort,
                                             uint16_t localPort,
@@ -231,34 +430,4 @@ private:
     return CreateOk();
 }
 
-#ifndef _WIN32
-
-[[nodiscard]] Result TryConnectToLocalChannel(const std::string& name, std::unique_ptr<Channel>& channel) {
-    CheckResult(StartupNetwork());
-
-    if (!IsLocalSocketSupported()) {
-        return CreateOk();
-    }
-
-    SocketClient client{};
-    CheckResult(SocketClient::TryConnect(name, client));
-    channel = std::make_unique<SocketChannel>(std::move(client));
-    return CreateOk();
-}
-
-[[nodiscard]] Result CreateLocalChannelServer(const std::string& name, std::unique_ptr<ChannelServer>& server) {
-    CheckResult(StartupNetwork());
-
-    if (!IsLocalSocketSupported()) {
-        return CreateOk();
-    }
-
-    SocketListener listener;
-    CheckResult(SocketListener::Create(name, listener));
-    server = std::make_unique<LocalChannelServer>(std::move(listener));
-    return CreateOk();
-}
-
-#endif
-
 }  // namespace DsVeosCoSim
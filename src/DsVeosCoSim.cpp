@@ -175,6 +175,10 @@ namespace {
     return reinterpret_cast<const DsVeosCoSim_IoSignal*>(ioSignal);
 }
 
+[[nodiscard]] const DsVeosCoSim_IncomingSignalChange* Convert(const IncomingSignalChange* changes) {
+    return reinterpret_cast<const DsVeosCoSim_IncomingSignalChange*>(changes);
+}
+
 [[nodiscard]] const IoSignal* Convert(const DsVeosCoSim_IoSignal* ioSignal) {
     return reinterpret_cast<const IoSignal*>(ioSignal);
 }
@@ -227,6 +231,23 @@ namespace {
     return static_cast<IoSignalId>(ioSignalId);
 }
 
+// DsVeosCoSim_IoSignalHandle has the same underlying type as DsVeosCoSim_IoSignalId, so it cannot be an overload
+[[nodiscard]] constexpr IoSignalHandle ConvertIoSignalHandle(DsVeosCoSim_IoSignalHandle ioSignalHandle) {
+    return static_cast<IoSignalHandle>(ioSignalHandle);
+}
+
+[[nodiscard]] IoSignalHandle* ConvertIoSignalHandle(DsVeosCoSim_IoSignalHandle* ioSignalHandle) {
+    return reinterpret_cast<IoSignalHandle*>(ioSignalHandle);
+}
+
+[[nodiscard]] IncomingSignalValue* Convert(DsVeosCoSim_IncomingSignalValue* incomingSignalValues) {
+    return reinterpret_cast<IncomingSignalValue*>(incomingSignalValues);
+}
+
+[[nodiscard]] const OutgoingSignalValue* Convert(const DsVeosCoSim_OutgoingSignalValue* outgoingSignalValues) {
+    return reinterpret_cast<const OutgoingSignalValue*>(outgoingSignalValues);
+}
+
 [[nodiscard]] constexpr SimulationState Convert(DsVeosCoSim_SimulationState simulationState) {
     return static_cast<SimulationState>(simulationState);
 }
@@ -376,6 +397,42 @@ void InitializeCallbacks(Callbacks& newCallbacks, const DsVeosCoSim_Callbacks& c
     }
 }
 
+void InitializeBatchCallbacks(Callbacks& newCallbacks, const DsVeosCoSim_BatchCallbacks& batchCallbacks, void* userData) {
+    if (auto cb = batchCallbacks.incomingSignalsChangedCallback) {
+        newCallbacks.incomingSignalsChangedCallback = [cb, userData](SimulationTime simulationTime, const IncomingSignalChange* changes, uint32_t count) {
+            cb(simulationTime.count(), Convert(changes), count, userData);
+        };
+    }
+
+    if (auto cb = batchCallbacks.canMessageContainersReceivedCallback) {
+        newCallbacks.canMessageContainersReceivedCallback =
+            [cb, userData](SimulationTime simulationTime, const CanMessageContainer* messageContainers, uint32_t count) {
+                cb(simulationTime.count(), Convert(messageContainers), count, userData);
+            };
+    }
+
+    if (auto cb = batchCallbacks.ethMessageContainersReceivedCallback) {
+        newCallbacks.ethMessageContainersReceivedCallback =
+            [cb, userData](SimulationTime simulationTime, const EthMessageContainer* messageContainers, uint32_t count) {
+                cb(simulationTime.count(), Convert(messageContainers), count, userData);
+            };
+    }
+
+    if (auto cb = batchCallbacks.linMessageContainersReceivedCallback) {
+        newCallbacks.linMessageContainersReceivedCallback =
+            [cb, userData](SimulationTime simulationTime, const LinMessageContainer* messageContainers, uint32_t count) {
+                cb(simulationTime.count(), Convert(messageContainers), count, userData);
+            };
+    }
+
+    if (auto cb = batchCallbacks.frMessageContainersReceivedCallback) {
+        newCallbacks.frMessageContainersReceivedCallback =
+            [cb, userData](SimulationTime simulationTime, const FrMessageContainer* messageContainers, uint32_t count) {
+                cb(simulationTime.count(), Convert(messageContainers), count, userData);
+            };
+    }
+}
+
 }  // namespace
 
 void DsVeosCoSim_SetLogCallback(DsVeosCoSim_LogCallback logCallback) {
@@ -467,6 +524,34 @@ DsVeosCoSim_Result DsVeosCoSim_StartPollingBasedCoSimulation(DsVeosCoSim_Handle
     return Convert(client->StartPollingBasedCoSimulation(newCallbacks));
 }
 
+DsVeosCoSim_Result DsVeosCoSim_RunCallbackBasedCoSimulation2(DsVeosCoSim_Handle handle,
+                                                             DsVeosCoSim_Callbacks callbacks,
+                                                             DsVeosCoSim_BatchCallbacks batchCallbacks) {
+    CheckNotNull(handle);
+
+    CoSimClient* client = Convert(handle);
+
+    Callbacks newCallbacks{};
+    InitializeCallbacks(newCallbacks, callbacks);
+    InitializeBatchCallbacks(newCallbacks, batchCallbacks, callbacks.userData);
+
+    return Convert(client->RunCallbackBasedCoSimulation(newCallbacks));
+}
+
+DsVeosCoSim_Result DsVeosCoSim_StartPollingBasedCoSimulation2(DsVeosCoSim_Handle handle,
+                                                              DsVeosCoSim_Callbacks callbacks,
+                                                              DsVeosCoSim_BatchCallbacks batchCallbacks) {
+    CheckNotNull(handle);
+
+    CoSimClient* client = Convert(handle);
+
+    Callbacks newCallbacks{};
+    InitializeCallbacks(newCallbacks, callbacks);
+    InitializeBatchCallbacks(newCallbacks, batchCallbacks, callbacks.userData);
+
+    return Convert(client->StartPollingBasedCoSimulation(newCallbacks));
+}
+
 DsVeosCoSim_Result DsVeosCoSim_PollCommand(DsVeosCoSim_Handle handle, DsVeosCoSim_SimulationTime* simulationTime, DsVeosCoSim_Command* command) {
     CheckNotNull(handle);
     CheckNotNull(simulationTime);
@@ -556,6 +641,81 @@ DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignal(DsVeosCoSim_Handle handle, Ds
     return Convert(client->Write(Convert(outgoingSignalId), length, value));
 }
 
+DsVeosCoSim_Result DsVeosCoSim_ResolveIncomingSignal(DsVeosCoSim_Handle handle,
+                                                     DsVeosCoSim_IoSignalId incomingSignalId,
+                                                     DsVeosCoSim_IoSignalHandle* incomingSignalHandle) {
+    CheckNotNull(handle);
+    CheckNotNull(incomingSignalHandle);
+
+    CoSimClient* client = Convert(handle);
+
+    return Convert(client->ResolveIncomingSignal(Convert(incomingSignalId), *ConvertIoSignalHandle(incomingSignalHandle)));
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignalByHandle(DsVeosCoSim_Handle handle,
+                                                          DsVeosCoSim_IoSignalHandle incomingSignalHandle,
+                                                          uint32_t* length,
+                                                          void* value) {
+    CheckNotNull(handle);
+    CheckNotNull(length);
+    CheckNotNull(value);
+
+    CoSimClient* client = Convert(handle);
+
+    return Convert(client->Read(ConvertIoSignalHandle(incomingSignalHandle), *length, value));
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ReadIncomingSignals(DsVeosCoSim_Handle handle,
+                                                   uint32_t incomingSignalValuesCount,
+                                                   DsVeosCoSim_IncomingSignalValue* incomingSignalValues) {
+    CheckNotNull(handle);
+    if (incomingSignalValuesCount > 0) {
+        CheckNotNull(incomingSignalValues);
+    }
+
+    CoSimClient* client = Convert(handle);
+
+    return Convert(client->Read(Convert(incomingSignalValues), incomingSignalValuesCount));
+}
+
+DsVeosCoSim_Result DsVeosCoSim_ResolveOutgoingSignal(DsVeosCoSim_Handle handle,
+                                                     DsVeosCoSim_IoSignalId outgoingSignalId,
+                                                     DsVeosCoSim_IoSignalHandle* outgoingSignalHandle) {
+    CheckNotNull(handle);
+    CheckNotNull(outgoingSignalHandle);
+
+    CoSimClient* client = Convert(handle);
+
+    return Convert(client->ResolveOutgoingSignal(Convert(outgoingSignalId), *ConvertIoSignalHandle(outgoingSignalHandle)));
+}
+
+DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignalByHandle(DsVeosCoSim_Handle handle,
+                                                           DsVeosCoSim_IoSignalHandle outgoingSignalHandle,
+                                                           uint32_t length,
+                                                           const void* value) {
+    CheckNotNull(handle);
+    if (length > 0) {
+        CheckNotNull(value);
+    }
+
+    CoSimClient* client = Convert(handle);
+
+    return Convert(client->Write(ConvertIoSignalHandle(outgoingSignalHandle), length, value));
+}
+
+DsVeosCoSim_Result DsVeosCoSim_WriteOutgoingSignals(DsVeosCoSim_Handle handle,
+                                                    uint32_t outgoingSignalValuesCount,
+                                                    const DsVeosCoSim_OutgoingSignalValue* outgoingSignalValues) {
+    CheckNotNull(handle);
+    if (outgoingSignalValuesCount > 0) {
+        CheckNotNull(outgoingSignalValues);
+    }
+
+    CoSimClient* client = Convert(handle);
+
+    return Convert(client->Write(Convert(outgoingSignalValues), outgoingSignalValuesCount));
+}
+
 DsVeosCoSim_Result DsVeosCoSim_GetCanControllers(DsVeosCoSim_Handle handle, uint32_t* canControllersCount, const DsVeosCoSim_CanController** canControllers) {
     CheckNotNull(handle);
     CheckNotNull(canControllersCount);
@@ -1016,6 +1176,8 @@ static_assert(sizeof(void*) == sizeof(DsVeosCoSim_Handle));
 
 static_assert(sizeof(SimulationTime) == sizeof(DsVeosCoSim_SimulationTime));
 
+static_assert(sizeof(IoSignalHandle) == sizeof(DsVeosCoSim_IoSignalHandle));
+
 static_assert(sizeof(CoSimType) == sizeof(uint32_t));
 
 static_assert(sizeof(ConnectionKind) == sizeof(uint32_t));
@@ -1136,6 +1298,21 @@ static_assert(offsetof(IoSignal, dataType) == offsetof(DsVeosCoSim_IoSignal, dat
 static_assert(offsetof(IoSignal, sizeKind) == offsetof(DsVeosCoSim_IoSignal, sizeKind));
 static_assert(offsetof(IoSignal, name) == offsetof(DsVeosCoSim_IoSignal, name));
 
+static_assert(sizeof(IncomingSignalChange) == sizeof(DsVeosCoSim_IncomingSignalChange));
+static_assert(offsetof(IncomingSignalChange, signal) == offsetof(DsVeosCoSim_IncomingSignalChange, incomingSignal));
+static_assert(offsetof(IncomingSignalChange, length) == offsetof(DsVeosCoSim_IncomingSignalChange, length));
+static_assert(offsetof(IncomingSignalChange, value) == offsetof(DsVeosCoSim_IncomingSignalChange, value));
+
+static_assert(sizeof(IncomingSignalValue) == sizeof(DsVeosCoSim_IncomingSignalValue));
+static_assert(offsetof(IncomingSignalValue, signalHandle) == offsetof(DsVeosCoSim_IncomingSignalValue, incomingSignalHandle));
+static_assert(offsetof(IncomingSignalValue, length) == offsetof(DsVeosCoSim_IncomingSignalValue, length));
+static_assert(offsetof(IncomingSignalValue, value) == offsetof(DsVeosCoSim_IncomingSignalValue, value));
+
+static_assert(sizeof(OutgoingSignalValue) == sizeof(DsVeosCoSim_OutgoingSignalValue));
+static_assert(offsetof(OutgoingSignalValue, signalHandle) == offsetof(DsVeosCoSim_OutgoingSignalValue, outgoingSignalHandle));
+static_assert(offsetof(OutgoingSignalValue, length) == offsetof(DsVeosCoSim_OutgoingSignalValue, length));
+static_assert(offsetof(OutgoingSignalValue, value) == offsetof(DsVeosCoSim_OutgoingSignalValue, value));
+
 static_assert(sizeof(CanController) == sizeof(DsVeosCoSim_CanController));
 static_assert(offsetof(CanController, id) == offsetof(DsVeosCoSim_CanController, id));
 static_assert(offsetof(CanController, queueSize) == offsetof(DsVeosCoSim_CanController, queueSize));
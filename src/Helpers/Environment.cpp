@@ -2,6 +2,7 @@
 
 #include "Environment.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -71,6 +72,34 @@ namespace {
     return defaultSpinCount;
 }
 
+[[nodiscard]] uint32_t GetMaxFrameSizeInitial() {
+    constexpr uint32_t defaultMaxFrameSize = 16 * 1024 * 1024;
+
+    size_t intValue{};
+    if (TryGetDecimalValue("VEOS_COSIM_MAX_FRAME_SIZE", intValue)) {
+        return static_cast<uint32_t>(std::min<size_t>(intValue, UINT32_MAX));
+    }
+
+    return defaultMaxFrameSize;
+}
+
+[[nodiscard]] std::string GetStringValue(const std::string& name) {
+    if (const char* stringValue = std::getenv(name.c_str()); stringValue) {  // NOLINT(concurrency-mt-unsafe)
+        return stringValue;
+    }
+
+    return {};
+}
+
+[[nodiscard]] uint32_t GetMicrosecondsValue(const std::string& name) {
+    size_t intValue{};
+    if (TryGetDecimalValue(name, intValue)) {
+        return static_cast<uint32_t>(std::min<size_t>(intValue, UINT32_MAX));
+    }
+
+    return 0;
+}
+
 }  // namespace
 
 [[nodiscard]] bool IsProtocolTracingEnabled() {
@@ -108,6 +137,31 @@ namespace {
     return spinCount;
 }
 
+[[nodiscard]] uint32_t GetMaxFrameSize() {
+    static uint32_t maxFrameSize = GetMaxFrameSizeInitial();
+    return maxFrameSize;
+}
+
+[[nodiscard]] uint32_t GetSocketSpinTime() {
+    static uint32_t spinTime = GetMicrosecondsValue("VEOS_COSIM_SOCKET_SPIN_TIME");
+    return spinTime;
+}
+
+[[nodiscard]] bool IsSocketIoUringEnabled() {
+    static bool enabled = GetBoolValue("VEOS_COSIM_SOCKET_IO_URING");
+    return enabled;
+}
+
+[[nodiscard]] uint32_t GetSocketBusyPollTime() {
+    static uint32_t busyPollTime = GetMicrosecondsValue("VEOS_COSIM_SOCKET_BUSY_POLL");
+    return busyPollTime;
+}
+
+[[nodiscard]] const std::string& GetCatalogCacheDirectory() {
+    static std::string directory = GetStringValue("VEOS_COSIM_CATALOG_CACHE_DIRECTORY");
+    return directory;
+}
+
 [[nodiscard]] bool TryGetAffinityMask(std::string_view name, size_t& mask) {
     constexpr char environmentVariableName[] = "VEOS_COSIM_AFFINITY_MASK";
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <string_view>
 
 namespace DsVeosCoSim {
@@ -18,6 +19,17 @@ namespace DsVeosCoSim {
 
 [[nodiscard]] uint32_t GetSpinCount();
 
+[[nodiscard]] uint32_t GetMaxFrameSize();
+
+// Both values are in microseconds. 0 disables the feature
+[[nodiscard]] uint32_t GetSocketSpinTime();
+[[nodiscard]] uint32_t GetSocketBusyPollTime();
+
+[[nodiscard]] bool IsSocketIoUringEnabled();
+
+// Directory in which clients cache the catalogs of the servers. Empty, if caching is disabled
+[[nodiscard]] const std::string& GetCatalogCacheDirectory();
+
 [[nodiscard]] bool TryGetAffinityMask(std::string_view name, size_t& mask);
 
 }  // namespace DsVeosCoSim
@@ -2,8 +2,6 @@
 
 #pragma once
 
-#ifdef _WIN32
-
 #include <cstdint>
 #include <type_traits>
 
@@ -76,5 +74,3 @@ private:
 };
 
 }  // namespace DsVeosCoSim
-
-#endif
@@ -0,0 +1,282 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#ifndef _WIN32
+
+#include "IoUring.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#include <unistd.h>
+
+#include "Logger.hpp"
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+namespace {
+
+constexpr uint64_t SendUserData = 1;
+constexpr uint64_t ReceiveUserData = 2;
+
+[[nodiscard]] void* MapRing(int32_t fd, size_t size, off_t offset) {
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    return data == MAP_FAILED ? nullptr : data;
+}
+
+template <typename T>
+[[nodiscard]] T* GetRingField(void* ringData, uint32_t offset) {
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(ringData) + offset);
+}
+
+[[nodiscard]] uint32_t ToLength(size_t size) {
+    return static_cast<uint32_t>(std::min<size_t>(size, UINT32_MAX));
+}
+
+}  // namespace
+
+IoUring::~IoUring() noexcept {
+    Close();
+}
+
+IoUring::IoUring(IoUring&& other) noexcept {
+    *this = std::move(other);
+}
+
+IoUring& IoUring::operator=(IoUring&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    Close();
+
+    _fd = std::exchange(other._fd, -1);
+    _ringData = std::exchange(other._ringData, nullptr);
+    _ringSize = std::exchange(other._ringSize, 0);
+    _completionRingData = std::exchange(other._completionRingData, nullptr);
+    _completionRingSize = std::exchange(other._completionRingSize, 0);
+    _submissionEntries = std::exchange(other._submissionEntries, nullptr);
+    _submissionEntriesSize = std::exchange(other._submissionEntriesSize, 0);
+    _submissionHead = std::exchange(other._submissionHead, nullptr);
+    _submissionTail = std::exchange(other._submissionTail, nullptr);
+    _submissionMask = std::exchange(other._submissionMask, 0);
+    _submissionArray = std::exchange(other._submissionArray, nullptr);
+    _completionHead = std::exchange(other._completionHead, nullptr);
+    _completionTail = std::exchange(other._completionTail, nullptr);
+    _completionMask = std::exchange(other._completionMask, 0);
+    _completionEntries = std::exchange(other._completionEntries, nullptr);
+    _registeredBuffer = std::exchange(other._registeredBuffer, nullptr);
+    _registeredBufferSize = std::exchange(other._registeredBufferSize, 0);
+    return *this;
+}
+
+[[nodiscard]] Result IoUring::Create(uint32_t entries, IoUring& ring) {
+    io_uring_params params{};
+    auto fd = static_cast<int32_t>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+        LogTrace("io_uring is not available. Error code: {}.", errno);
+        return CreateError();
+    }
+
+    IoUring newRing;
+    newRing._fd = fd;
+
+    newRing._ringSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+    newRing._completionRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+
+    bool isSingleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (isSingleMapping) {
+        newRing._ringSize = std::max(newRing._ringSize, newRing._completionRingSize);
+        newRing._completionRingSize = 0;
+    }
+
+    newRing._ringData = MapRing(fd, newRing._ringSize, IORING_OFF_SQ_RING);
+    if (!newRing._ringData) {
+        LogError(errno, "Could not map io_uring submission ring.");
+        return CreateError();
+    }
+
+    void* completionRingData = newRing._ringData;
+    if (!isSingleMapping) {
+        newRing._completionRingData = MapRing(fd, newRing._completionRingSize, IORING_OFF_CQ_RING);
+        if (!newRing._completionRingData) {
+            LogError(errno, "Could not map io_uring completion ring.");
+            return CreateError();
+        }
+
+        completionRingData = newRing._completionRingData;
+    }
+
+    newRing._submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+    newRing._submissionEntries = static_cast<io_uring_sqe*>(MapRing(fd, newRing._submissionEntriesSize, IORING_OFF_SQES));
+    if (!newRing._submissionEntries) {
+        LogError(errno, "Could not map io_uring submission entries.");
+        return CreateError();
+    }
+
+    newRing._submissionHead = GetRingField<uint32_t>(newRing._ringData, params.sq_off.head);
+    newRing._submissionTail = GetRingField<uint32_t>(newRing._ringData, params.sq_off.tail);
+    newRing._submissionMask = *GetRingField<uint32_t>(newRing._ringData, params.sq_off.ring_mask);
+    newRing._submissionArray = GetRingField<uint32_t>(newRing._ringData, params.sq_off.array);
+
+    newRing._completionHead = GetRingField<uint32_t>(completionRingData, params.cq_off.head);
+    newRing._completionTail = GetRingField<uint32_t>(completionRingData, params.cq_off.tail);
+    newRing._completionMask = *GetRingField<uint32_t>(completionRingData, params.cq_off.ring_mask);
+    newRing._completionEntries = GetRingField<io_uring_cqe>(completionRingData, params.cq_off.cqes);
+
+    ring = std::move(newRing);
+    return CreateOk();
+}
+
+[[nodiscard]] bool IoUring::TryRegisterBuffer(void* data, size_t size) {
+    if (!IsValid()) {
+        return false;
+    }
+
+    if (_registeredBuffer) {
+        (void)syscall(__NR_io_uring_register, _fd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+        _registeredBuffer = nullptr;
+        _registeredBufferSize = 0;
+    }
+
+    iovec buffer{};
+    buffer.iov_base = data;
+    buffer.iov_len = size;
+    if (syscall(__NR_io_uring_register, _fd, IORING_REGISTER_BUFFERS, &buffer, 1) != 0) {
+        LogTrace("Could not register io_uring buffer. Error code: {}.", errno);
+        return false;
+    }
+
+    _registeredBuffer = static_cast<uint8_t*>(data);
+    _registeredBufferSize = size;
+    return true;
+}
+
+[[nodiscard]] Result IoUring::SendAndReceive(int32_t socket,
+                                             const void* source,
+                                             size_t sourceSize,
+                                             void* destination,
+                                             size_t destinationSize,
+                                             int32_t& sentSize,
+                                             int32_t& receivedSize) {
+    if (!IsValid()) {
+        LogError("io_uring is not initialized.");
+        return CreateError();
+    }
+
+    uint32_t tail = *_submissionTail;
+    uint32_t head = __atomic_load_n(_submissionHead, __ATOMIC_ACQUIRE);
+    if (_submissionMask + 1 - (tail - head) < 2) {
+        LogError("io_uring submission queue is full.");
+        return CreateError();
+    }
+
+    uint32_t sendIndex = tail & _submissionMask;
+    io_uring_sqe& send = _submissionEntries[sendIndex];
+    memset(&send, 0, sizeof(send));
+    send.opcode = IORING_OP_SEND;
+    send.flags = IOSQE_IO_LINK;
+    send.fd = socket;
+    send.addr = reinterpret_cast<uint64_t>(source);
+    send.len = ToLength(sourceSize);
+    // Lets the kernel retry short sends on stream sockets
+    send.msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+    send.user_data = SendUserData;
+    _submissionArray[sendIndex] = sendIndex;
+
+    auto* destinationBytes = static_cast<uint8_t*>(destination);
+    bool isRegistered = _registeredBuffer && (destinationBytes >= _registeredBuffer) &&
+                        (destinationBytes + destinationSize <= _registeredBuffer + _registeredBufferSize);
+
+    uint32_t receiveIndex = (tail + 1) & _submissionMask;
+    io_uring_sqe& receive = _submissionEntries[receiveIndex];
+    memset(&receive, 0, sizeof(receive));
+    receive.opcode = isRegistered ? IORING_OP_READ_FIXED : IORING_OP_RECV;
+    receive.fd = socket;
+    receive.addr = reinterpret_cast<uint64_t>(destination);
+    receive.len = ToLength(destinationSize);
+    receive.user_data = ReceiveUserData;
+    _submissionArray[receiveIndex] = receiveIndex;
+
+    __atomic_store_n(_submissionTail, tail + 2, __ATOMIC_RELEASE);
+
+    bool isSendCompleted{};
+    bool isReceiveCompleted{};
+    uint32_t submitCount = 2;
+    while (!isSendCompleted || !isReceiveCompleted) {
+        int32_t waitCount = (isSendCompleted ? 0 : 1) + (isReceiveCompleted ? 0 : 1);
+        auto result = static_cast<int32_t>(syscall(__NR_io_uring_enter, _fd, submitCount, waitCount, IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            LogError(errno, "Could not enter io_uring.");
+            return CreateError();
+        }
+
+        submitCount -= std::min(static_cast<uint32_t>(result), submitCount);
+
+        uint32_t completionHead = *_completionHead;
+        uint32_t completionTail = __atomic_load_n(_completionTail, __ATOMIC_ACQUIRE);
+        while (completionHead != completionTail) {
+            const io_uring_cqe& completion = _completionEntries[completionHead & _completionMask];
+            if (completion.user_data == SendUserData) {
+                sentSize = completion.res;
+                isSendCompleted = true;
+            } else if (completion.user_data == ReceiveUserData) {
+                receivedSize = completion.res;
+                isReceiveCompleted = true;
+            }
+
+            completionHead++;
+        }
+
+        __atomic_store_n(_completionHead, completionHead, __ATOMIC_RELEASE);
+    }
+
+    return CreateOk();
+}
+
+[[nodiscard]] bool IoUring::IsValid() const {
+    return _fd >= 0;
+}
+
+void IoUring::Close() noexcept {
+    if (_submissionEntries) {
+        munmap(_submissionEntries, _submissionEntriesSize);
+        _submissionEntries = nullptr;
+    }
+
+    if (_completionRingData) {
+        munmap(_completionRingData, _completionRingSize);
+        _completionRingData = nullptr;
+    }
+
+    if (_ringData) {
+        munmap(_ringData, _ringSize);
+        _ringData = nullptr;
+    }
+
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+
+    _registeredBuffer = nullptr;
+    _registeredBufferSize = 0;
+}
+
+}  // namespace DsVeosCoSim
+
+#endif
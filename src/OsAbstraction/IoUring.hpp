@@ -0,0 +1,75 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Result.hpp"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace DsVeosCoSim {
+
+// Minimal io_uring instance driven by raw system calls. It only covers what the socket channel needs
+class IoUring final {
+public:
+    IoUring() = default;
+    ~IoUring() noexcept;
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    IoUring(IoUring&& other) noexcept;
+    IoUring& operator=(IoUring&& other) noexcept;
+
+    [[nodiscard]] static Result Create(uint32_t entries, IoUring& ring);
+
+    // Receives into this range use a fixed buffer, so the kernel does not need to map the pages for every call.
+    // A previously registered buffer is replaced
+    [[nodiscard]] bool TryRegisterBuffer(void* data, size_t size);
+
+    // Submits the send and the receive with a single system call and waits for both. The receive is linked to the send,
+    // so it is canceled (receivedSize = -ECANCELED) if the send did not complete in full. Negative sizes are errno values
+    [[nodiscard]] Result SendAndReceive(int32_t socket,
+                                        const void* source,
+                                        size_t sourceSize,
+                                        void* destination,
+                                        size_t destinationSize,
+                                        int32_t& sentSize,
+                                        int32_t& receivedSize);
+
+    [[nodiscard]] bool IsValid() const;
+
+private:
+    void Close() noexcept;
+
+    int32_t _fd = -1;
+
+    void* _ringData{};
+    size_t _ringSize{};
+    void* _completionRingData{};
+    size_t _completionRingSize{};
+    io_uring_sqe* _submissionEntries{};
+    size_t _submissionEntriesSize{};
+
+    uint32_t* _submissionHead{};
+    uint32_t* _submissionTail{};
+    uint32_t _submissionMask{};
+    uint32_t* _submissionArray{};
+
+    uint32_t* _completionHead{};
+    uint32_t* _completionTail{};
+    uint32_t _completionMask{};
+    io_uring_cqe* _completionEntries{};
+
+    uint8_t* _registeredBuffer{};
+    size_t _registeredBufferSize{};
+};
+
+}  // namespace DsVeosCoSim
+
+#endif
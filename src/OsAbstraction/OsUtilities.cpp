@@ -2,49 +2,68 @@
 
 #include "OsUtilities.hpp"
 
-#include <string>
-
-#include "Environment.hpp"
-
-#ifdef _WIN32
-
 #include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <string>
 #include <string_view>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include "Environment.hpp"
+#include "Logger.hpp"
+#include "Result.hpp"
+
+#ifdef _WIN32
+
 #include <Windows.h>
 #undef min
 
 #include <sysinfoapi.h>
 
-#include "Logger.hpp"
-#include "Result.hpp"
-
 #else
 
 #ifndef _GNU_SOURCE
 #define _GNU_SOURCE
 #endif
 
+#include <cerrno>
+#include <climits>
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#include <fcntl.h>
+#include <poll.h>
 #include <pthread.h>
 #include <sched.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 #endif
 
 namespace DsVeosCoSim {
 
-#ifdef _WIN32
+struct ListenerHeader {
+    std::atomic<uint32_t> counter;
+    std::atomic<uint32_t> ownerPid;
+};
 
-constexpr size_t ServerSharedMemorySize = 4;
+constexpr size_t ServerSharedMemorySize = sizeof(ListenerHeader);
 
 namespace {
 
+#ifdef _WIN32
+
 [[nodiscard]] int32_t GetLastWindowsError() {
     return static_cast<int32_t>(GetLastError());
 }
@@ -83,34 +102,108 @@ namespace {
     return Utf8ToWide(fmt::format("Local\\dSPACE.VEOS.CoSim.SharedMemory.{}", name), fullName);
 }
 
-// Spin wait with exponential backoff
-template <typename Predicate>
-bool SpinWait(Predicate&& predicate, uint32_t iterations) {
-    for (uint32_t i = 0; i < iterations; ++i) {
-        if (std::forward<Predicate>(predicate)()) {
-            return true;
-        }
+#else
 
-        // Exponential backoff
-        if (i < 16) {
-            _mm_pause();
-        } else if (i < 128) {
-            for (int j = 0; j < 4; ++j) {
-                _mm_pause();
-            }
-        } else {
-            for (int j = 0; j < 16; ++j) {
-                _mm_pause();
-            }
+[[nodiscard]] std::string GetFullSharedMemoryName(std::string_view name) {
+    return fmt::format("/dSPACE.VEOS.CoSim.SharedMemory.{}", name);
+}
+
+[[nodiscard]] Result EnsureSharedMemorySize(const Handle& handle, size_t size) {
+    struct stat status{};
+    if (fstat(handle.Get(), &status) != 0) {
+        LogError(errno, "Could not query size of shared memory.");
+        return CreateError();
+    }
+
+    // Both peers may race to size a freshly created object. Growing to the same size is idempotent.
+    if (static_cast<size_t>(status.st_size) < size) {
+        if (ftruncate(handle.Get(), static_cast<off_t>(size)) != 0) {
+            LogError(errno, "Could not resize shared memory.");
+            return CreateError();
         }
     }
 
-    return false;
+    return CreateOk();
+}
+
+[[nodiscard]] Result MapSharedMemory(const Handle& handle, size_t size, void*& data) {
+    CheckResult(EnsureSharedMemorySize(handle, size));
+
+    data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle.Get(), 0);
+    if (data == MAP_FAILED) {
+        data = nullptr;
+        LogError(errno, "Could not map view of shared memory.");
+        return CreateError();
+    }
+
+    return CreateOk();
+}
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex words must be plain 32 bit integers.");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Futex words must be lock free.");
+
+[[nodiscard]] uint32_t* GetFutexAddress(std::atomic<uint32_t>& word) {
+    return reinterpret_cast<uint32_t*>(&word);
 }
 
+// The futexes live in memory shared between processes, so FUTEX_PRIVATE_FLAG must not be used
+void FutexWait(std::atomic<uint32_t>& word, uint32_t expectedValue, uint32_t timeoutInMilliseconds) {
+    timespec timeout{};
+    timespec* timeoutPointer = nullptr;
+    if (timeoutInMilliseconds != Infinite) {
+        timeout.tv_sec = static_cast<time_t>(timeoutInMilliseconds / 1000);
+        timeout.tv_nsec = static_cast<long>(timeoutInMilliseconds % 1000) * 1000000L;
+        timeoutPointer = &timeout;
+    }
+
+    // EAGAIN (value already changed), EINTR and ETIMEDOUT are all handled by re-checking the predicate
+    (void)syscall(SYS_futex, GetFutexAddress(word), FUTEX_WAIT, expectedValue, timeoutPointer, nullptr, 0);
+}
+
+void FutexWakeAll(std::atomic<uint32_t>& word) {
+    (void)syscall(SYS_futex, GetFutexAddress(word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+// Only enter the kernel if the counterpart announced that it is about to sleep
+void SignalFutexEvent(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& waiterCount) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiterCount.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    sequence.fetch_add(1, std::memory_order_release);
+    FutexWakeAll(sequence);
+}
+
+template <typename Predicate>
+void WaitForFutexEvent(std::atomic<uint32_t>& sequence, std::atomic<uint32_t>& waiterCount, Predicate&& predicate, uint32_t timeoutInMilliseconds) {
+    waiterCount.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // The sequence must be sampled before the predicate is checked, otherwise a wake up could get lost
+    uint32_t currentSequence = sequence.load(std::memory_order_acquire);
+    if (!std::forward<Predicate>(predicate)()) {
+        FutexWait(sequence, currentSequence, timeoutInMilliseconds);
+    }
+
+    waiterCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+#endif
+
 }  // namespace
 
-void Handle::Reset(void* newHandle) {
+void CpuRelax() {
+#if defined(_WIN32) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#ifdef _WIN32
+
+void Handle::Reset(handle_t newHandle) {
     if (IsValid()) {
         CloseHandle(_handle);
     }
@@ -308,6 +401,191 @@ void SharedMemory::Close() {
     return _data != nullptr && _handle.IsValid();
 }
 
+#else
+
+void Handle::Reset(handle_t newHandle) {
+    if (IsValid()) {
+        close(_handle);
+    }
+
+    _handle = newHandle;
+}
+
+[[nodiscard]] bool Handle::IsValid() const {
+    return _handle >= 0;
+}
+
+[[nodiscard]] Result Handle::Wait() const {
+    return Wait(Infinite);
+}
+
+// A file descriptor is considered signaled as soon as it becomes readable. For a pidfd, that is the case when the process exited.
+[[nodiscard]] Result Handle::Wait(uint32_t milliseconds) const {
+    if (!IsValid()) {
+        LogError("Handle is not initialized.");
+        return CreateError();
+    }
+
+    pollfd pfd{};
+    pfd.fd = _handle;
+    pfd.events = POLLIN;
+
+    int32_t timeout = milliseconds == Infinite ? -1 : static_cast<int32_t>(std::min<uint32_t>(milliseconds, INT32_MAX));
+    int32_t pollResult = poll(&pfd, 1, timeout);
+    if (pollResult > 0) {
+        return CreateOk();
+    }
+
+    if (pollResult == 0) {
+        return CreateTimeout();
+    }
+
+    LogError(errno, "Could not wait for handle.");
+    return CreateError();
+}
+
+SharedMemory::SharedMemory(Handle handle, size_t size, void* data, std::string name, bool isOwner)
+    : _handle(std::move(handle)), _size(size), _data(data), _name(std::move(name)), _isOwner(isOwner) {
+}
+
+SharedMemory::~SharedMemory() noexcept {
+    Close();
+}
+
+SharedMemory::SharedMemory(SharedMemory&& other) noexcept
+    : _handle(std::move(other._handle)), _size(other._size), _data(other._data), _name(std::move(other._name)), _isOwner(other._isOwner) {
+    other._size = {};
+    other._data = {};
+    other._isOwner = {};
+}
+
+SharedMemory& SharedMemory::operator=(SharedMemory&& other) noexcept {
+    if (this != &other) {
+        Close();
+        _size = other._size;
+        _handle = std::move(other._handle);
+        _data = other._data;
+        _name = std::move(other._name);
+        _isOwner = other._isOwner;
+        other._size = {};
+        other._data = {};
+        other._isOwner = {};
+    }
+
+    return *this;
+}
+
+[[nodiscard]] Result SharedMemory::CreateOrOpen(std::string_view name, size_t size, SharedMemory& sharedMemory) {
+    std::string fullName = GetFullSharedMemoryName(name);
+
+    bool isOwner = true;
+    Handle handle(shm_open(fullName.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    if (!handle.IsValid() && (errno == EEXIST)) {
+        isOwner = false;
+        handle = Handle(shm_open(fullName.c_str(), O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    }
+
+    if (!handle.IsValid()) {
+        LogError(errno, "Could not create or open shared memory.");
+        return CreateError();
+    }
+
+    void* data{};
+    Result result = MapSharedMemory(handle, size, data);
+    if (!IsOk(result)) {
+        if (isOwner) {
+            shm_unlink(fullName.c_str());
+        }
+
+        return result;
+    }
+
+    sharedMemory = SharedMemory(std::move(handle), size, data, std::move(fullName), isOwner);
+    return CreateOk();
+}
+
+[[nodiscard]] Result SharedMemory::TryOpenExisting(std::string_view name, size_t size, SharedMemory& sharedMemory) {
+    std::string fullName = GetFullSharedMemoryName(name);
+
+    Handle handle(shm_open(fullName.c_str(), O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    if (!handle.IsValid()) {
+        if (errno == ENOENT) {
+            return CreateNotConnected();
+        }
+
+        LogError(errno, "Could not open shared memory.");
+        return CreateError();
+    }
+
+    void* data{};
+    CheckResult(MapSharedMemory(handle, size, data));
+
+    sharedMemory = SharedMemory(std::move(handle), size, data, std::move(fullName), false);
+    return CreateOk();
+}
+
+void SharedMemory::Close() {
+    if (!IsValid()) {
+        return;
+    }
+
+    if (_data != nullptr) {
+        munmap(_data, _size);
+    }
+
+    // Mimic the lifetime of named kernel objects on Windows: the name vanishes together with its creator
+    if (_isOwner) {
+        Unlink();
+    }
+
+    _handle.Reset();
+    _data = nullptr;
+    _size = 0;
+    _isOwner = false;
+}
+
+void SharedMemory::Unlink() const {
+    if (_name.empty()) {
+        return;
+    }
+
+    // The name might already refer to a newer object of a later session, which must stay reachable
+    Handle currentHandle(shm_open(_name.c_str(), O_RDONLY | O_CLOEXEC, 0));
+    if (!currentHandle.IsValid()) {
+        return;
+    }
+
+    struct stat ownStatus{};
+    struct stat currentStatus{};
+    if ((fstat(_handle.Get(), &ownStatus) != 0) || (fstat(currentHandle.Get(), &currentStatus) != 0)) {
+        return;
+    }
+
+    if ((ownStatus.st_dev == currentStatus.st_dev) && (ownStatus.st_ino == currentStatus.st_ino)) {
+        shm_unlink(_name.c_str());
+    }
+}
+
+void SharedMemory::Persist() {
+    _isOwner = false;
+}
+
+void SharedMemory::Adopt() {
+    _isOwner = true;
+}
+
+[[nodiscard]] uint8_t* SharedMemory::GetData() const {
+    return static_cast<uint8_t*>(_data);
+}
+
+[[nodiscard]] bool SharedMemory::IsValid() const {
+    return _data != nullptr && _handle.IsValid();
+}
+
+#endif
+
+#ifdef _WIN32
+
 ShmPipePart::ShmPipePart(NamedEvent newDataEvent, NamedEvent newSpaceEvent, SharedMemory sharedMemory, bool isWriter, bool isServer)
     : _newDataEvent(std::move(newDataEvent)),
       _newSpaceEvent(std::move(newSpaceEvent)),
@@ -318,10 +596,21 @@ ShmPipePart::ShmPipePart(NamedEvent newDataEvent, NamedEvent newSpaceEvent, Shar
     SetOwnPid(GetCurrentProcessIdCached());
 }
 
+#else
+
+ShmPipePart::ShmPipePart(SharedMemory sharedMemory, bool isWriter, bool isServer)
+    : _sharedMemory(std::move(sharedMemory)), _spinCount(GetSpinCount()), _isWriter(isWriter), _isServer(isServer) {
+    SetOwnPid(GetCurrentProcessIdCached());
+}
+
+#endif
+
 ShmPipePart::~ShmPipePart() noexcept {
     Disconnect();
 }
 
+#ifdef _WIN32
+
 [[nodiscard]] Result ShmPipePart::Create(std::string_view name, bool isWriter, bool isServer, ShmPipePart& pipe) {
     NamedLock mutex;
     CheckResult(NamedLock::Create(name, mutex));
@@ -363,12 +652,62 @@ ShmPipePart::~ShmPipePart() noexcept {
     return CreateOk();
 }
 
+#else
+
+[[nodiscard]] Result ShmPipePart::Create(std::string_view name, bool isWriter, bool isServer, ShmPipePart& pipe) {
+    std::string dataName = fmt::format("{}.Data", name);
+
+    constexpr size_t totalSize = static_cast<size_t>(PipeBufferSize) + sizeof(Header);
+
+    // A freshly created object is zero filled, which is exactly the initial state of the header
+    SharedMemory sharedMemory;
+    CheckResult(SharedMemory::CreateOrOpen(dataName, totalSize, sharedMemory));
+
+    auto& header = *sharedMemory.As<Header>();
+    uint32_t ownPid = isServer ? header.serverPid.load(std::memory_order_acquire) : header.clientPid.load(std::memory_order_acquire);
+    uint32_t counterPartPid = isServer ? header.clientPid.load(std::memory_order_acquire) : header.serverPid.load(std::memory_order_acquire);
+
+    // Unlike Windows objects, POSIX shared memory survives crashed processes. Reset leftovers of an earlier session.
+    bool isStale = (ownPid != 0) || ((counterPartPid != 0) && !IsProcessRunning(OpenProcessHandle(counterPartPid)));
+    if (isStale) {
+        header.serverPid.store(0, std::memory_order_release);
+        header.clientPid.store(0, std::memory_order_release);
+        header.writeIndex.store(0, std::memory_order_release);
+        header.readIndex.store(0, std::memory_order_release);
+        header.disconnected.store(0, std::memory_order_release);
+        counterPartPid = 0;
+
+        // Its creator is gone, so nobody else would ever remove the name
+        sharedMemory.Adopt();
+    }
+
+    // Both sides are attached now, so nobody needs to find this segment by its name anymore
+    if (counterPartPid != 0) {
+        sharedMemory.Unlink();
+    }
+
+    pipe = ShmPipePart(std::move(sharedMemory), isWriter, isServer);
+    return CreateOk();
+}
+
+#endif
+
 void ShmPipePart::Disconnect() const {
     if (!_sharedMemory.IsValid()) {
         return;
     }
 
     SetOwnPid(0);
+
+#ifndef _WIN32
+    // Wake up a blocked counterpart, so that it notices the disconnect immediately
+    auto& header = *_sharedMemory.As<Header>();
+    header.disconnected.store(1, std::memory_order_release);
+    header.newDataSequence.fetch_add(1, std::memory_order_release);
+    FutexWakeAll(header.newDataSequence);
+    header.newSpaceSequence.fetch_add(1, std::memory_order_release);
+    FutexWakeAll(header.newSpaceSequence);
+#endif
 }
 
 [[nodiscard]] Result ShmPipePart::Read(void* destination, size_t size, size_t& receivedSize) {
@@ -412,7 +751,7 @@ void ShmPipePart::Disconnect() const {
     header.readIndex.store(readIndex + sizeToCopy, std::memory_order_release);
     receivedSize = sizeToCopy;
 
-    return _newSpaceEvent.Set();
+    return SignalNewSpace();
 }
 
 [[nodiscard]] Result ShmPipePart::Write(const void* source, size_t size) {
@@ -455,7 +794,7 @@ void ShmPipePart::Disconnect() const {
         sourceBuffer += sizeToCopy;
     }
 
-    return _newDataEvent.Set();
+    return SignalNewData();
 }
 
 [[nodiscard]] bool ShmPipePart::IsConnected() const {
@@ -498,7 +837,7 @@ void ShmPipePart::Disconnect() const {
     // Not yet connected fully. The pipe is used before the counterpart finished the initialization.
     // Handle as connected for now...
     if (!counterPartPidSet && !counterPartProcessHandleSet) {
-        return CreateOk();
+        return IsDisconnected() ? CreateNotConnected() : CreateOk();
     }
 
     // !counterPartPidSet && counterPartProcessHandleSet
@@ -508,7 +847,7 @@ void ShmPipePart::Disconnect() const {
     }
 
     // counterPartPidSet && !counterPartProcessHandleSet
-    _counterPartProcess = Handle(OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION | SYNCHRONIZE, FALSE, counterPartPid));
+    _counterPartProcess = OpenProcessHandle(counterPartPid);
     if (!_counterPartProcess.IsValid()) {
         return CreateNotConnected();
     }
@@ -516,6 +855,8 @@ void ShmPipePart::Disconnect() const {
     return CreateOk();
 }
 
+#ifdef _WIN32
+
 [[nodiscard]] Result ShmPipePart::WaitForSpace() {
     auto& header = *_sharedMemory.As<Header>();
 
@@ -591,6 +932,95 @@ void ShmPipePart::Disconnect() const {
     return CreateOk();
 }
 
+[[nodiscard]] Result ShmPipePart::SignalNewData() const {
+    return _newDataEvent.Set();
+}
+
+[[nodiscard]] Result ShmPipePart::SignalNewSpace() const {
+    return _newSpaceEvent.Set();
+}
+
+#else
+
+[[nodiscard]] Result ShmPipePart::WaitForSpace() {
+    auto& header = *_sharedMemory.As<Header>();
+
+    auto hasSpace = [&header] {
+        return GetAvailableSpace(header) > 0;
+    };
+
+    // Fast path
+    if (SpinWait(hasSpace, _spinCount)) {
+        return CreateOk();
+    }
+
+    CheckResult(SignalNewData());
+
+    // Slow path. The futex wait is bounded, so that a dead counterpart is detected within a millisecond.
+    while (!hasSpace()) {
+        WaitForFutexEvent(header.newSpaceSequence, header.newSpaceWaiterCount, hasSpace, 1);
+        if (hasSpace()) {
+            break;
+        }
+
+        CheckResult(CheckIfConnectionIsAlive());
+    }
+
+    return CreateOk();
+}
+
+[[nodiscard]] Result ShmPipePart::WaitForData(uint32_t timeoutInMilliseconds) {
+    auto& header = *_sharedMemory.As<Header>();
+
+    auto hasData = [&header] {
+        return GetAvailableData(header) > 0;
+    };
+
+    // Fast path
+    if (SpinWait(hasData, _spinCount)) {
+        return CreateOk();
+    }
+
+    CheckResult(SignalNewSpace());
+
+    bool hasTimeout = timeoutInMilliseconds != Infinite;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutInMilliseconds);
+
+    // Slow path
+    while (!hasData()) {
+        auto now = std::chrono::steady_clock::now();
+        if (hasTimeout && now >= deadline) {
+            return CreateTimeout();
+        }
+
+        auto remainingMs = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
+        uint32_t waitMs = static_cast<uint32_t>(std::clamp<int64_t>(remainingMs, 0, 1));
+
+        WaitForFutexEvent(header.newDataSequence, header.newDataWaiterCount, hasData, waitMs);
+        if (hasData()) {
+            break;
+        }
+
+        CheckResult(CheckIfConnectionIsAlive());
+    }
+
+    return CreateOk();
+}
+
+[[nodiscard]] Result ShmPipePart::SignalNewData() const {
+    auto& header = *_sharedMemory.As<Header>();
+    SignalFutexEvent(header.newDataSequence, header.newDataWaiterCount);
+    return CreateOk();
+}
+
+[[nodiscard]] Result ShmPipePart::SignalNewSpace() const {
+    auto& header = *_sharedMemory.As<Header>();
+    SignalFutexEvent(header.newSpaceSequence, header.newSpaceWaiterCount);
+    return CreateOk();
+}
+
+#endif
+
 [[nodiscard]] Result ShmPipePart::WaitForData() {
     return WaitForData(Infinite);
 }
@@ -605,7 +1035,7 @@ void ShmPipePart::Disconnect() const {
 
     uint32_t counterPartPid = GetCounterPartPid();
     if (counterPartPid == 0) {
-        if (!_counterPartProcess.IsValid()) {
+        if (!_counterPartProcess.IsValid() && !IsDisconnected()) {
             // Not connected yet. Give it up to 5 seconds ...
             _detectionCounter++;
             if (_detectionCounter == ConnectionTimeoutInMilliseconds) {
@@ -621,7 +1051,7 @@ void ShmPipePart::Disconnect() const {
     }
 
     if (!_counterPartProcess.IsValid()) {
-        _counterPartProcess = Handle(OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION | SYNCHRONIZE, FALSE, counterPartPid));
+        _counterPartProcess = OpenProcessHandle(counterPartPid);
     }
 
     if (IsProcessRunning(_counterPartProcess)) {
@@ -632,6 +1062,15 @@ void ShmPipePart::Disconnect() const {
     return CreateError();
 }
 
+[[nodiscard]] bool ShmPipePart::IsDisconnected() const {
+#ifdef _WIN32
+    return false;
+#else
+    auto& header = *_sharedMemory.As<Header>();
+    return header.disconnected.load(std::memory_order_acquire) != 0;
+#endif
+}
+
 void ShmPipePart::SetOwnPid(uint32_t pid) const {
     auto& header = *_sharedMemory.As<Header>();
     if (_isServer) {
@@ -651,18 +1090,62 @@ void ShmPipePart::SetOwnPid(uint32_t pid) const {
     return _isServer ? header.clientPid.load(std::memory_order_acquire) : header.serverPid.load(std::memory_order_acquire);
 }
 
-ShmPipeClient::ShmPipeClient(ShmPipePart writer, ShmPipePart reader) : _writer(std::move(writer)), _reader(std::move(reader)) {
+#ifndef _WIN32
+
+[[nodiscard]] bool ShmPipePart::RequestWake() const {
+    auto& header = *_sharedMemory.As<Header>();
+    header.wakePending.store(0, std::memory_order_relaxed);
+    header.wakeRequested.store(1, std::memory_order_relaxed);
+
+    // Pairs with the fence in TrySetWakePending, so that either the writer sees the request or the reader sees the data
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return (GetAvailableData(header) > 0) || IsDisconnected();
+}
+
+void ShmPipePart::CancelWake() const {
+    auto& header = *_sharedMemory.As<Header>();
+    if (header.wakeRequested.load(std::memory_order_relaxed) != 0) {
+        header.wakeRequested.store(0, std::memory_order_relaxed);
+    }
+}
+
+[[nodiscard]] bool ShmPipePart::IsWakePending() const {
+    auto& header = *_sharedMemory.As<Header>();
+    return header.wakePending.load(std::memory_order_acquire) != 0;
+}
+
+[[nodiscard]] bool ShmPipePart::TrySetWakePending() const {
+    auto& header = *_sharedMemory.As<Header>();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (header.wakeRequested.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    // A reader, which consumed the data already, does not need to be woken up
+    if (GetAvailableData(header) == 0) {
+        return false;
+    }
+
+    return header.wakePending.exchange(1, std::memory_order_acq_rel) == 0;
+}
+
+#endif
+
+ShmPipeClient::ShmPipeClient(ShmPipePart writer, ShmPipePart reader, uint32_t index)
+    : _writer(std::move(writer)), _reader(std::move(reader)), _index(index) {
 }
 
 [[nodiscard]] Result ShmPipeClient::TryConnect(std::string_view name, ShmPipeClient& client) {
+#ifdef _WIN32
     NamedLock mutex;
     CheckResult(NamedLock::Create(name, mutex));
+#endif
 
     SharedMemory sharedMemory;
     CheckResult(SharedMemory::TryOpenExisting(name, ServerSharedMemorySize, sharedMemory));
 
-    auto& counter = *sharedMemory.As<std::atomic<uint32_t>>();
-    uint32_t currentCounter = counter.fetch_add(1);
+    auto& header = *sharedMemory.As<ListenerHeader>();
+    uint32_t currentCounter = header.counter.fetch_add(1);
 
     std::string writerName = fmt::format("{}.{}.{}", name, currentCounter, ClientToServerPostFix);
     ShmPipePart writer;
@@ -672,7 +1155,7 @@ ShmPipeClient::ShmPipeClient(ShmPipePart writer, ShmPipePart reader) : _writer(s
     ShmPipePart reader;
     CheckResult(ShmPipePart::Create(readerName, false, false, reader));
 
-    client = ShmPipeClient(std::move(writer), std::move(reader));
+    client = ShmPipeClient(std::move(writer), std::move(reader), currentCounter);
     return CreateOk();
 }
 
@@ -697,23 +1180,76 @@ void ShmPipeClient::Disconnect() const {
     return _writer.IsConnected();
 }
 
+[[nodiscard]] uint32_t ShmPipeClient::GetIndex() const {
+    return _index;
+}
+
+#ifndef _WIN32
+
+[[nodiscard]] bool ShmPipeClient::RequestWake() const {
+    return _reader.RequestWake();
+}
+
+void ShmPipeClient::CancelWake() const {
+    _reader.CancelWake();
+}
+
+[[nodiscard]] bool ShmPipeClient::IsWakePending() const {
+    return _reader.IsWakePending();
+}
+
+[[nodiscard]] bool ShmPipeClient::TrySetWakePending() const {
+    return _writer.TrySetWakePending();
+}
+
+#endif
+
 ShmPipeListener::ShmPipeListener(std::string name, SharedMemory sharedMemory) : _name(std::move(name)), _sharedMemory(std::move(sharedMemory)) {
 }
 
+ShmPipeListener::~ShmPipeListener() noexcept {
+    Stop();
+}
+
 [[nodiscard]] Result ShmPipeListener::Create(const std::string& name, ShmPipeListener& listener) {
+#ifdef _WIN32
     NamedLock mutex;
     CheckResult(NamedLock::Create(name, mutex));
+#endif
 
     SharedMemory sharedMemory;
     CheckResult(SharedMemory::CreateOrOpen(name, ServerSharedMemorySize, sharedMemory));
-    auto& counter = *sharedMemory.As<std::atomic<uint32_t>>();
-    counter.store(0, std::memory_order_release);
+
+    // Only take over the name if no other running process listens on it
+    auto& header = *sharedMemory.As<ListenerHeader>();
+    uint32_t ownerPid = header.ownerPid.load(std::memory_order_acquire);
+    do {
+        if ((ownerPid != 0) && IsProcessRunning(OpenProcessHandle(ownerPid))) {
+#ifndef _WIN32
+            // The name belongs to the other listener, even if this process happened to create the object
+            sharedMemory.Persist();
+#endif
+            LogError("Could not create listener, because a running process already listens on the same name.");
+            return CreateError();
+        }
+    } while (!header.ownerPid.compare_exchange_weak(ownerPid, GetCurrentProcessIdCached(), std::memory_order_acq_rel));
+
+    header.counter.store(0, std::memory_order_release);
+
+#ifndef _WIN32
+    // A listener of a crashed server might have left its segment behind
+    sharedMemory.Adopt();
+#endif
 
     listener = ShmPipeListener(name, std::move(sharedMemory));
     return CreateOk();
 }
 
 void ShmPipeListener::Stop() {
+    if (_sharedMemory.IsValid()) {
+        _sharedMemory.As<ListenerHeader>()->ownerPid.store(0, std::memory_order_release);
+    }
+
     _sharedMemory.Close();
 }
 
@@ -723,8 +1259,8 @@ void ShmPipeListener::Stop() {
         return CreateError();
     }
 
-    auto& counter = *_sharedMemory.As<std::atomic<uint32_t>>();
-    uint32_t currentCounter = counter.load(std::memory_order_acquire);
+    auto& header = *_sharedMemory.As<ListenerHeader>();
+    uint32_t currentCounter = header.counter.load(std::memory_order_acquire);
     if (currentCounter <= _lastCounter) {
         return CreateNotConnected();
     }
@@ -740,7 +1276,7 @@ void ShmPipeListener::Stop() {
     ShmPipePart reader;
     CheckResult(ShmPipePart::Create(readerName, false, true, reader));
 
-    client = ShmPipeClient(std::move(writer), std::move(reader));
+    client = ShmPipeClient(std::move(writer), std::move(reader), counterToUse);
     return CreateOk();
 }
 
@@ -748,6 +1284,12 @@ void ShmPipeListener::Stop() {
     return _sharedMemory.IsValid();
 }
 
+#ifdef _WIN32
+
+[[nodiscard]] Handle OpenProcessHandle(uint32_t processId) {
+    return Handle(OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION | SYNCHRONIZE, FALSE, processId));
+}
+
 [[nodiscard]] bool IsProcessRunning(const Handle& processHandle) {
     if (!processHandle.IsValid()) {
         return false;
@@ -775,6 +1317,29 @@ void SetThreadAffinity(std::string_view name) {
 
 #else
 
+// A pidfd keeps referring to the very same process, even if its pid gets recycled
+[[nodiscard]] Handle OpenProcessHandle(uint32_t processId) {
+    return Handle(static_cast<Handle::handle_t>(syscall(SYS_pidfd_open, static_cast<pid_t>(processId), 0)));
+}
+
+[[nodiscard]] bool IsProcessRunning(const Handle& processHandle) {
+    if (!processHandle.IsValid()) {
+        return false;
+    }
+
+    pollfd pfd{};
+    pfd.fd = processHandle.Get();
+    pfd.events = POLLIN;
+
+    // The pidfd becomes readable as soon as the process terminated
+    return poll(&pfd, 1, 0) == 0;
+}
+
+[[nodiscard]] uint32_t GetCurrentProcessIdCached() {
+    static const auto ProcessId = static_cast<uint32_t>(getpid());
+    return ProcessId;
+}
+
 void SetThreadAffinity(std::string_view name) {
     size_t mask{};
     if (!TryGetAffinityMask(name, mask)) {
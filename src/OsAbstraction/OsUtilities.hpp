@@ -2,27 +2,54 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include <string_view>
-
-#ifdef _WIN32
-
-#include <atomic>
+#include <utility>
 
 #include "Result.hpp"
 
-#endif
-
 namespace DsVeosCoSim {
 
 [[maybe_unused]] constexpr uint32_t Infinite = UINT32_MAX;
 
-#ifdef _WIN32
+void CpuRelax();
+
+// Spin wait with exponential backoff
+template <typename Predicate>
+bool SpinWait(Predicate&& predicate, uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; ++i) {
+        if (std::forward<Predicate>(predicate)()) {
+            return true;
+        }
+
+        // Exponential backoff
+        if (i < 16) {
+            CpuRelax();
+        } else if (i < 128) {
+            for (int j = 0; j < 4; ++j) {
+                CpuRelax();
+            }
+        } else {
+            for (int j = 0; j < 16; ++j) {
+                CpuRelax();
+            }
+        }
+    }
+
+    return false;
+}
 
 class Handle final {
 public:
+#ifdef _WIN32
     using handle_t = void*;
+    static constexpr handle_t InvalidHandle = nullptr;
+#else
+    using handle_t = int32_t;
+    static constexpr handle_t InvalidHandle = -1;
+#endif
 
     Handle() = default;
     explicit Handle(handle_t handle) : _handle(handle) {
@@ -51,10 +78,10 @@ public:
     }
 
     [[nodiscard]] handle_t Release() noexcept {
-        return std::exchange(_handle, nullptr);
+        return std::exchange(_handle, InvalidHandle);
     }
 
-    void Reset(void* newHandle = nullptr);
+    void Reset(handle_t newHandle = InvalidHandle);
 
     [[nodiscard]] bool IsValid() const;
 
@@ -62,9 +89,11 @@ public:
     [[nodiscard]] Result Wait(uint32_t milliseconds) const;
 
 private:
-    void* _handle{};
+    handle_t _handle = InvalidHandle;
 };
 
+#ifdef _WIN32
+
 class NamedEvent final {
     explicit NamedEvent(Handle handle);
 
@@ -110,8 +139,14 @@ private:
     Handle _handle;
 };
 
+#endif
+
 class SharedMemory final {
+#ifdef _WIN32
     SharedMemory(Handle handle, size_t size, void* data);
+#else
+    SharedMemory(Handle handle, size_t size, void* data, std::string name, bool isOwner);
+#endif
 
 public:
     SharedMemory() = default;
@@ -137,10 +172,26 @@ public:
 
     [[nodiscard]] bool IsValid() const;
 
+#ifndef _WIN32
+    // POSIX shared memory outlives its users, so the name can be removed explicitly once all peers are attached.
+    // The name is only removed while it still refers to this object.
+    void Unlink() const;
+
+    // Keeps the name after closing, so that host wide tables survive the process, which happened to create them
+    void Persist();
+
+    // Removes the name after closing, although the object was created by another, meanwhile dead process
+    void Adopt();
+#endif
+
 private:
     Handle _handle;
     size_t _size{};
     void* _data{};
+#ifndef _WIN32
+    std::string _name;
+    bool _isOwner{};
+#endif
 };
 
 class ShmPipePart {
@@ -151,9 +202,27 @@ class ShmPipePart {
         std::atomic<uint32_t> clientPid{};
         alignas(LockFreeCacheLineBytes) std::atomic<uint32_t> writeIndex{};
         alignas(LockFreeCacheLineBytes) std::atomic<uint32_t> readIndex{};
+#ifndef _WIN32
+        // Set on disconnect, so that a counterpart which never saw the other side can tell both states apart
+        std::atomic<uint32_t> disconnected{};
+        // Set by a reader, which stopped reading and waits on a file descriptor instead of the futex. The writer then
+        // signals it as well
+        std::atomic<uint32_t> wakeRequested{};
+        // Set by the writer when it signaled the file descriptor and cleared by the reader after draining it
+        std::atomic<uint32_t> wakePending{};
+        // Futex words replacing the named events of the Windows implementation
+        alignas(LockFreeCacheLineBytes) std::atomic<uint32_t> newDataSequence{};
+        std::atomic<uint32_t> newDataWaiterCount{};
+        alignas(LockFreeCacheLineBytes) std::atomic<uint32_t> newSpaceSequence{};
+        std::atomic<uint32_t> newSpaceWaiterCount{};
+#endif
     };
 
+#ifdef _WIN32
     ShmPipePart(NamedEvent newDataEvent, NamedEvent newSpaceEvent, SharedMemory sharedMemory, bool isWriter, bool isServer);
+#else
+    ShmPipePart(SharedMemory sharedMemory, bool isWriter, bool isServer);
+#endif
 
 public:
     static constexpr uint32_t PipeBufferSize = 65536;
@@ -177,6 +246,17 @@ public:
 
     [[nodiscard]] bool IsConnected() const;
 
+#ifndef _WIN32
+    // Called by the reader when it stops reading. Returns true, if data is available already, since the writer might not
+    // have signaled it then
+    [[nodiscard]] bool RequestWake() const;
+    void CancelWake() const;
+    [[nodiscard]] bool IsWakePending() const;
+    // Called by the writer after writing. Returns true, if the reader requested to be woken up, has not been signaled since
+    // and did not consume the data yet
+    [[nodiscard]] bool TrySetWakePending() const;
+#endif
+
 private:
     [[nodiscard]] static uint32_t MaskIndex(uint32_t index);
     [[nodiscard]] static uint32_t GetAvailableSpace(const Header& header);
@@ -184,13 +264,18 @@ private:
     [[nodiscard]] Result EnsureConnected();
     [[nodiscard]] Result WaitForSpace();
     [[nodiscard]] Result WaitForData();
+    [[nodiscard]] Result SignalNewData() const;
+    [[nodiscard]] Result SignalNewSpace() const;
     [[nodiscard]] Result CheckIfConnectionIsAlive();
+    [[nodiscard]] bool IsDisconnected() const;
     void SetOwnPid(uint32_t pid) const;
     [[nodiscard]] uint32_t GetOwnPid() const;
     [[nodiscard]] uint32_t GetCounterPartPid() const;
 
+#ifdef _WIN32
     NamedEvent _newDataEvent;
     NamedEvent _newSpaceEvent;
+#endif
     SharedMemory _sharedMemory;
     Handle _counterPartProcess{};
     uint32_t _detectionCounter{};
@@ -207,7 +292,7 @@ class ShmPipeClient final {
 
     friend class ShmPipeListener;
 
-    ShmPipeClient(ShmPipePart writer, ShmPipePart reader);
+    ShmPipeClient(ShmPipePart writer, ShmPipePart reader, uint32_t index);
 
 public:
     ShmPipeClient() = default;
@@ -229,9 +314,21 @@ public:
 
     [[nodiscard]] bool IsConnected() const;
 
+    // Identifies the pipe among all pipes of the same listener
+    [[nodiscard]] uint32_t GetIndex() const;
+
+#ifndef _WIN32
+    // Lets the counterpart signal new data through a file descriptor besides the futex (see LocalChannel)
+    [[nodiscard]] bool RequestWake() const;
+    void CancelWake() const;
+    [[nodiscard]] bool IsWakePending() const;
+    [[nodiscard]] bool TrySetWakePending() const;
+#endif
+
 private:
     ShmPipePart _writer{};
     ShmPipePart _reader{};
+    uint32_t _index{};
 };
 
 class ShmPipeListener final {
@@ -239,7 +336,7 @@ class ShmPipeListener final {
 
 public:
     ShmPipeListener() = default;
-    ~ShmPipeListener() noexcept = default;
+    ~ShmPipeListener() noexcept;
 
     ShmPipeListener(const ShmPipeListener&) = delete;
     ShmPipeListener& operator=(const ShmPipeListener&) = delete;
@@ -261,11 +358,10 @@ private:
     uint32_t _lastCounter{};
 };
 
+[[nodiscard]] Handle OpenProcessHandle(uint32_t processId);
 [[nodiscard]] bool IsProcessRunning(const Handle& processHandle);
 [[nodiscard]] uint32_t GetCurrentProcessIdCached();
 
-#endif
-
 void SetThreadAffinity(std::string_view name);
 
 }  // namespace DsVeosCoSim
@@ -0,0 +1,124 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#ifndef _WIN32
+
+#include "Poller.hpp"
+
+#include <cerrno>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <sys/epoll.h>
+
+#include <unistd.h>
+
+#include "Logger.hpp"
+#include "OsUtilities.hpp"
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+Poller::~Poller() noexcept {
+    Close();
+}
+
+Poller::Poller(Poller&& other) noexcept {
+    *this = std::move(other);
+}
+
+Poller& Poller::operator=(Poller&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    Close();
+
+    _fd = std::exchange(other._fd, -1);
+    _fileDescriptors = std::move(other._fileDescriptors);
+    return *this;
+}
+
+[[nodiscard]] Result Poller::Create(Poller& poller) {
+    int32_t fd = epoll_create1(EPOLL_CLOEXEC);
+    if (fd < 0) {
+        LogError(errno, "Could not create epoll instance.");
+        return CreateError();
+    }
+
+    Poller newPoller;
+    newPoller._fd = fd;
+    poller = std::move(newPoller);
+    return CreateOk();
+}
+
+[[nodiscard]] Result Poller::SetFileDescriptors(const std::vector<int32_t>& fileDescriptors) {
+    if (!IsValid()) {
+        LogError("Poller is not initialized.");
+        return CreateError();
+    }
+
+    // Closed file descriptors are already gone, so failures are expected here
+    for (int32_t fileDescriptor : _fileDescriptors) {
+        (void)epoll_ctl(_fd, EPOLL_CTL_DEL, fileDescriptor, nullptr);
+    }
+
+    _fileDescriptors.clear();
+
+    for (int32_t fileDescriptor : fileDescriptors) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fileDescriptor;
+        if (epoll_ctl(_fd, EPOLL_CTL_ADD, fileDescriptor, &event) != 0) {
+            LogError(errno, "Could not add file descriptor to epoll instance.");
+            return CreateError();
+        }
+
+        _fileDescriptors.push_back(fileDescriptor);
+    }
+
+    return CreateOk();
+}
+
+[[nodiscard]] Result Poller::Wait(uint32_t timeoutInMilliseconds) const {
+    if (!IsValid()) {
+        LogError("Poller is not initialized.");
+        return CreateError();
+    }
+
+    int32_t timeout = timeoutInMilliseconds == Infinite ? -1 : static_cast<int32_t>(timeoutInMilliseconds);
+
+    epoll_event event{};
+    int32_t result = epoll_wait(_fd, &event, 1, timeout);
+    if (result < 0) {
+        if (errno == EINTR) {
+            return CreateTimeout();
+        }
+
+        LogError(errno, "Could not wait on epoll instance.");
+        return CreateError();
+    }
+
+    return result == 0 ? CreateTimeout() : CreateOk();
+}
+
+[[nodiscard]] int32_t Poller::GetFileDescriptor() const {
+    return _fd;
+}
+
+[[nodiscard]] bool Poller::IsValid() const {
+    return _fd >= 0;
+}
+
+void Poller::Close() noexcept {
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+
+    _fileDescriptors.clear();
+}
+
+}  // namespace DsVeosCoSim
+
+#endif
@@ -0,0 +1,48 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <cstdint>
+#include <vector>
+
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+// Level triggered readiness of a set of file descriptors based on epoll. The file descriptor of the poller itself becomes
+// readable as soon as any of them is readable, so it can be integrated into the event loop of the host
+class Poller final {
+public:
+    Poller() = default;
+    ~Poller() noexcept;
+
+    Poller(const Poller&) = delete;
+    Poller& operator=(const Poller&) = delete;
+
+    Poller(Poller&& other) noexcept;
+    Poller& operator=(Poller&& other) noexcept;
+
+    [[nodiscard]] static Result Create(Poller& poller);
+
+    // Replaces all watched file descriptors
+    [[nodiscard]] Result SetFileDescriptors(const std::vector<int32_t>& fileDescriptors);
+
+    // Returns timeout, if none of the file descriptors became readable in time
+    [[nodiscard]] Result Wait(uint32_t timeoutInMilliseconds) const;
+
+    [[nodiscard]] int32_t GetFileDescriptor() const;
+
+    [[nodiscard]] bool IsValid() const;
+
+private:
+    void Close() noexcept;
+
+    int32_t _fd = -1;
+    std::vector<int32_t> _fileDescriptors;
+};
+
+}  // namespace DsVeosCoSim
+
+#endif
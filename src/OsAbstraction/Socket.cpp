@@ -15,6 +15,7 @@
 
 #include <fmt/format.h>
 
+#include "Environment.hpp"
 #include "Logger.hpp"
 #include "Result.hpp"
 
@@ -65,6 +66,7 @@ using SocketLength = socklen_t;
 constexpr int32_t ErrorCodeInterrupted = EINTR;
 constexpr int32_t ErrorCodeInProgress = EINPROGRESS;
 constexpr int32_t ErrorCodeBrokenPipe = EPIPE;
+constexpr int32_t ErrorCodeWouldBlock = EWOULDBLOCK;
 constexpr int32_t ErrorCodeConnectionAborted = ECONNABORTED;
 constexpr int32_t ErrorCodeConnectionReset = ECONNRESET;
 
@@ -478,6 +480,14 @@ int32_t DoUnlink(const std::string& path) {
     return ConvertFromInternetAddress(address, remoteAddress);
 }
 
+#ifndef _WIN32
+
+[[nodiscard]] bool IsDisconnectErrorCode(int32_t errorCode) {
+    return (errorCode == ErrorCodeConnectionAborted) || (errorCode == ErrorCodeConnectionReset) || (errorCode == ErrorCodeBrokenPipe);
+}
+
+#endif
+
 [[nodiscard]] Result EnableNoDelay(const SocketHandle& socketHandle) {
     int32_t flags = 1;
     int32_t result = setsockopt(socketHandle.Get(), IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&flags), static_cast<SocketLength>(sizeof(flags)));
@@ -489,6 +499,22 @@ int32_t DoUnlink(const std::string& path) {
     return CreateOk();
 }
 
+// Lets the kernel busy poll the device queue on blocking receives. This is only an optimization, so failures are not fatal
+void EnableBusyPoll([[maybe_unused]] const SocketHandle& socketHandle) {
+#ifndef _WIN32
+    uint32_t busyPollTime = GetSocketBusyPollTime();
+    if (busyPollTime == 0) {
+        return;
+    }
+
+    auto value = static_cast<int32_t>(busyPollTime);
+    int32_t result = setsockopt(socketHandle.Get(), SOL_SOCKET, SO_BUSY_POLL, &value, static_cast<SocketLength>(sizeof(value)));
+    if (result != 0) {
+        LogWarning("Could not enable socket option busy poll. Error code: {}.", GetLastNetworkError());
+    }
+#endif
+}
+
 [[nodiscard]] Result PollInternal(const SocketHandle& socketHandle) {
     pollfd fdArray{};
     fdArray.fd = socketHandle.Get();
@@ -536,6 +562,39 @@ void Shutdown(const SocketHandle& socketHandle) {
 #endif
 }
 
+#ifdef _WIN32
+
+using PlatformSendBuffer = WSABUF;
+
+void SetPlatformSendBuffer(PlatformSendBuffer& platformBuffer, const uint8_t* data, size_t size) {
+    platformBuffer.buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(data));  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    platformBuffer.len = static_cast<ULONG>(std::min<size_t>(size, UINT32_MAX));
+}
+
+[[nodiscard]] int64_t DoSendVectored(const SocketHandle& socketHandle, PlatformSendBuffer* platformBuffers, size_t count) {
+    DWORD sentSize{};
+    int32_t result = WSASend(socketHandle.Get(), platformBuffers, static_cast<DWORD>(count), &sentSize, 0, nullptr, nullptr);
+    return result == 0 ? static_cast<int64_t>(sentSize) : -1;
+}
+
+#else
+
+using PlatformSendBuffer = iovec;
+
+void SetPlatformSendBuffer(PlatformSendBuffer& platformBuffer, const uint8_t* data, size_t size) {
+    platformBuffer.iov_base = const_cast<uint8_t*>(data);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    platformBuffer.iov_len = size;
+}
+
+[[nodiscard]] int64_t DoSendVectored(const SocketHandle& socketHandle, PlatformSendBuffer* platformBuffers, size_t count) {
+    msghdr message{};
+    message.msg_iov = platformBuffers;
+    message.msg_iovlen = count;
+    return sendmsg(socketHandle.Get(), &message, MSG_NOSIGNAL);
+}
+
+#endif
+
 }  // namespace
 
 [[nodiscard]] Result StartupNetwork() {
@@ -646,6 +705,7 @@ SocketClient::~SocketClient() noexcept {
         }
 
         CheckResult(EnableNoDelay(socketHandle));
+        EnableBusyPoll(socketHandle);
 
         AddressFamily convertedAddressFamily{};
         CheckResult(ConvertAddressFamily(currentAddressInfo->ai_family, convertedAddressFamily));
@@ -724,20 +784,41 @@ void SocketClient::Disconnect() {
 }
 
 [[nodiscard]] Result SocketClient::Receive(void* destination, size_t size, size_t& receivedSize) const {
+    return ReceiveInternal(destination, size, false, receivedSize);
+}
+
+[[nodiscard]] Result SocketClient::TryReceive(void* destination, size_t size, size_t& receivedSize) const {
+    return ReceiveInternal(destination, size, true, receivedSize);
+}
+
+[[nodiscard]] Result SocketClient::ReceiveInternal(void* destination, size_t size, bool nonBlocking, size_t& receivedSize) const {
     if (!IsConnected()) {
         return CreateNotConnected();
     }
 
+    receivedSize = 0;
     if (size == 0) {
-        receivedSize = 0;
         return CreateOk();
     }
 
 #ifdef _WIN32
+    if (nonBlocking) {
+        // There is no per call flag for non-blocking receives on Windows
+        pollfd pfd{};
+        pfd.fd = _socketHandle.Get();
+        pfd.events = POLLIN;
+
+        int32_t pollResult = DoPoll(&pfd, 1, 0);
+        if (pollResult == 0) {
+            return CreateOk();
+        }
+    }
+
     int32_t chunkSize = static_cast<int32_t>(std::min<size_t>(size, INT32_MAX));
     int32_t receivedSizeTmp = recv(_socketHandle.Get(), static_cast<char*>(destination), chunkSize, 0);
 #else
-    ssize_t receivedSizeTmp = recv(_socketHandle.Get(), destination, size, MSG_NOSIGNAL);
+    int32_t flags = nonBlocking ? MSG_NOSIGNAL | MSG_DONTWAIT : MSG_NOSIGNAL;
+    ssize_t receivedSizeTmp = recv(_socketHandle.Get(), destination, size, flags);
 #endif
 
     if (receivedSizeTmp > 0) {
@@ -757,6 +838,10 @@ void SocketClient::Disconnect() {
 
     int32_t errorCode = GetLastNetworkError();
 
+    if (nonBlocking && (errorCode == ErrorCodeWouldBlock)) {
+        return CreateOk();
+    }
+
     if ((errorCode == ErrorCodeConnectionAborted) || (errorCode == ErrorCodeConnectionReset)
 #ifndef _WIN32
         || (errorCode == ErrorCodeBrokenPipe)
@@ -792,6 +877,82 @@ void SocketClient::Disconnect() {
     return CreateOk();
 }
 
+[[nodiscard]] bool SocketClient::TryEnableIoUring() {
+#ifdef _WIN32
+    return false;
+#else
+    // Only one send and one receive are in flight at a time
+    constexpr uint32_t entries = 2;
+    return IsOk(IoUring::Create(entries, _ioUring));
+#endif
+}
+
+[[nodiscard]] bool SocketClient::IsIoUringEnabled() const {
+#ifdef _WIN32
+    return false;
+#else
+    return _ioUring.IsValid();
+#endif
+}
+
+void SocketClient::RegisterReceiveBuffer([[maybe_unused]] void* data, [[maybe_unused]] size_t size) {
+#ifndef _WIN32
+    // Unregistered buffers work as well, just slightly slower
+    (void)_ioUring.TryRegisterBuffer(data, size);
+#endif
+}
+
+[[nodiscard]] Result SocketClient::SendAndReceive(const void* source, size_t sourceSize, void* destination, size_t size, size_t& receivedSize) {
+#ifndef _WIN32
+    if (_ioUring.IsValid() && IsConnected() && (sourceSize > 0) && (size > 0)) {
+        int32_t sentSizeTmp{};
+        int32_t receivedSizeTmp{};
+        CheckResult(_ioUring.SendAndReceive(_socketHandle.Get(), source, sourceSize, destination, size, sentSizeTmp, receivedSizeTmp));
+
+        if (sentSizeTmp < 0) {
+            if (!_isConnected || IsDisconnectErrorCode(-sentSizeTmp)) {
+                LogTrace("Local endpoint disconnected.");
+                return CreateNotConnected();
+            }
+
+            LogError(-sentSizeTmp, "Could not send to remote endpoint.");
+            return CreateError();
+        }
+
+        // The linked receive got canceled, if the send was short
+        auto sentSize = static_cast<size_t>(sentSizeTmp);
+        if (sentSize < sourceSize) {
+            CheckResult(Send(static_cast<const uint8_t*>(source) + sentSize, sourceSize - sentSize));
+        }
+
+        if (receivedSizeTmp == -ECANCELED) {
+            return Receive(destination, size, receivedSize);
+        }
+
+        if (receivedSizeTmp > 0) {
+            receivedSize = static_cast<size_t>(receivedSizeTmp);
+            return CreateOk();
+        }
+
+        if (receivedSizeTmp == 0) {
+            LogTrace("Remote endpoint disconnected.");
+            return CreateNotConnected();
+        }
+
+        if (!_isConnected || IsDisconnectErrorCode(-receivedSizeTmp)) {
+            LogTrace("Local endpoint disconnected.");
+            return CreateNotConnected();
+        }
+
+        LogError(-receivedSizeTmp, "Could not receive from remote endpoint.");
+        return CreateError();
+    }
+#endif
+
+    CheckResult(Send(source, sourceSize));
+    return Receive(destination, size, receivedSize);
+}
+
 [[nodiscard]] Result SocketClient::Send(const void* source, size_t size) const {
     if (!IsConnected()) {
         return CreateNotConnected();
@@ -845,10 +1006,87 @@ void SocketClient::Disconnect() {
     return CreateOk();
 }
 
+[[nodiscard]] Result SocketClient::Send(const SendBuffer* buffers, size_t count) const {
+    if (!IsConnected()) {
+        return CreateNotConnected();
+    }
+
+    std::array<PlatformSendBuffer, MaxSendBuffersPerCall> platformBuffers{};
+
+    size_t bufferIndex = 0;
+    size_t bufferOffset = 0;
+
+    while (bufferIndex < count) {
+        if (bufferOffset == buffers[bufferIndex].size) {
+            bufferIndex++;
+            bufferOffset = 0;
+            continue;
+        }
+
+        size_t platformBufferCount = 0;
+        for (size_t i = bufferIndex; (i < count) && (platformBufferCount < platformBuffers.size()); i++) {
+            size_t offset = i == bufferIndex ? bufferOffset : 0;
+            const auto* data = static_cast<const uint8_t*>(buffers[i].data) + offset;
+            SetPlatformSendBuffer(platformBuffers[platformBufferCount], data, buffers[i].size - offset);
+            platformBufferCount++;
+        }
+
+        int64_t sentSize = DoSendVectored(_socketHandle, platformBuffers.data(), platformBufferCount);
+
+        if (sentSize > 0) {
+            // Skip everything that went out, the last buffer might have been sent partially
+            auto remainingSentSize = static_cast<size_t>(sentSize);
+            while (remainingSentSize > 0) {
+                size_t remainingBufferSize = buffers[bufferIndex].size - bufferOffset;
+                if (remainingSentSize < remainingBufferSize) {
+                    bufferOffset += remainingSentSize;
+                    break;
+                }
+
+                remainingSentSize -= remainingBufferSize;
+                bufferIndex++;
+                bufferOffset = 0;
+            }
+
+            continue;
+        }
+
+        if (sentSize == 0) {
+            LogTrace("Remote endpoint disconnected.");
+            return CreateNotConnected();
+        }
+
+        if (!_isConnected) {
+            LogTrace("Local endpoint disconnected.");
+            return CreateNotConnected();
+        }
+
+        int32_t errorCode = GetLastNetworkError();
+
+        if ((errorCode == ErrorCodeConnectionAborted) || (errorCode == ErrorCodeConnectionReset)
+#ifndef _WIN32
+            || (errorCode == ErrorCodeBrokenPipe)
+#endif
+        ) {
+            LogTrace("Local endpoint disconnected.");
+            return CreateNotConnected();
+        }
+
+        LogError(GetLastNetworkError(), "Could not send to remote endpoint.");
+        return CreateError();
+    }
+
+    return CreateOk();
+}
+
 [[nodiscard]] bool SocketClient::IsConnected() const {
     return _isConnected && _socketHandle.IsValid();
 }
 
+[[nodiscard]] const SocketHandle& SocketClient::GetHandle() const {
+    return _socketHandle;
+}
+
 SocketListener::SocketListener(SocketHandle socketHandle, AddressFamily addressFamily, std::string path)
     : _socketHandle(std::move(socketHandle)), _addressFamily(addressFamily), _path(std::move(path)), _isRunning(true) {
 }
@@ -948,6 +1186,7 @@ void SocketListener::Stop() {
 
     if (_addressFamily != AddressFamily::Local) {
         CheckResult(EnableNoDelay(acceptedSocketHandle));
+        EnableBusyPoll(acceptedSocketHandle);
     }
 
     client = SocketClient(std::move(acceptedSocketHandle), _addressFamily, _path);
@@ -976,4 +1215,8 @@ void SocketListener::Stop() {
     return _isRunning && _socketHandle.IsValid();
 }
 
+[[nodiscard]] const SocketHandle& SocketListener::GetHandle() const {
+    return _socketHandle;
+}
+
 }  // namespace DsVeosCoSim
@@ -7,6 +7,7 @@
 #include <string_view>
 #include <utility>
 
+#include "IoUring.hpp"
 #include "Result.hpp"
 
 namespace DsVeosCoSim {
@@ -90,9 +91,17 @@ private:
     socket_t _socket = InvalidSocket;
 };
 
+// One piece of data for a gathering send
+struct SendBuffer {
+    const void* data{};
+    size_t size{};
+};
+
 class SocketListener;
 
 class SocketClient final {
+    static constexpr size_t MaxSendBuffersPerCall = 64;
+
     SocketClient(SocketHandle socketHandle, AddressFamily addressFamily, std::string path);
 
     friend class SocketListener;
@@ -119,16 +128,32 @@ public:
     [[nodiscard]] Result GetRemoteAddress(std::string& remoteAddress) const;
 
     [[nodiscard]] Result Receive(void* destination, size_t size, size_t& receivedSize) const;
+    // Returns immediately. receivedSize is 0, if no data is available
+    [[nodiscard]] Result TryReceive(void* destination, size_t size, size_t& receivedSize) const;
     [[nodiscard]] Result Send(const void* source, size_t size) const;
+    [[nodiscard]] Result Send(const SendBuffer* buffers, size_t count) const;
     [[nodiscard]] Result WaitForData(uint32_t timeoutInMilliseconds) const;
 
+    // Lets SendAndReceive submit both operations with one system call. Returns false, if io_uring is not available
+    [[nodiscard]] bool TryEnableIoUring();
+    [[nodiscard]] bool IsIoUringEnabled() const;
+    void RegisterReceiveBuffer(void* data, size_t size);
+    [[nodiscard]] Result SendAndReceive(const void* source, size_t sourceSize, void* destination, size_t size, size_t& receivedSize);
+
     [[nodiscard]] bool IsConnected() const;
 
+    [[nodiscard]] const SocketHandle& GetHandle() const;
+
 private:
+    [[nodiscard]] Result ReceiveInternal(void* destination, size_t size, bool nonBlocking, size_t& receivedSize) const;
+
     SocketHandle _socketHandle;
     AddressFamily _addressFamily{};
     std::string _path;
     bool _isConnected{};
+#ifndef _WIN32
+    IoUring _ioUring;
+#endif
 };
 
 class SocketListener final {
@@ -154,6 +179,8 @@ public:
 
     [[nodiscard]] bool IsRunning() const;
 
+    [[nodiscard]] const SocketHandle& GetHandle() const;
+
 private:
     SocketHandle _socketHandle;
     AddressFamily _addressFamily{};
@@ -2,21 +2,32 @@
 
 #include "PortMapper.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+
+#include <sys/eventfd.h>
+
+#include <unistd.h>
+#endif
 
 #include <fmt/format.h>
 
 #include "Channel.hpp"
 #include "CoSimTypes.hpp"
 #include "Environment.hpp"
-#include "Event.hpp"
 #include "Logger.hpp"
+#include "OsUtilities.hpp"
 #include "Protocol.hpp"
 #include "Result.hpp"
 
@@ -26,34 +37,137 @@ constexpr uint32_t ClientTimeoutInMilliseconds = 1000;
 
 PortMapperServer::PortMapperServer(std::unique_ptr<ChannelServer> channelServer, std::unique_ptr<IProtocol> protocol)
     : _server(std::move(channelServer)), _protocol(std::move(protocol)) {
-    _thread = std::thread([this] {
-        RunPortMapperServer();
-    });
 }
 
 PortMapperServer::~PortMapperServer() noexcept {
+    _isStopping = true;
+#ifdef _WIN32
     _stopEvent.Set();
+#else
+    if (_stopFd >= 0) {
+        (void)eventfd_write(_stopFd, 1);
+    }
+#endif
 
     if (_thread.joinable()) {
         _thread.join();
     }
+
+#ifndef _WIN32
+    if (_stopFd >= 0) {
+        close(_stopFd);
+    }
+#endif
+}
+
+Result PortMapperServer::Start() {
+#ifndef _WIN32
+    CheckResult(Poller::Create(_poller));
+
+    _stopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (_stopFd < 0) {
+        LogError(errno, "Could not create stop event of port mapper.");
+        return CreateError();
+    }
+#endif
+
+    _thread = std::thread([this] {
+        RunPortMapperServer();
+    });
+    return CreateOk();
 }
 
 void PortMapperServer::RunPortMapperServer() {
-    constexpr uint32_t timeoutInMilliseconds = 10U;
-    while (!_stopEvent.Wait(timeoutInMilliseconds)) {
-        Result result = CheckForClient();
+    while (!_isStopping) {
+        Result result = WaitForActivity();
+        if (IsError(result)) {
+            return;
+        }
+
+        if (_isStopping) {
+            return;
+        }
+
+        result = AcceptClients();
         if (IsError(result)) {
             return;
         }
+
+        HandleClients();
     }
 }
 
-Result PortMapperServer::CheckForClient() {
-    std::unique_ptr<Channel> channel;
-    CheckResult(_server->TryAccept(channel));
-    CheckResultWithMessage(HandleClient(*channel), "Port mapper client disconnected unexpectedly.");
+Result PortMapperServer::WaitForActivity() {
+#ifdef _WIN32
+    constexpr uint32_t timeoutInMilliseconds = 10U;
+    (void)_stopEvent.Wait(timeoutInMilliseconds);
     return CreateOk();
+#else
+    if (_isPollerOutdated) {
+        std::vector<int32_t> fileDescriptors{_stopFd};
+        _server->GetFileDescriptors(fileDescriptors);
+        for (const auto& client : _clients) {
+            client->GetFileDescriptors(fileDescriptors);
+        }
+
+        CheckResult(_poller.SetFileDescriptors(fileDescriptors));
+        _isPollerOutdated = false;
+    }
+
+    Result result = _poller.Wait(Infinite);
+    return IsTimeout(result) ? CreateOk() : result;
+#endif
+}
+
+Result PortMapperServer::AcceptClients() {
+    while (true) {
+        std::unique_ptr<Channel> channel;
+        Result result = _server->TryAccept(channel);
+        if (IsNotConnected(result)) {
+            return CreateOk();
+        }
+
+        CheckResult(result);
+        _clients.push_back(std::move(channel));
+#ifndef _WIN32
+        _isPollerOutdated = true;
+#endif
+    }
+}
+
+void PortMapperServer::HandleClients() {
+    // All clients are served by one thread. So a request is only handled once it arrived completely, since a client, which
+    // stalls in the middle of a request, would block all others otherwise
+    auto isClosed = [this](const std::unique_ptr<Channel>& client) {
+        while (true) {
+            Result result = client->GetReader().TryReceiveFrame();
+            if (IsTimeout(result)) {
+                return false;
+            }
+
+            if (IsOk(result)) {
+                result = HandleClient(*client);
+            }
+
+            // Clients usually just close the connection after their last request
+            if (IsNotConnected(result)) {
+                return true;
+            }
+
+            if (!IsOk(result)) {
+                LogTrace("Port mapper client disconnected unexpectedly.");
+                return true;
+            }
+        }
+    };
+
+    auto closedClients = std::remove_if(_clients.begin(), _clients.end(), isClosed);
+    if (closedClients != _clients.end()) {
+        _clients.erase(closedClients, _clients.end());
+#ifndef _WIN32
+        _isPollerOutdated = true;
+#endif
+    }
 }
 
 Result PortMapperServer::HandleClient(Channel& channel) {
@@ -64,9 +178,15 @@ Result PortMapperServer::HandleClient(Channel& channel) {
         case FrameKind::GetPort:
             CheckResultWithMessage(HandleGetPort(channel), "Could not handle get port request.");
             return CreateOk();
+        case FrameKind::GetPorts:
+            CheckResultWithMessage(HandleGetPorts(channel), "Could not handle get ports request.");
+            return CreateOk();
         case FrameKind::SetPort:
             CheckResultWithMessage(HandleSetPort(channel), "Could not handle set port request.");
             return CreateOk();
+        case FrameKind::SetPorts:
+            CheckResultWithMessage(HandleSetPorts(channel), "Could not handle set ports request.");
+            return CreateOk();
         case FrameKind::UnsetPort:
             CheckResultWithMessage(HandleUnsetPort(channel), "Could not handle unset port request.");
             return CreateOk();
@@ -95,6 +215,23 @@ Result PortMapperServer::HandleGetPort(Channel& channel) {
     return CreateOk();
 }
 
+Result PortMapperServer::HandleGetPorts(Channel& channel) {
+    CheckResultWithMessage(_protocol->ReadGetPorts(channel.GetReader(), _serverNames), "Could not read get ports frame.");
+
+    _foundPorts.clear();
+    for (const std::string& name : _serverNames) {
+        if (IsPortMapperServerVerbose()) {
+            LogTrace("Get '{}'", name);
+        }
+
+        auto search = _ports.find(name);
+        _foundPorts.push_back(search == _ports.end() ? 0 : search->second);
+    }
+
+    CheckResultWithMessage(_protocol->SendGetPortsOk(channel.GetWriter(), _foundPorts), "Could not send get ports ok frame.");
+    return CreateOk();
+}
+
 Result PortMapperServer::HandleSetPort(Channel& channel) {
     std::string name;
     uint16_t port = 0;
@@ -114,6 +251,25 @@ Result PortMapperServer::HandleSetPort(Channel& channel) {
     return CreateOk();
 }
 
+Result PortMapperServer::HandleSetPorts(Channel& channel) {
+    CheckResultWithMessage(_protocol->ReadSetPorts(channel.GetReader(), _entries), "Could not read set ports frame.");
+
+    for (const PortMapperEntry& entry : _entries) {
+        if (IsPortMapperServerVerbose()) {
+            LogTrace("Set '{}': {}", entry.serverName, entry.port);
+        }
+
+        _ports[entry.serverName] = entry.port;
+    }
+
+    if (IsPortMapperServerVerbose()) {
+        DumpEntries();
+    }
+
+    CheckResultWithMessage(_protocol->SendOk(channel.GetWriter()), "Could not send ok frame.");
+    return CreateOk();
+}
+
 Result PortMapperServer::HandleUnsetPort(Channel& channel) {
     std::string name;
     CheckResultWithMessage(_protocol->ReadUnsetPort(channel.GetReader(), name), "Could not read unset port frame.");
@@ -150,86 +306,196 @@ void PortMapperServer::DumpEntries() {
 
     std::unique_ptr<IProtocol> protocol;
     CheckResult(CreateProtocol(ProtocolVersion1, protocol));
-    portMapperServer = std::make_unique<PortMapperServer>(std::move(channelServer), std::move(protocol));
+    auto newPortMapperServer = std::make_unique<PortMapperServer>(std::move(channelServer), std::move(protocol));
+    CheckResult(newPortMapperServer->Start());
+    portMapperServer = std::move(newPortMapperServer);
     return CreateOk();
 }
 
-namespace {
-
-[[nodiscard]] Result ConnectToPortMapper(const std::string& ipAddress, std::unique_ptr<Channel>& channel, std::unique_ptr<IProtocol>& protocol) {
-    CheckResult(TryConnectToTcpChannel(ipAddress, GetPortMapperPort(), 0, ClientTimeoutInMilliseconds, channel));
-    CheckResult(CreateProtocol(ProtocolVersion1, protocol));
-    return CreateOk();
+PortMapperClient::PortMapperClient(std::unique_ptr<Channel> channel, std::unique_ptr<IProtocol> protocol)
+    : _channel(std::move(channel)), _protocol(std::move(protocol)) {
 }
 
-[[nodiscard]] Result ReadOkOrError(IProtocol& protocol, Channel& channel, std::string_view callerName) {
+Result PortMapperClient::GetPort(std::string_view serverName, uint16_t& port) const {
+    CheckResultWithMessage(_protocol->SendGetPort(_channel->GetWriter(), serverName), "Could not send get port frame.");
+
     FrameKind frameKind{};
-    CheckResult(protocol.ReceiveHeader(channel.GetReader(), frameKind));
+    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
 
     switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
-        case FrameKind::Ok:
-            CheckResultWithMessage(protocol.ReadOk(channel.GetReader()), "Could not read ok frame.");
+        case FrameKind::GetPortOk:
+            CheckResultWithMessage(_protocol->ReadGetPortOk(_channel->GetReader(), port), "Could not receive port ok frame.");
             return CreateOk();
         case FrameKind::Error: {
-            std::string errorString;
-            CheckResultWithMessage(protocol.ReadError(channel.GetReader(), errorString), "Could not read error frame.");
-            LogError(errorString);
+            std::string errorMessage;
+            CheckResultWithMessage(_protocol->ReadError(_channel->GetReader(), errorMessage), "Could not read error frame.");
+            LogError(errorMessage);
             return CreateError();
         }
         default:
-            LogError("{}: Received unexpected frame '{}'.", callerName, frameKind);
+            LogError("PortMapperGetPort: Received unexpected frame '{}'.", frameKind);
             return CreateError();
     }
 }
 
-}  // namespace
+Result PortMapperClient::GetPorts(const std::vector<std::string>& serverNames, std::vector<uint16_t>& ports) const {
+    CheckResultWithMessage(_protocol->SendGetPorts(_channel->GetWriter(), serverNames), "Could not send get ports frame.");
 
-[[nodiscard]] Result PortMapperGetPort(const std::string& ipAddress, std::string_view serverName, uint16_t& port) {
-    if (IsPortMapperClientVerbose()) {
-        LogTrace("PortMapperGetPort(ipAddress: '{}', serverName: '{}')", ipAddress, serverName);
+    FrameKind frameKind{};
+    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
+
+    switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
+        case FrameKind::GetPortsOk:
+            CheckResultWithMessage(_protocol->ReadGetPortsOk(_channel->GetReader(), ports), "Could not receive ports ok frame.");
+            if (ports.size() != serverNames.size()) {
+                LogError("PortMapperGetPorts: Received {} ports for {} servers.", ports.size(), serverNames.size());
+                return CreateError();
+            }
+
+            return CreateOk();
+        case FrameKind::Error: {
+            std::string errorMessage;
+            CheckResultWithMessage(_protocol->ReadError(_channel->GetReader(), errorMessage), "Could not read error frame.");
+            LogError(errorMessage);
+            return CreateError();
+        }
+        default:
+            LogError("PortMapperGetPorts: Received unexpected frame '{}'.", frameKind);
+            return CreateError();
     }
+}
 
-    std::unique_ptr<Channel> channel;
-    std::unique_ptr<IProtocol> protocol;
-    CheckResult(ConnectToPortMapper(ipAddress, channel, protocol));
+Result PortMapperClient::SetPort(std::string_view serverName, uint16_t port) const {
+    CheckResultWithMessage(_protocol->SendSetPort(_channel->GetWriter(), serverName, port), "Could not send set port frame.");
+    return ReadOkOrError("PortMapperSetPort");
+}
 
-    CheckResultWithMessage(protocol->SendGetPort(channel->GetWriter(), serverName), "Could not send get port frame.");
+Result PortMapperClient::SetPorts(const std::vector<PortMapperEntry>& entries) const {
+    CheckResultWithMessage(_protocol->SendSetPorts(_channel->GetWriter(), entries), "Could not send set ports frame.");
+    return ReadOkOrError("PortMapperSetPorts");
+}
 
+Result PortMapperClient::UnsetPort(std::string_view serverName) const {
+    CheckResultWithMessage(_protocol->SendUnsetPort(_channel->GetWriter(), serverName), "Could not send unset port frame.");
+    return ReadOkOrError("PortMapperUnsetPort");
+}
+
+Result PortMapperClient::ReadOkOrError(std::string_view callerName) const {
     FrameKind frameKind{};
-    CheckResult(protocol->ReceiveHeader(channel->GetReader(), frameKind));
+    CheckResult(_protocol->ReceiveHeader(_channel->GetReader(), frameKind));
 
     switch (frameKind) {  // NOLINT(clang-diagnostic-switch-enum)
-        case FrameKind::GetPortOk:
-            CheckResultWithMessage(protocol->ReadGetPortOk(channel->GetReader(), port), "Could not receive port ok frame.");
+        case FrameKind::Ok:
+            CheckResultWithMessage(_protocol->ReadOk(_channel->GetReader()), "Could not read ok frame.");
             return CreateOk();
         case FrameKind::Error: {
-            std::string errorMessage;
-            CheckResultWithMessage(protocol->ReadError(channel->GetReader(), errorMessage), "Could not read error frame.");
-            LogError(errorMessage);
+            std::string errorString;
+            CheckResultWithMessage(_protocol->ReadError(_channel->GetReader(), errorString), "Could not read error frame.");
+            LogError(errorString);
             return CreateError();
         }
         default:
-            LogError("PortMapperGetPort: Received unexpected frame '{}'.", frameKind);
+            LogError("{}: Received unexpected frame '{}'.", callerName, frameKind);
             return CreateError();
     }
 }
 
-[[nodiscard]] Result PortMapperSetPort(std::string_view name, uint16_t port) {
+[[nodiscard]] Result CreatePortMapperClient(const std::string& ipAddress, std::unique_ptr<PortMapperClient>& portMapperClient) {
     std::unique_ptr<Channel> channel;
+    CheckResult(TryConnectToTcpChannel(ipAddress, GetPortMapperPort(), 0, ClientTimeoutInMilliseconds, channel));
+
     std::unique_ptr<IProtocol> protocol;
-    CheckResult(ConnectToPortMapper("127.0.0.1", channel, protocol));
+    CheckResult(CreateProtocol(ProtocolVersion1, protocol));
+    portMapperClient = std::make_unique<PortMapperClient>(std::move(channel), std::move(protocol));
+    return CreateOk();
+}
+
+namespace {
 
-    CheckResultWithMessage(protocol->SendSetPort(channel->GetWriter(), name, port), "Could not send set port frame.");
-    return ReadOkOrError(*protocol, *channel, "PortMapperSetPort");
+// Keeps one connection per port mapper address. All requests are idempotent, so a request over a connection, which the port
+// mapper closed in the meantime, is simply repeated over a new one
+class PortMapperClientCache final {
+public:
+    PortMapperClientCache() = default;
+    ~PortMapperClientCache() noexcept = default;
+
+    PortMapperClientCache(const PortMapperClientCache&) = delete;
+    PortMapperClientCache& operator=(const PortMapperClientCache&) = delete;
+
+    PortMapperClientCache(PortMapperClientCache&&) = delete;
+    PortMapperClientCache& operator=(PortMapperClientCache&&) = delete;
+
+    template <typename Function>
+    [[nodiscard]] Result Run(const std::string& ipAddress, const Function& function) {
+        std::lock_guard lock(_mutex);
+
+        std::unique_ptr<PortMapperClient>& client = _clients[ipAddress];
+        if (client) {
+            Result result = function(*client);
+            if (!IsNotConnected(result)) {
+                return result;
+            }
+
+            client.reset();
+        }
+
+        CheckResult(CreatePortMapperClient(ipAddress, client));
+        Result result = function(*client);
+        if (IsNotConnected(result)) {
+            client.reset();
+        }
+
+        return result;
+    }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<PortMapperClient>> _clients;
+};
+
+[[nodiscard]] PortMapperClientCache& GetPortMapperClientCache() {
+    static PortMapperClientCache cache;
+    return cache;
 }
 
-[[nodiscard]] Result PortMapperUnsetPort(std::string_view name) {
-    std::unique_ptr<Channel> channel;
-    std::unique_ptr<IProtocol> protocol;
-    CheckResult(ConnectToPortMapper("127.0.0.1", channel, protocol));
+}  // namespace
 
-    CheckResultWithMessage(protocol->SendUnsetPort(channel->GetWriter(), name), "Could not send unset port frame.");
-    return ReadOkOrError(*protocol, *channel, "PortMapperUnsetPort");
+[[nodiscard]] Result PortMapperGetPort(const std::string& ipAddress, std::string_view serverName, uint16_t& port) {
+    if (IsPortMapperClientVerbose()) {
+        LogTrace("PortMapperGetPort(ipAddress: '{}', serverName: '{}')", ipAddress, serverName);
+    }
+
+    return GetPortMapperClientCache().Run(ipAddress, [&](const PortMapperClient& client) {
+        return client.GetPort(serverName, port);
+    });
+}
+
+[[nodiscard]] Result PortMapperGetPorts(const std::string& ipAddress, const std::vector<std::string>& serverNames, std::vector<uint16_t>& ports) {
+    if (IsPortMapperClientVerbose()) {
+        LogTrace("PortMapperGetPorts(ipAddress: '{}', serverNames: {})", ipAddress, serverNames.size());
+    }
+
+    return GetPortMapperClientCache().Run(ipAddress, [&](const PortMapperClient& client) {
+        return client.GetPorts(serverNames, ports);
+    });
+}
+
+[[nodiscard]] Result PortMapperSetPort(std::string_view name, uint16_t port) {
+    return GetPortMapperClientCache().Run("127.0.0.1", [&](const PortMapperClient& client) {
+        return client.SetPort(name, port);
+    });
+}
+
+[[nodiscard]] Result PortMapperSetPorts(const std::vector<PortMapperEntry>& entries) {
+    return GetPortMapperClientCache().Run("127.0.0.1", [&](const PortMapperClient& client) {
+        return client.SetPorts(entries);
+    });
+}
+
+[[nodiscard]] Result PortMapperUnsetPort(std::string_view name) {
+    return GetPortMapperClientCache().Run("127.0.0.1", [&](const PortMapperClient& client) {
+        return client.UnsetPort(name);
+    });
 }
 
 }  // namespace DsVeosCoSim
@@ -2,20 +2,24 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "Channel.hpp"
 #include "Event.hpp"
+#include "Poller.hpp"
 #include "Protocol.hpp"
 #include "Result.hpp"
 
 namespace DsVeosCoSim {
 
+// Serves any number of clients on one thread. A client can send several requests over the same connection
 class PortMapperServer final {
 public:
     PortMapperServer(std::unique_ptr<ChannelServer> channelServer, std::unique_ptr<IProtocol> protocol);
@@ -27,26 +31,74 @@ public:
     PortMapperServer(PortMapperServer&&) = delete;
     PortMapperServer& operator=(PortMapperServer&&) = delete;
 
+    [[nodiscard]] Result Start();
+
 private:
     void RunPortMapperServer();
-    [[nodiscard]] Result CheckForClient();
+    [[nodiscard]] Result WaitForActivity();
+    [[nodiscard]] Result AcceptClients();
+    void HandleClients();
     [[nodiscard]] Result HandleClient(Channel& channel);
     [[nodiscard]] Result HandleGetPort(Channel& channel);
+    [[nodiscard]] Result HandleGetPorts(Channel& channel);
     [[nodiscard]] Result HandleSetPort(Channel& channel);
+    [[nodiscard]] Result HandleSetPorts(Channel& channel);
     [[nodiscard]] Result HandleUnsetPort(Channel& channel);
     void DumpEntries();
 
     std::unordered_map<std::string, uint16_t> _ports;
     std::unique_ptr<ChannelServer> _server;
+    std::vector<std::unique_ptr<Channel>> _clients;
     std::thread _thread;
+    std::atomic<bool> _isStopping{};
+#ifdef _WIN32
     Event _stopEvent;
+#else
+    Poller _poller;
+    int32_t _stopFd = -1;
+    bool _isPollerOutdated = true;
+#endif
     std::unique_ptr<IProtocol> _protocol;
+    std::vector<std::string> _serverNames;
+    std::vector<uint16_t> _foundPorts;
+    std::vector<PortMapperEntry> _entries;
 };
 
 [[nodiscard]] Result CreatePortMapperServer(bool enableRemoteAccess, std::unique_ptr<PortMapperServer>& portMapperServer);
 
+// Keeps the connection to a port mapper open for several requests
+class PortMapperClient final {
+public:
+    PortMapperClient(std::unique_ptr<Channel> channel, std::unique_ptr<IProtocol> protocol);
+    ~PortMapperClient() noexcept = default;
+
+    PortMapperClient(const PortMapperClient&) = delete;
+    PortMapperClient& operator=(const PortMapperClient&) = delete;
+
+    PortMapperClient(PortMapperClient&&) = delete;
+    PortMapperClient& operator=(PortMapperClient&&) = delete;
+
+    [[nodiscard]] Result GetPort(std::string_view serverName, uint16_t& port) const;
+    // Unknown servers get port 0
+    [[nodiscard]] Result GetPorts(const std::vector<std::string>& serverNames, std::vector<uint16_t>& ports) const;
+    [[nodiscard]] Result SetPort(std::string_view serverName, uint16_t port) const;
+    [[nodiscard]] Result SetPorts(const std::vector<PortMapperEntry>& entries) const;
+    [[nodiscard]] Result UnsetPort(std::string_view serverName) const;
+
+private:
+    [[nodiscard]] Result ReadOkOrError(std::string_view callerName) const;
+
+    std::unique_ptr<Channel> _channel;
+    std::unique_ptr<IProtocol> _protocol;
+};
+
+[[nodiscard]] Result CreatePortMapperClient(const std::string& ipAddress, std::unique_ptr<PortMapperClient>& portMapperClient);
+
+// These reuse one connection per port mapper address for the whole process
 [[nodiscard]] Result PortMapperGetPort(const std::string& ipAddress, std::string_view serverName, uint16_t& port);
+[[nodiscard]] Result PortMapperGetPorts(const std::string& ipAddress, const std::vector<std::string>& serverNames, std::vector<uint16_t>& ports);
 [[nodiscard]] Result PortMapperSetPort(std::string_view name, uint16_t port);
+[[nodiscard]] Result PortMapperSetPorts(const std::vector<PortMapperEntry>& entries);
 [[nodiscard]] Result PortMapperUnsetPort(std::string_view name);
 
 }  // namespace DsVeosCoSim
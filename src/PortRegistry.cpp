@@ -0,0 +1,305 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include "PortRegistry.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include "Environment.hpp"
+#include "Logger.hpp"
+#include "OsUtilities.hpp"
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+namespace {
+
+constexpr uint32_t PortRegistryLayoutVersion = 2;
+constexpr size_t PortRegistryEntryCount = 1024;
+constexpr size_t MaxServerNameLength = 240;
+constexpr uint32_t MaxReadAttempts = 100;
+
+// Only the process stored in pid writes the other fields. Readers use the sequence number to detect torn reads
+struct PortRegistryEntry {
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> pid;
+    std::atomic<uint32_t> registration;
+    std::atomic<uint16_t> port;
+    std::atomic<uint16_t> nameLength;
+    char name[MaxServerNameLength];
+};
+
+static_assert(sizeof(PortRegistryEntry) == 256);
+
+// A freshly created table is all zeros, which is a valid empty table
+struct PortRegistryTable {
+    alignas(64) std::atomic<uint32_t> layoutVersion;
+    std::atomic<uint32_t> lastRegistration;
+    PortRegistryEntry entries[PortRegistryEntryCount];
+};
+
+struct EntrySnapshot {
+    uint32_t pid{};
+    uint32_t registration{};
+    uint16_t port{};
+    uint16_t nameLength{};
+    char name[MaxServerNameLength]{};
+
+    [[nodiscard]] std::string_view GetName() const {
+        return {name, nameLength};
+    }
+};
+
+[[nodiscard]] bool TryRead(const PortRegistryEntry& entry, EntrySnapshot& snapshot) {
+    for (uint32_t attempt = 0; attempt < MaxReadAttempts; attempt++) {
+        uint32_t sequence = entry.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1U) != 0) {
+            CpuRelax();
+            continue;
+        }
+
+        snapshot.pid = entry.pid.load(std::memory_order_relaxed);
+        snapshot.registration = entry.registration.load(std::memory_order_relaxed);
+        snapshot.port = entry.port.load(std::memory_order_relaxed);
+        snapshot.nameLength = std::min<uint16_t>(entry.nameLength.load(std::memory_order_relaxed), MaxServerNameLength);
+        std::memcpy(snapshot.name, entry.name, snapshot.nameLength);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry.sequence.load(std::memory_order_relaxed) == sequence) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Must only be called by the process stored in pid. A writer, which died in between, left an odd sequence number behind
+[[nodiscard]] uint32_t BeginWrite(PortRegistryEntry& entry) {
+    uint32_t sequence = entry.sequence.load(std::memory_order_relaxed) | 1U;
+    entry.sequence.store(sequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return sequence;
+}
+
+// Claimers of an entry race with each other, so only one of them may make the sequence number odd. Entries with an odd
+// sequence number are skipped, even if their writer died while writing
+[[nodiscard]] bool TryBeginClaim(PortRegistryEntry& entry, uint32_t& sequence) {
+    sequence = entry.sequence.load(std::memory_order_relaxed);
+    if (((sequence & 1U) != 0) || !entry.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    sequence++;
+    return true;
+}
+
+void WriteFields(PortRegistryEntry& entry, std::string_view serverName, uint16_t port, uint32_t registration) {
+    entry.registration.store(registration, std::memory_order_relaxed);
+    entry.port.store(port, std::memory_order_relaxed);
+    entry.nameLength.store(static_cast<uint16_t>(serverName.size()), std::memory_order_relaxed);
+    std::memcpy(entry.name, serverName.data(), serverName.size());
+}
+
+void EndWrite(PortRegistryEntry& entry, uint32_t sequence) {
+    entry.sequence.store(sequence + 1, std::memory_order_release);
+}
+
+void Write(PortRegistryEntry& entry, std::string_view serverName, uint16_t port, uint32_t registration) {
+    uint32_t sequence = BeginWrite(entry);
+    WriteFields(entry, serverName, port, registration);
+    EndWrite(entry, sequence);
+}
+
+void Release(PortRegistryEntry& entry) {
+    Write(entry, {}, 0, 0);
+    entry.pid.store(0, std::memory_order_release);
+}
+
+// Registration numbers wrap around, so they are compared by their distance
+[[nodiscard]] bool IsNewer(uint32_t registration, uint32_t otherRegistration) {
+    return static_cast<int32_t>(registration - otherRegistration) > 0;
+}
+
+[[nodiscard]] bool IsAlive(uint32_t pid) {
+    return (pid == GetCurrentProcessIdCached()) || IsProcessRunning(OpenProcessHandle(pid));
+}
+
+class PortRegistry final {
+public:
+    [[nodiscard]] Result SetPort(std::string_view serverName, uint16_t port) {
+        if (serverName.size() > MaxServerNameLength) {
+            LogTrace("Server name '{}' is too long for the port registry.", serverName);
+            return CreateError();
+        }
+
+        std::scoped_lock lock(_mutex);
+        CheckResult(EnsureOpened());
+
+        // Like the port mapper, lookups return the most recent registration of a server name
+        uint32_t registration = _table->lastRegistration.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        uint32_t ownPid = GetCurrentProcessIdCached();
+        PortRegistryEntry* ownEntry = FindOwnEntry(serverName);
+        if (ownEntry != nullptr) {
+            Write(*ownEntry, serverName, port, registration);
+            return CreateOk();
+        }
+
+        // Free entries are preferred, since checking for stale entries needs a system call per entry
+        for (bool reuseStaleEntries : {false, true}) {
+            for (PortRegistryEntry& entry : _table->entries) {
+                uint32_t pid = entry.pid.load(std::memory_order_acquire);
+                bool isClaimable = (pid == 0) || (reuseStaleEntries && !IsAlive(pid));
+                uint32_t sequence{};
+                if (!isClaimable || !TryBeginClaim(entry, sequence)) {
+                    continue;
+                }
+
+                // Readers ignore the entry until the claim ends, so they never see the new pid with the old name and port
+                if (entry.pid.compare_exchange_strong(pid, ownPid)) {
+                    WriteFields(entry, serverName, port, registration);
+                    EndWrite(entry, sequence);
+                    return CreateOk();
+                }
+
+                EndWrite(entry, sequence);
+            }
+        }
+
+        LogTrace("Port registry is full.");
+        return CreateError();
+    }
+
+    [[nodiscard]] Result UnsetPort(std::string_view serverName) {
+        std::scoped_lock lock(_mutex);
+        CheckResult(EnsureOpened());
+
+        PortRegistryEntry* ownEntry = FindOwnEntry(serverName);
+        if (ownEntry != nullptr) {
+            Release(*ownEntry);
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result GetPort(std::string_view serverName, uint16_t& port) {
+        const PortRegistryTable* table{};
+        {
+            std::scoped_lock lock(_mutex);
+            CheckResult(EnsureOpened());
+            table = _table;
+        }
+
+        bool found = false;
+        uint32_t newestRegistration{};
+        for (const PortRegistryEntry& entry : table->entries) {
+            if (entry.pid.load(std::memory_order_acquire) == 0) {
+                continue;
+            }
+
+            EntrySnapshot snapshot;
+            if (!TryRead(entry, snapshot) || (snapshot.pid == 0) || (snapshot.GetName() != serverName)) {
+                continue;
+            }
+
+            if (found && !IsNewer(snapshot.registration, newestRegistration)) {
+                continue;
+            }
+
+            if (IsAlive(snapshot.pid)) {
+                port = snapshot.port;
+                newestRegistration = snapshot.registration;
+                found = true;
+            }
+        }
+
+        return found ? CreateOk() : CreateNotConnected();
+    }
+
+private:
+    [[nodiscard]] PortRegistryEntry* FindOwnEntry(std::string_view serverName) const {
+        uint32_t ownPid = GetCurrentProcessIdCached();
+        for (PortRegistryEntry& entry : _table->entries) {
+            if (entry.pid.load(std::memory_order_acquire) != ownPid) {
+                continue;
+            }
+
+            EntrySnapshot snapshot;
+            if (TryRead(entry, snapshot) && (snapshot.GetName() == serverName)) {
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] Result EnsureOpened() {
+        if (_table != nullptr) {
+            return CreateOk();
+        }
+
+        if (_isUnavailable) {
+            return CreateNotConnected();
+        }
+
+        // Each port mapper port is a separate namespace of server names. Tables of other layouts are left to their users
+        std::string name = fmt::format("PortRegistry.{}.{}", GetPortMapperPort(), PortRegistryLayoutVersion);
+        Result result = SharedMemory::CreateOrOpen(name, sizeof(PortRegistryTable), _sharedMemory);
+        if (!IsOk(result)) {
+            _isUnavailable = true;
+            return result;
+        }
+
+#ifndef _WIN32
+        _sharedMemory.Persist();
+#endif
+
+        auto* table = _sharedMemory.As<PortRegistryTable>();
+        uint32_t layoutVersion = 0;
+        if (!table->layoutVersion.compare_exchange_strong(layoutVersion, PortRegistryLayoutVersion) &&
+            (layoutVersion != PortRegistryLayoutVersion)) {
+            LogTrace("Port registry has the unsupported layout version {}.", layoutVersion);
+            _sharedMemory.Close();
+            _isUnavailable = true;
+            return CreateNotConnected();
+        }
+
+        _table = table;
+        return CreateOk();
+    }
+
+    std::mutex _mutex;
+    SharedMemory _sharedMemory;
+    PortRegistryTable* _table{};
+    bool _isUnavailable{};
+};
+
+[[nodiscard]] PortRegistry& GetPortRegistry() {
+    static PortRegistry registry;
+    return registry;
+}
+
+}  // namespace
+
+[[nodiscard]] Result PortRegistrySetPort(std::string_view serverName, uint16_t port) {
+    return GetPortRegistry().SetPort(serverName, port);
+}
+
+[[nodiscard]] Result PortRegistryUnsetPort(std::string_view serverName) {
+    return GetPortRegistry().UnsetPort(serverName);
+}
+
+[[nodiscard]] Result PortRegistryGetPort(std::string_view serverName, uint16_t& port) {
+    return GetPortRegistry().GetPort(serverName, port);
+}
+
+}  // namespace DsVeosCoSim
@@ -0,0 +1,20 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+// Host wide table of the TCP ports of running servers in shared memory. Unlike the port mapper, lookups do not depend on any
+// other process. Entries of processes, which exited without unregistering, are ignored and reused
+[[nodiscard]] Result PortRegistrySetPort(std::string_view serverName, uint16_t port);
+[[nodiscard]] Result PortRegistryUnsetPort(std::string_view serverName);
+
+// Returns not connected, if no running process registered the server
+[[nodiscard]] Result PortRegistryGetPort(std::string_view serverName, uint16_t& port);
+
+}  // namespace DsVeosCoSim
@@ -16,6 +16,7 @@
 #include "Environment.hpp"
 #include "Logger.hpp"
 #include "Result.hpp"
+#include "StepCodec.hpp"
 
 namespace DsVeosCoSim {
 
@@ -26,158 +27,76 @@ constexpr size_t CanControllerSize = sizeof(BusControllerId) + sizeof(uint32_t)
 constexpr size_t EthControllerSize = sizeof(BusControllerId) + sizeof(uint32_t) + sizeof(uint64_t) + EthAddressLength;
 constexpr size_t LinControllerSize = sizeof(BusControllerId) + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(LinControllerType);
 constexpr size_t FrControllerSize = sizeof(BusControllerId) + sizeof(uint32_t) + sizeof(uint64_t);
-constexpr size_t CanMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(BusMessageId) + sizeof(CanMessageFlags) + sizeof(uint32_t);
-constexpr size_t EthMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(EthMessageFlags) + sizeof(uint32_t);
-constexpr size_t LinMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(BusMessageId) + sizeof(LinMessageFlags) + sizeof(uint32_t);
-constexpr size_t FrMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(BusMessageId) + sizeof(FrMessageFlags) + sizeof(uint32_t);
 
 class ProtocolV1 : public IProtocol {  // NOLINT(misc-use-internal-linkage)
 public:
     [[nodiscard]] Result ReadSize(ChannelReader& reader, size_t& size) override {
-        uint32_t intSize{};
-        CheckResultWithMessage(reader.Read(intSize), "Could not read size.");
-        size = static_cast<size_t>(intSize);
+        CheckResultWithMessage(FixedStepCodec::ReadSize(reader, size), "Could not read size.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteSize(ChannelWriter& writer, size_t size) override {
-        if (size > UINT32_MAX) {
-            LogError("Size exceeds maximum supported value.");
-            return CreateError();
-        }
-
-        auto intSize = static_cast<uint32_t>(size);
-        CheckResultWithMessage(writer.Write(intSize), "Could not write size.");
+        CheckResultWithMessage(FixedStepCodec::WriteSize(writer, size), "Could not write size.");
         return CreateOk();
     }
 
     [[nodiscard]] Result ReadLength(ChannelReader& reader, uint32_t& length) override {
-        CheckResultWithMessage(reader.Read(length), "Could not read length.");
+        CheckResultWithMessage(FixedStepCodec::ReadLength(reader, length), "Could not read length.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteLength(ChannelWriter& writer, uint32_t length) override {
-        CheckResultWithMessage(writer.Write(length), "Could not write length.");
+        CheckResultWithMessage(FixedStepCodec::WriteLength(writer, length), "Could not write length.");
         return CreateOk();
     }
 
     [[nodiscard]] Result ReadData(ChannelReader& reader, void* data, size_t size) override {
-        CheckResultWithMessage(reader.Read(data, size), "Could not read data.");
+        CheckResultWithMessage(FixedStepCodec::ReadData(reader, data, size), "Could not read data.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteData(ChannelWriter& writer, const void* data, size_t size) override {
-        CheckResultWithMessage(writer.Write(data, size), "Could not write data.");
+        CheckResultWithMessage(FixedStepCodec::WriteData(writer, data, size), "Could not write data.");
         return CreateOk();
     }
 
     [[nodiscard]] Result ReadSignalId(ChannelReader& reader, IoSignalId& signalId) override {
-        CheckResultWithMessage(reader.Read(signalId), "Could not read signal id.");
+        CheckResultWithMessage(FixedStepCodec::ReadSignalId(reader, signalId), "Could not read signal id.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteSignalId(ChannelWriter& writer, IoSignalId signalId) override {
-        CheckResultWithMessage(writer.Write(signalId), "Could not write signal id.");
+        CheckResultWithMessage(FixedStepCodec::WriteSignalId(writer, signalId), "Could not write signal id.");
         return CreateOk();
     }
 
     [[nodiscard]] Result ReadMessage(ChannelReader& reader, CanMessageContainer& messageContainer) override {
-        BlockReader blockReader;
-        CheckResultWithMessage(reader.ReadBlock(CanMessageSize, blockReader), "Could not read block for CanMessageContainer.");
-
-        ReadSimulationTime(blockReader, messageContainer.timestamp);
-        blockReader.Read(messageContainer.controllerId);
-        blockReader.Read(messageContainer.id);
-        blockReader.Read(messageContainer.flags);
-        blockReader.Read(messageContainer.length);
-        blockReader.EndRead();
-
-        if (messageContainer.length > CanMessageMaxLength) {
-            LogError("CAN message data exceeds maximum length.");
-            return CreateError();
-        }
-
-        CheckResultWithMessage(reader.Read(messageContainer.data.data(), messageContainer.length), "Could not read data.");
+        CheckResultWithMessage(FixedStepCodec::ReadMessage(reader, messageContainer), "Could not read CanMessageContainer.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const CanMessageContainer& messageContainer) override {
-        BlockWriter blockWriter;
-        CheckResultWithMessage(writer.Reserve(CanMessageSize + messageContainer.length, blockWriter), "Could not reserve memory for CanMessageContainer.");
-
-        WriteSimulationTime(blockWriter, messageContainer.timestamp);
-        blockWriter.Write(messageContainer.controllerId);
-        blockWriter.Write(messageContainer.id);
-        blockWriter.Write(messageContainer.flags);
-        blockWriter.Write(messageContainer.length);
-        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
-        blockWriter.EndWrite();
+        CheckResultWithMessage(FixedStepCodec::WriteMessage(writer, messageContainer), "Could not write CanMessageContainer.");
         return CreateOk();
     }
 
     [[nodiscard]] Result ReadMessage(ChannelReader& reader, EthMessageContainer& messageContainer) override {
-        BlockReader blockReader;
-        CheckResultWithMessage(reader.ReadBlock(EthMessageSize, blockReader), "Could not read block for EthMessageContainer.");
-
-        ReadSimulationTime(blockReader, messageContainer.timestamp);
-        blockReader.Read(messageContainer.controllerId);
-        blockReader.Read(messageContainer.flags);
-        blockReader.Read(messageContainer.length);
-        blockReader.EndRead();
-
-        if (messageContainer.length > EthMessageMaxLength) {
-            LogError("Ethernet message data exceeds maximum length.");
-            return CreateError();
-        }
-
-        CheckResultWithMessage(reader.Read(messageContainer.data.data(), messageContainer.length), "Could not read data.");
+        CheckResultWithMessage(FixedStepCodec::ReadMessage(reader, messageContainer), "Could not read EthMessageContainer.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const EthMessageContainer& messageContainer) override {
-        BlockWriter blockWriter;
-        CheckResultWithMessage(writer.Reserve(EthMessageSize + messageContainer.length, blockWriter), "Could not reserve memory for EthMessageContainer.");
-
-        WriteSimulationTime(blockWriter, messageContainer.timestamp);
-        blockWriter.Write(messageContainer.controllerId);
-        blockWriter.Write(messageContainer.flags);
-        blockWriter.Write(messageContainer.length);
-        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
-        blockWriter.EndWrite();
+        CheckResultWithMessage(FixedStepCodec::WriteMessage(writer, messageContainer), "Could not write EthMessageContainer.");
         return CreateOk();
     }
 
     [[nodiscard]] Result ReadMessage(ChannelReader& reader, LinMessageContainer& messageContainer) override {
-        BlockReader blockReader;
-        CheckResultWithMessage(reader.ReadBlock(LinMessageSize, blockReader), "Could not read block for LinMessageContainer.");
-
-        ReadSimulationTime(blockReader, messageContainer.timestamp);
-        blockReader.Read(messageContainer.controllerId);
-        blockReader.Read(messageContainer.id);
-        blockReader.Read(messageContainer.flags);
-        blockReader.Read(messageContainer.length);
-        blockReader.EndRead();
-
-        if (messageContainer.length > LinMessageMaxLength) {
-            LogError("LIN message data exceeds maximum length.");
-            return CreateError();
-        }
-
-        CheckResultWithMessage(reader.Read(messageContainer.data.data(), messageContainer.length), "Could not read data.");
+        CheckResultWithMessage(FixedStepCodec::ReadMessage(reader, messageContainer), "Could not read LinMessageContainer.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const LinMessageContainer& messageContainer) override {
-        BlockWriter blockWriter;
-        CheckResultWithMessage(writer.Reserve(LinMessageSize + messageContainer.length, blockWriter), "Could not reserve memory for LinMessageContainer.");
-
-        WriteSimulationTime(blockWriter, messageContainer.timestamp);
-        blockWriter.Write(messageContainer.controllerId);
-        blockWriter.Write(messageContainer.id);
-        blockWriter.Write(messageContainer.flags);
-        blockWriter.Write(messageContainer.length);
-        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
-        blockWriter.EndWrite();
+        CheckResultWithMessage(FixedStepCodec::WriteMessage(writer, messageContainer), "Could not write LinMessageContainer.");
         return CreateOk();
     }
 
@@ -399,11 +318,14 @@ public:
                                        std::vector<CanControllerContainer>& canControllers,
                                        std::vector<EthControllerContainer>& ethControllers,
                                        std::vector<LinControllerContainer>& linControllers,
-                                       [[maybe_unused]] std::vector<FrControllerContainer>& frControllers) override {
+                                       [[maybe_unused]] std::vector<FrControllerContainer>& frControllers,
+                                       uint32_t& maxFrameSize) override {
         if (IsProtocolTracingEnabled()) {
             LogProtBegin("ReadConnectOk()");
         }
 
+        maxFrameSize = BufferSize;
+
         constexpr size_t size = sizeof(clientMode) + sizeof(stepSize) + sizeof(simulationState);
 
         BlockReader blockReader;
@@ -448,7 +370,8 @@ public:
                                        const std::vector<CanControllerContainer>& canControllers,
                                        const std::vector<EthControllerContainer>& ethControllers,
                                        const std::vector<LinControllerContainer>& linControllers,
-                                       [[maybe_unused]] const std::vector<FrControllerContainer>& frControllers) override {
+                                       [[maybe_unused]] const std::vector<FrControllerContainer>& frControllers,
+                                       [[maybe_unused]] uint32_t maxFrameSize) override {
         if (IsProtocolTracingEnabled()) {
             LogProtBegin(
                 "SendConnectOk(ProtocolVersion: {}, ClientMode: {}, StepSize: {} s, SimulationState: {}, IncomingSignals: {}, OutgoingSignals: {}, "
@@ -489,6 +412,166 @@ public:
         return CreateOk();
     }
 
+    [[nodiscard]] Result ReadSession(ChannelReader& reader, uint64_t& sessionToken, uint32_t& resumeTimeoutInMilliseconds) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadSession()");
+        }
+
+        constexpr size_t size = sizeof(sessionToken) + sizeof(resumeTimeoutInMilliseconds);
+
+        BlockReader blockReader;
+        CheckResultWithMessage(reader.ReadBlock(size, blockReader), "Could not read block for Session frame.");
+
+        blockReader.Read(sessionToken);
+        blockReader.Read(resumeTimeoutInMilliseconds);
+        blockReader.EndRead();
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadSession(SessionToken: {}, ResumeTimeout: {} ms)", sessionToken, resumeTimeoutInMilliseconds);
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendSession(ChannelWriter& writer, uint64_t sessionToken, uint32_t resumeTimeoutInMilliseconds) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendSession(SessionToken: {}, ResumeTimeout: {} ms)", sessionToken, resumeTimeoutInMilliseconds);
+        }
+
+        constexpr size_t size = sizeof(FrameKind) + sizeof(sessionToken) + sizeof(resumeTimeoutInMilliseconds);
+
+        BlockWriter blockWriter;
+        CheckResultWithMessage(writer.Reserve(size, blockWriter), "Could not reserve memory for Session frame.");
+
+        blockWriter.Write(FrameKind::Session);
+        blockWriter.Write(sessionToken);
+        blockWriter.Write(resumeTimeoutInMilliseconds);
+        blockWriter.EndWrite();
+
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendSession()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadResume(ChannelReader& reader, uint64_t& sessionToken) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadResume()");
+        }
+
+        CheckResultWithMessage(reader.Read(sessionToken), "Could not read session token.");
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadResume(SessionToken: {})", sessionToken);
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendResume(ChannelWriter& writer, uint64_t sessionToken) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendResume(SessionToken: {})", sessionToken);
+        }
+
+        constexpr size_t size = sizeof(FrameKind) + sizeof(sessionToken);
+
+        BlockWriter blockWriter;
+        CheckResultWithMessage(writer.Reserve(size, blockWriter), "Could not reserve memory for Resume frame.");
+
+        blockWriter.Write(FrameKind::Resume);
+        blockWriter.Write(sessionToken);
+        blockWriter.EndWrite();
+
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendResume()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadGetCatalog(ChannelReader& reader, uint64_t& cachedCatalogHash) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadGetCatalog()");
+        }
+
+        CheckResultWithMessage(reader.Read(cachedCatalogHash), "Could not read cached catalog hash.");
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadGetCatalog(CachedCatalogHash: {})", cachedCatalogHash);
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendGetCatalog(ChannelWriter& writer, uint64_t cachedCatalogHash) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendGetCatalog(CachedCatalogHash: {})", cachedCatalogHash);
+        }
+
+        constexpr size_t size = sizeof(FrameKind) + sizeof(cachedCatalogHash);
+
+        BlockWriter blockWriter;
+        CheckResultWithMessage(writer.Reserve(size, blockWriter), "Could not reserve memory for GetCatalog frame.");
+
+        blockWriter.Write(FrameKind::GetCatalog);
+        blockWriter.Write(cachedCatalogHash);
+        blockWriter.EndWrite();
+
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendGetCatalog()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadCatalog(ChannelReader& reader, uint64_t& catalogHash, std::vector<uint8_t>& catalog) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadCatalog()");
+        }
+
+        CheckResultWithMessage(reader.Read(catalogHash), "Could not read catalog hash.");
+
+        size_t size{};
+        CheckResultWithMessage(ReadSize(reader, size), "Could not read catalog size.");
+        catalog.resize(size);
+        CheckResultWithMessage(reader.Read(catalog.data(), catalog.size()), "Could not read catalog.");
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadCatalog(CatalogHash: {}, CatalogSize: {})", catalogHash, catalog.size());
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendCatalog(ChannelWriter& writer, uint64_t catalogHash, const std::vector<uint8_t>& catalog) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendCatalog(CatalogHash: {}, CatalogSize: {})", catalogHash, catalog.size());
+        }
+
+        CheckResultWithMessage(writer.Write(FrameKind::Catalog), "Could not write frame kind.");
+        CheckResultWithMessage(writer.Write(catalogHash), "Could not write catalog hash.");
+        CheckResultWithMessage(WriteSize(writer, catalog.size()), "Could not write catalog size.");
+        CheckResultWithMessage(writer.Write(catalog.data(), catalog.size()), "Could not write catalog.");
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendCatalog()");
+        }
+
+        return CreateOk();
+    }
+
     [[nodiscard]] Result ReadStart(ChannelReader& reader, SimulationTime& simulationTime) override {
         if (IsProtocolTracingEnabled()) {
             LogProtBegin("ReadStart()");
@@ -689,6 +772,7 @@ public:
     }
 
     [[nodiscard]] Result ReadStep(ChannelReader& reader,
+                                  uint32_t& sequenceNumber,
                                   SimulationTime& simulationTime,
                                   const DeserializeFunction& deserializeIoData,
                                   const DeserializeFunction& deserializeBusMessages,
@@ -697,6 +781,7 @@ public:
             LogProtBegin("ReadStep()");
         }
 
+        sequenceNumber = 0;
         CheckResultWithMessage(ReadSimulationTime(reader, simulationTime), "Could not read simulation time.");
 
         if (callbacks.simulationBeginStepCallback) {
@@ -715,6 +800,7 @@ public:
     }
 
     [[nodiscard]] Result SendStep(ChannelWriter& writer,
+                                  [[maybe_unused]] uint32_t sequenceNumber,
                                   SimulationTime simulationTime,
                                   const SerializeFunction& serializeIoData,
                                   const SerializeFunction& serializeBusMessages) override {
@@ -743,6 +829,7 @@ public:
     }
 
     [[nodiscard]] Result ReadStepOk(ChannelReader& reader,
+                                    uint32_t& sequenceNumber,
                                     SimulationTime& nextSimulationTime,
                                     Command& command,
                                     const DeserializeFunction& deserializeIoData,
@@ -752,6 +839,7 @@ public:
             LogProtBegin("ReadStepOk()");
         }
 
+        sequenceNumber = 0;
         constexpr size_t size = sizeof(nextSimulationTime) + sizeof(command);
 
         BlockReader blockReader;
@@ -777,6 +865,7 @@ public:
     }
 
     [[nodiscard]] Result SendStepOk(ChannelWriter& writer,
+                                    [[maybe_unused]] uint32_t sequenceNumber,
                                     SimulationTime nextSimulationTime,
                                     Command command,
                                     const SerializeFunction& serializeIoData,
@@ -939,6 +1028,134 @@ public:
         return CreateOk();
     }
 
+    [[nodiscard]] Result ReadGetPorts(ChannelReader& reader, std::vector<std::string>& serverNames) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadGetPorts()");
+        }
+
+        size_t size{};
+        CheckResultWithMessage(ReadSize(reader, size), "Could not read server names count.");
+
+        serverNames.resize(size);
+        for (auto& serverName : serverNames) {
+            CheckResultWithMessage(ReadString(reader, serverName), "Could not read server name.");
+        }
+
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadGetPorts(Count: {})", serverNames.size());
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendGetPorts(ChannelWriter& writer, const std::vector<std::string>& serverNames) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendGetPorts(Count: {})", serverNames.size());
+        }
+
+        CheckResultWithMessage(writer.Write(FrameKind::GetPorts), "Could not write frame kind.");
+        CheckResultWithMessage(WriteSize(writer, serverNames.size()), "Could not write server names count.");
+        for (const auto& serverName : serverNames) {
+            CheckResultWithMessage(WriteString(writer, serverName), "Could not write server name.");
+        }
+
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendGetPorts()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadGetPortsOk(ChannelReader& reader, std::vector<uint16_t>& ports) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadGetPortsOk()");
+        }
+
+        size_t size{};
+        CheckResultWithMessage(ReadSize(reader, size), "Could not read ports count.");
+
+        ports.resize(size);
+        for (auto& port : ports) {
+            CheckResultWithMessage(reader.Read(port), "Could not read port.");
+        }
+
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadGetPortsOk(Count: {})", ports.size());
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendGetPortsOk(ChannelWriter& writer, const std::vector<uint16_t>& ports) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendGetPortsOk(Count: {})", ports.size());
+        }
+
+        CheckResultWithMessage(writer.Write(FrameKind::GetPortsOk), "Could not write frame kind.");
+        CheckResultWithMessage(WriteSize(writer, ports.size()), "Could not write ports count.");
+        for (uint16_t port : ports) {
+            CheckResultWithMessage(writer.Write(port), "Could not write port.");
+        }
+
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendGetPortsOk()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadSetPorts(ChannelReader& reader, std::vector<PortMapperEntry>& entries) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadSetPorts()");
+        }
+
+        size_t size{};
+        CheckResultWithMessage(ReadSize(reader, size), "Could not read entries count.");
+
+        entries.resize(size);
+        for (auto& entry : entries) {
+            CheckResultWithMessage(ReadString(reader, entry.serverName), "Could not read server name.");
+            CheckResultWithMessage(reader.Read(entry.port), "Could not read port.");
+        }
+
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadSetPorts(Count: {})", entries.size());
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendSetPorts(ChannelWriter& writer, const std::vector<PortMapperEntry>& entries) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendSetPorts(Count: {})", entries.size());
+        }
+
+        CheckResultWithMessage(writer.Write(FrameKind::SetPorts), "Could not write frame kind.");
+        CheckResultWithMessage(WriteSize(writer, entries.size()), "Could not write entries count.");
+        for (const auto& entry : entries) {
+            CheckResultWithMessage(WriteString(writer, entry.serverName), "Could not write server name.");
+            CheckResultWithMessage(writer.Write(entry.port), "Could not write port.");
+        }
+
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendSetPorts()");
+        }
+
+        return CreateOk();
+    }
+
     [[nodiscard]] uint32_t GetVersion() override {
         return ProtocolVersion1;
     }
@@ -947,6 +1164,18 @@ public:
         return false;
     }
 
+    [[nodiscard]] bool DoDenseSignalUpdates() override {
+        return false;
+    }
+
+    [[nodiscard]] bool DoDeltaSignalUpdates() override {
+        return false;
+    }
+
+    [[nodiscard]] StepContext GetStepContext() override {
+        return {};
+    }
+
 protected:
     [[nodiscard]] static Result ReadSimulationTime(ChannelReader& reader, SimulationTime& simulationTime) {
         uint64_t tmpValue{};
@@ -1212,7 +1441,7 @@ protected:
     }
 };
 
-class ProtocolV2 final : public ProtocolV1 {  // NOLINT(misc-use-internal-linkage)
+class ProtocolV2 : public ProtocolV1 {  // NOLINT(misc-use-internal-linkage)
 public:
     [[nodiscard]] Result ReadConnectOk(ChannelReader& reader,
                                        Mode& clientMode,
@@ -1223,11 +1452,14 @@ public:
                                        std::vector<CanControllerContainer>& canControllers,
                                        std::vector<EthControllerContainer>& ethControllers,
                                        std::vector<LinControllerContainer>& linControllers,
-                                       std::vector<FrControllerContainer>& frControllers) override {
+                                       std::vector<FrControllerContainer>& frControllers,
+                                       uint32_t& maxFrameSize) override {
         if (IsProtocolTracingEnabled()) {
             LogProtBegin("ReadConnectOk()");
         }
 
+        maxFrameSize = BufferSize;
+
         constexpr size_t size = sizeof(clientMode) + sizeof(stepSize) + sizeof(simulationState);
 
         BlockReader blockReader;
@@ -1274,7 +1506,8 @@ public:
                                        const std::vector<CanControllerContainer>& canControllers,
                                        const std::vector<EthControllerContainer>& ethControllers,
                                        const std::vector<LinControllerContainer>& linControllers,
-                                       const std::vector<FrControllerContainer>& frControllers) override {
+                                       const std::vector<FrControllerContainer>& frControllers,
+                                       [[maybe_unused]] uint32_t maxFrameSize) override {
         if (IsProtocolTracingEnabled()) {
             LogProtBegin(
                 "SendConnectOk(ProtocolVersion: {}, ClientMode: {}, StepSize: {} s, SimulationState: {}, IncomingSignals: {}, OutgoingSignals: {}, "
@@ -1417,41 +1650,467 @@ public:
     }
 
     [[nodiscard]] Result ReadMessage(ChannelReader& reader, FrMessageContainer& messageContainer) override {
-        BlockReader blockReader;
-        CheckResultWithMessage(reader.ReadBlock(FrMessageSize, blockReader), "Could not read block for FrMessageContainer.");
-
-        ReadSimulationTime(blockReader, messageContainer.timestamp);
-        blockReader.Read(messageContainer.controllerId);
-        blockReader.Read(messageContainer.id);
-        blockReader.Read(messageContainer.flags);
-        blockReader.Read(messageContainer.length);
-        blockReader.EndRead();
-
-        if (messageContainer.length > FrMessageMaxLength) {
-            LogError("FlexRay message data exceeds maximum length.");
-            return CreateError();
-        }
-
-        CheckResultWithMessage(reader.Read(messageContainer.data.data(), messageContainer.length), "Could not read data.");
+        CheckResultWithMessage(FixedStepCodec::ReadMessage(reader, messageContainer), "Could not read FrMessageContainer.");
         return CreateOk();
     }
 
     [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const FrMessageContainer& messageContainer) override {
-        BlockWriter blockWriter;
-        CheckResultWithMessage(writer.Reserve(FrMessageSize + messageContainer.length, blockWriter), "Could not reserve memory for FrMessageContainer.");
-
-        WriteSimulationTime(blockWriter, messageContainer.timestamp);
-        blockWriter.Write(messageContainer.controllerId);
-        blockWriter.Write(messageContainer.id);
-        blockWriter.Write(messageContainer.flags);
-        blockWriter.Write(messageContainer.length);
-        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
-        blockWriter.EndWrite();
+        CheckResultWithMessage(FixedStepCodec::WriteMessage(writer, messageContainer), "Could not write FrMessageContainer.");
         return CreateOk();
     }
 };
 
-[[nodiscard]] Result CreateProtocol(uint32_t negotiatedVersion, std::unique_ptr<IProtocol>& protocol) {
+class ProtocolV3 : public ProtocolV2 {  // NOLINT(misc-use-internal-linkage)
+public:
+    [[nodiscard]] Result ReadConnectOk(ChannelReader& reader,
+                                       Mode& clientMode,
+                                       SimulationTime& stepSize,
+                                       SimulationState& simulationState,
+                                       std::vector<IoSignalContainer>& incomingSignals,
+                                       std::vector<IoSignalContainer>& outgoingSignals,
+                                       std::vector<CanControllerContainer>& canControllers,
+                                       std::vector<EthControllerContainer>& ethControllers,
+                                       std::vector<LinControllerContainer>& linControllers,
+                                       std::vector<FrControllerContainer>& frControllers,
+                                       uint32_t& maxFrameSize) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadConnectOk()");
+        }
+
+        constexpr size_t size = sizeof(clientMode) + sizeof(stepSize) + sizeof(simulationState) + sizeof(maxFrameSize);
+
+        BlockReader blockReader;
+        CheckResultWithMessage(reader.ReadBlock(size, blockReader), "Could not read block for ConnectOk frame.");
+
+        blockReader.Read(clientMode);
+        ReadSimulationTime(blockReader, stepSize);
+        blockReader.Read(simulationState);
+        blockReader.Read(maxFrameSize);
+        blockReader.EndRead();
+
+        CheckResultWithMessage(ReadIoSignalInfos(reader, incomingSignals), "Could not read incoming signals.");
+        CheckResultWithMessage(ReadIoSignalInfos(reader, outgoingSignals), "Could not read outgoing signals.");
+        CheckResultWithMessage(ProtocolV1::ReadControllerInfos(reader, canControllers), "Could not read CAN controllers.");
+        CheckResultWithMessage(ProtocolV1::ReadControllerInfos(reader, ethControllers), "Could not read Ethernet controllers.");
+        CheckResultWithMessage(ProtocolV1::ReadControllerInfos(reader, linControllers), "Could not read LIN controllers.");
+        CheckResultWithMessage(ReadControllerInfos(reader, frControllers), "Could not read FlexRay controllers.");
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd(
+                "ClientMode: {}, StepSize: {} s, SimulationState: {}, MaxFrameSize: {}, IncomingSignals: {}, OutgoingSignals: {}, CanControllers: {}, "
+                "EthControllers: {}, LinControllers: {}, FrControllers: {})",
+                clientMode,
+                SimulationTimeToString(stepSize),
+                simulationState,
+                maxFrameSize,
+                incomingSignals,
+                outgoingSignals,
+                canControllers,
+                ethControllers,
+                linControllers,
+                frControllers);
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendConnectOk(ChannelWriter& writer,
+                                       uint32_t protocolVersion,
+                                       Mode clientMode,
+                                       SimulationTime stepSize,
+                                       SimulationState simulationState,
+                                       const std::vector<IoSignalContainer>& incomingSignals,
+                                       const std::vector<IoSignalContainer>& outgoingSignals,
+                                       const std::vector<CanControllerContainer>& canControllers,
+                                       const std::vector<EthControllerContainer>& ethControllers,
+                                       const std::vector<LinControllerContainer>& linControllers,
+                                       const std::vector<FrControllerContainer>& frControllers,
+                                       uint32_t maxFrameSize) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin(
+                "SendConnectOk(ProtocolVersion: {}, ClientMode: {}, StepSize: {} s, SimulationState: {}, MaxFrameSize: {}, IncomingSignals: {}, "
+                "OutgoingSignals: {}, CanControllers: {}, EthControllers: {}, LinControllers: {}, FrControllers: {})",
+                protocolVersion,
+                clientMode,
+                SimulationTimeToString(stepSize),
+                simulationState,
+                maxFrameSize,
+                incomingSignals,
+                outgoingSignals,
+                canControllers,
+                ethControllers,
+                linControllers,
+                frControllers);
+        }
+
+        constexpr size_t size =
+            sizeof(FrameKind) + sizeof(protocolVersion) + sizeof(clientMode) + sizeof(stepSize) + sizeof(simulationState) + sizeof(maxFrameSize);
+
+        BlockWriter blockWriter;
+        CheckResultWithMessage(writer.Reserve(size, blockWriter), "Could not reserve memory for ConnectOk frame.");
+
+        blockWriter.Write(FrameKind::ConnectOk);
+        blockWriter.Write(protocolVersion);
+        blockWriter.Write(clientMode);
+        WriteSimulationTime(blockWriter, stepSize);
+        blockWriter.Write(simulationState);
+        blockWriter.Write(maxFrameSize);
+        blockWriter.EndWrite();
+
+        CheckResultWithMessage(WriteIoSignalInfos(writer, incomingSignals), "Could not write incoming signals.");
+        CheckResultWithMessage(WriteIoSignalInfos(writer, outgoingSignals), "Could not write outgoing signals.");
+        CheckResultWithMessage(ProtocolV1::WriteControllerInfos(writer, canControllers), "Could not write CAN controllers.");
+        CheckResultWithMessage(ProtocolV1::WriteControllerInfos(writer, ethControllers), "Could not write Ethernet controllers.");
+        CheckResultWithMessage(ProtocolV1::WriteControllerInfos(writer, linControllers), "Could not write LIN controllers.");
+        CheckResultWithMessage(WriteControllerInfos(writer, frControllers), "Could not write FlexRay controllers.");
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendConnectOk()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] uint32_t GetVersion() override {
+        return ProtocolVersion3;
+    }
+};
+
+class ProtocolV4 : public ProtocolV3 {  // NOLINT(misc-use-internal-linkage)
+public:
+    [[nodiscard]] Result ReadStep(ChannelReader& reader,
+                                  uint32_t& sequenceNumber,
+                                  SimulationTime& simulationTime,
+                                  const DeserializeFunction& deserializeIoData,
+                                  const DeserializeFunction& deserializeBusMessages,
+                                  const Callbacks& callbacks) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadStep()");
+        }
+
+        constexpr size_t size = sizeof(sequenceNumber) + sizeof(simulationTime);
+
+        BlockReader blockReader;
+        CheckResultWithMessage(reader.ReadBlock(size, blockReader), "Could not read block for Step frame.");
+
+        blockReader.Read(sequenceNumber);
+        ReadSimulationTime(blockReader, simulationTime);
+        blockReader.EndRead();
+
+        if (callbacks.simulationBeginStepCallback) {
+            callbacks.simulationBeginStepCallback(simulationTime);
+        }
+
+        BeginReadStepData(simulationTime);
+
+        CheckResultWithMessage(deserializeIoData(reader, simulationTime, callbacks), "Could not read IO buffer data.");
+        CheckResultWithMessage(deserializeBusMessages(reader, simulationTime, callbacks), "Could not read bus buffer data.");
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadStep(SequenceNumber: {}, SimulationTime: {} s)", sequenceNumber, SimulationTimeToString(simulationTime));
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendStep(ChannelWriter& writer,
+                                  uint32_t sequenceNumber,
+                                  SimulationTime simulationTime,
+                                  const SerializeFunction& serializeIoData,
+                                  const SerializeFunction& serializeBusMessages) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendStep(SequenceNumber: {}, SimulationTime: {} s)", sequenceNumber, SimulationTimeToString(simulationTime));
+        }
+
+        constexpr size_t size = sizeof(FrameKind) + sizeof(sequenceNumber) + sizeof(simulationTime);
+
+        BlockWriter blockWriter;
+        CheckResultWithMessage(writer.Reserve(size, blockWriter), "Could not reserve memory for Step frame.");
+
+        blockWriter.Write(FrameKind::Step);
+        blockWriter.Write(sequenceNumber);
+        WriteSimulationTime(blockWriter, simulationTime);
+        blockWriter.EndWrite();
+
+        BeginWriteStepData(simulationTime);
+
+        CheckResultWithMessage(serializeIoData(writer), "Could not write IO buffer data.");
+        CheckResultWithMessage(serializeBusMessages(writer), "Could not write bus buffer data.");
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendStep()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadStepOk(ChannelReader& reader,
+                                    uint32_t& sequenceNumber,
+                                    SimulationTime& nextSimulationTime,
+                                    Command& command,
+                                    const DeserializeFunction& deserializeIoData,
+                                    const DeserializeFunction& deserializeBusMessages,
+                                    const Callbacks& callbacks) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("ReadStepOk()");
+        }
+
+        constexpr size_t size = sizeof(sequenceNumber) + sizeof(nextSimulationTime) + sizeof(command);
+
+        BlockReader blockReader;
+        CheckResultWithMessage(reader.ReadBlock(size, blockReader), "Could not read block for StepOk frame.");
+
+        blockReader.Read(sequenceNumber);
+        ReadSimulationTime(blockReader, nextSimulationTime);
+        blockReader.Read(command);
+        blockReader.EndRead();
+
+        if (callbacks.simulationBeginStepCallback) {
+            callbacks.simulationBeginStepCallback(nextSimulationTime);
+        }
+
+        BeginReadStepData(nextSimulationTime);
+
+        CheckResultWithMessage(deserializeIoData(reader, nextSimulationTime, callbacks), "Could not read IO buffer data.");
+        CheckResultWithMessage(deserializeBusMessages(reader, nextSimulationTime, callbacks), "Could not read bus buffer data.");
+        reader.EndRead();
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("ReadStepOk(SequenceNumber: {}, NextSimulationTime: {} s, Command: {})",
+                       sequenceNumber,
+                       SimulationTimeToString(nextSimulationTime),
+                       command);
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result SendStepOk(ChannelWriter& writer,
+                                    uint32_t sequenceNumber,
+                                    SimulationTime nextSimulationTime,
+                                    Command command,
+                                    const SerializeFunction& serializeIoData,
+                                    const SerializeFunction& serializeBusMessages) override {
+        if (IsProtocolTracingEnabled()) {
+            LogProtBegin("SendStepOk(SequenceNumber: {}, NextSimulationTime: {} s, Command: {})",
+                         sequenceNumber,
+                         SimulationTimeToString(nextSimulationTime),
+                         command);
+        }
+
+        constexpr size_t size = sizeof(FrameKind) + sizeof(sequenceNumber) + sizeof(nextSimulationTime) + sizeof(command);
+
+        BlockWriter blockWriter;
+        CheckResultWithMessage(writer.Reserve(size, blockWriter), "Could not reserve memory for StepOk frame.");
+
+        blockWriter.Write(FrameKind::StepOk);
+        blockWriter.Write(sequenceNumber);
+        WriteSimulationTime(blockWriter, nextSimulationTime);
+        blockWriter.Write(command);
+        blockWriter.EndWrite();
+
+        BeginWriteStepData(nextSimulationTime);
+
+        CheckResultWithMessage(serializeIoData(writer), "Could not write IO buffer data.");
+        CheckResultWithMessage(serializeBusMessages(writer), "Could not write bus buffer data.");
+        CheckResultWithMessage(writer.EndWrite(), "Could not finish frame.");
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtEnd("SendStepOk()");
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] uint32_t GetVersion() override {
+        return ProtocolVersion4;
+    }
+
+protected:
+    // Called with the simulation time of the step frame, before its data is serialized or deserialized
+    virtual void BeginReadStepData([[maybe_unused]] SimulationTime simulationTime) {
+    }
+
+    virtual void BeginWriteStepData([[maybe_unused]] SimulationTime simulationTime) {
+    }
+};
+
+// Adds the session frame after the connect ok frame, which allows to resume the session after a connection loss
+class ProtocolV5 : public ProtocolV4 {  // NOLINT(misc-use-internal-linkage)
+public:
+    [[nodiscard]] uint32_t GetVersion() override {
+        return ProtocolVersion5;
+    }
+};
+
+// Adds the catalog frames after the session frame, so clients can skip the transfer of a cached catalog
+class ProtocolV6 : public ProtocolV5 {  // NOLINT(misc-use-internal-linkage)
+public:
+    [[nodiscard]] uint32_t GetVersion() override {
+        return ProtocolVersion6;
+    }
+};
+
+// Encodes sizes, lengths, ids and flags as variable-length integers. Signal ids are stored as difference to the previous id
+// of the same list and message timestamps as difference to the simulation time of the step
+class ProtocolV7 : public ProtocolV6 {  // NOLINT(misc-use-internal-linkage)
+public:
+    [[nodiscard]] Result ReadSize(ChannelReader& reader, size_t& size) override {
+        CheckResultWithMessage(_readCodec.ReadSize(reader, size), "Could not read size.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteSize(ChannelWriter& writer, size_t size) override {
+        CheckResultWithMessage(_writeCodec.WriteSize(writer, size), "Could not write size.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadLength(ChannelReader& reader, uint32_t& length) override {
+        CheckResultWithMessage(_readCodec.ReadLength(reader, length), "Could not read length.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteLength(ChannelWriter& writer, uint32_t length) override {
+        CheckResultWithMessage(_writeCodec.WriteLength(writer, length), "Could not write length.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadSignalId(ChannelReader& reader, IoSignalId& signalId) override {
+        CheckResultWithMessage(_readCodec.ReadSignalId(reader, signalId), "Could not read signal id.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteSignalId(ChannelWriter& writer, IoSignalId signalId) override {
+        CheckResultWithMessage(_writeCodec.WriteSignalId(writer, signalId), "Could not write signal id.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, CanMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_readCodec.ReadMessage(reader, messageContainer), "Could not read CanMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const CanMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_writeCodec.WriteMessage(writer, messageContainer), "Could not write CanMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, EthMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_readCodec.ReadMessage(reader, messageContainer), "Could not read EthMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const EthMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_writeCodec.WriteMessage(writer, messageContainer), "Could not write EthMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, LinMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_readCodec.ReadMessage(reader, messageContainer), "Could not read LinMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const LinMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_writeCodec.WriteMessage(writer, messageContainer), "Could not write LinMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, FrMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_readCodec.ReadMessage(reader, messageContainer), "Could not read FrMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const FrMessageContainer& messageContainer) override {
+        CheckResultWithMessage(_writeCodec.WriteMessage(writer, messageContainer), "Could not write FrMessageContainer.");
+        return CreateOk();
+    }
+
+    [[nodiscard]] uint32_t GetVersion() override {
+        return ProtocolVersion7;
+    }
+
+    [[nodiscard]] StepContext GetStepContext() override {
+        return {StepEncoding::Varint, _readCodec.GetReferenceTime(), _writeCodec.GetReferenceTime()};
+    }
+
+protected:
+    void BeginReadStepData(SimulationTime simulationTime) override {
+        _readCodec = VarintStepCodec(simulationTime);
+    }
+
+    void BeginWriteStepData(SimulationTime simulationTime) override {
+        _writeCodec = VarintStepCodec(simulationTime);
+    }
+
+private:
+    VarintStepCodec _readCodec{SimulationTime{}};
+    VarintStepCodec _writeCodec{SimulationTime{}};
+};
+
+// Allows to send the changed signals as bitmap over the signal indices, when most of them changed
+class ProtocolV8 : public ProtocolV7 {  // NOLINT(misc-use-internal-linkage)
+public:
+    [[nodiscard]] uint32_t GetVersion() override {
+        return ProtocolVersion8;
+    }
+
+    [[nodiscard]] bool DoDenseSignalUpdates() override {
+        return true;
+    }
+};
+
+// Allows to send only the changed chunks of large signals
+class ProtocolV9 final : public ProtocolV8 {  // NOLINT(misc-use-internal-linkage)
+public:
+    [[nodiscard]] uint32_t GetVersion() override {
+        return ProtocolVersion9;
+    }
+
+    [[nodiscard]] bool DoDeltaSignalUpdates() override {
+        return true;
+    }
+};
+
+[[nodiscard]] Result CreateProtocol(uint32_t negotiatedVersion, std::unique_ptr<IProtocol>& protocol) {
+    if (negotiatedVersion >= ProtocolVersion9) {
+        protocol = std::make_unique<ProtocolV9>();
+        return CreateOk();
+    }
+
+    if (negotiatedVersion >= ProtocolVersion8) {
+        protocol = std::make_unique<ProtocolV8>();
+        return CreateOk();
+    }
+
+    if (negotiatedVersion >= ProtocolVersion7) {
+        protocol = std::make_unique<ProtocolV7>();
+        return CreateOk();
+    }
+
+    if (negotiatedVersion >= ProtocolVersion6) {
+        protocol = std::make_unique<ProtocolV6>();
+        return CreateOk();
+    }
+
+    if (negotiatedVersion >= ProtocolVersion5) {
+        protocol = std::make_unique<ProtocolV5>();
+        return CreateOk();
+    }
+
+    if (negotiatedVersion >= ProtocolVersion4) {
+        protocol = std::make_unique<ProtocolV4>();
+        return CreateOk();
+    }
+
+    if (negotiatedVersion >= ProtocolVersion3) {
+        protocol = std::make_unique<ProtocolV3>();
+        return CreateOk();
+    }
+
     if (negotiatedVersion >= ProtocolVersion2) {
         protocol = std::make_unique<ProtocolV2>();
         return CreateOk();
@@ -5,16 +5,30 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Channel.hpp"
 #include "CoSimTypes.hpp"
 #include "Result.hpp"
+#include "StepCodec.hpp"
 
 namespace DsVeosCoSim {
 
 [[maybe_unused]] constexpr uint32_t ProtocolVersion1 = 0x10000;
 [[maybe_unused]] constexpr uint32_t ProtocolVersion2 = 0x20000;
-[[maybe_unused]] constexpr uint32_t ProtocolVersionLatest = ProtocolVersion2;
+[[maybe_unused]] constexpr uint32_t ProtocolVersion3 = 0x30000;
+[[maybe_unused]] constexpr uint32_t ProtocolVersion4 = 0x40000;
+[[maybe_unused]] constexpr uint32_t ProtocolVersion5 = 0x50000;
+[[maybe_unused]] constexpr uint32_t ProtocolVersion6 = 0x60000;
+[[maybe_unused]] constexpr uint32_t ProtocolVersion7 = 0x70000;
+[[maybe_unused]] constexpr uint32_t ProtocolVersion8 = 0x80000;
+[[maybe_unused]] constexpr uint32_t ProtocolVersion9 = 0x90000;
+[[maybe_unused]] constexpr uint32_t ProtocolVersionLatest = ProtocolVersion9;
+
+struct PortMapperEntry {
+    std::string serverName;
+    uint16_t port{};
+};
 
 using SerializeFunction = std::function<Result(ChannelWriter& writer)>;
 using DeserializeFunction = std::function<Result(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks)>;
@@ -90,7 +104,8 @@ public:
                                                std::vector<CanControllerContainer>& canControllers,
                                                std::vector<EthControllerContainer>& ethControllers,
                                                std::vector<LinControllerContainer>& linControllers,
-                                               std::vector<FrControllerContainer>& frControllers) = 0;
+                                               std::vector<FrControllerContainer>& frControllers,
+                                               uint32_t& maxFrameSize) = 0;
 
     [[nodiscard]] virtual Result SendConnectOk(ChannelWriter& writer,
                                                uint32_t protocolVersion,
@@ -102,7 +117,25 @@ public:
                                                const std::vector<CanControllerContainer>& canControllers,
                                                const std::vector<EthControllerContainer>& ethControllers,
                                                const std::vector<LinControllerContainer>& linControllers,
-                                               const std::vector<FrControllerContainer>& frController) = 0;
+                                               const std::vector<FrControllerContainer>& frController,
+                                               uint32_t maxFrameSize) = 0;
+
+    // Follows the connect ok frame since protocol version 5. A token of 0 means, that the session cannot be resumed
+    [[nodiscard]] virtual Result ReadSession(ChannelReader& reader, uint64_t& sessionToken, uint32_t& resumeTimeoutInMilliseconds) = 0;
+    [[nodiscard]] virtual Result SendSession(ChannelWriter& writer, uint64_t sessionToken, uint32_t resumeTimeoutInMilliseconds) = 0;
+
+    // Sent instead of the connect frame to continue a session over a new connection. Answered with ok or error
+    [[nodiscard]] virtual Result ReadResume(ChannelReader& reader, uint64_t& sessionToken) = 0;
+    [[nodiscard]] virtual Result SendResume(ChannelWriter& writer, uint64_t sessionToken) = 0;
+
+    // Since protocol version 6, the client asks for the catalog after the session frame, instead of receiving it with the
+    // connect ok frame. It sends the hash of the catalog it has cached or 0
+    [[nodiscard]] virtual Result ReadGetCatalog(ChannelReader& reader, uint64_t& cachedCatalogHash) = 0;
+    [[nodiscard]] virtual Result SendGetCatalog(ChannelWriter& writer, uint64_t cachedCatalogHash) = 0;
+
+    // The catalog is empty, if the cached one of the client is still valid
+    [[nodiscard]] virtual Result ReadCatalog(ChannelReader& reader, uint64_t& catalogHash, std::vector<uint8_t>& catalog) = 0;
+    [[nodiscard]] virtual Result SendCatalog(ChannelWriter& writer, uint64_t catalogHash, const std::vector<uint8_t>& catalog) = 0;
 
     [[nodiscard]] virtual Result ReadStart(ChannelReader& reader, SimulationTime& simulationTime) = 0;
     [[nodiscard]] virtual Result SendStart(ChannelWriter& writer, SimulationTime simulationTime) = 0;
@@ -119,23 +152,29 @@ public:
     [[nodiscard]] virtual Result ReadContinue(ChannelReader& reader, SimulationTime& simulationTime) = 0;
     [[nodiscard]] virtual Result SendContinue(ChannelWriter& writer, SimulationTime simulationTime) = 0;
 
+    // Step frames carry a sequence number since protocol version 4. The client echoes it in the step ok frame.
+    // Older versions do not transmit it, so it is read as 0
     [[nodiscard]] virtual Result ReadStep(ChannelReader& reader,
+                                          uint32_t& sequenceNumber,
                                           SimulationTime& simulationTime,
                                           const DeserializeFunction& deserializeIoData,
                                           const DeserializeFunction& deserializeBusMessages,
                                           const Callbacks& callbacks) = 0;
     [[nodiscard]] virtual Result SendStep(ChannelWriter& writer,
+                                          uint32_t sequenceNumber,
                                           SimulationTime simulationTime,
                                           const SerializeFunction& serializeIoData,
                                           const SerializeFunction& serializeBusMessages) = 0;
 
     [[nodiscard]] virtual Result ReadStepOk(ChannelReader& reader,
+                                            uint32_t& sequenceNumber,
                                             SimulationTime& nextSimulationTime,
                                             Command& command,
                                             const DeserializeFunction& deserializeIoData,
                                             const DeserializeFunction& deserializeBusMessages,
                                             const Callbacks& callbacks) = 0;
     [[nodiscard]] virtual Result SendStepOk(ChannelWriter& writer,
+                                            uint32_t sequenceNumber,
                                             SimulationTime nextSimulationTime,
                                             Command command,
                                             const SerializeFunction& serializeIoData,
@@ -153,9 +192,28 @@ public:
     [[nodiscard]] virtual Result ReadUnsetPort(ChannelReader& reader, std::string& serverName) = 0;
     [[nodiscard]] virtual Result SendUnsetPort(ChannelWriter& writer, std::string_view serverName) = 0;
 
+    [[nodiscard]] virtual Result ReadGetPorts(ChannelReader& reader, std::vector<std::string>& serverNames) = 0;
+    [[nodiscard]] virtual Result SendGetPorts(ChannelWriter& writer, const std::vector<std::string>& serverNames) = 0;
+
+    // Unknown servers have port 0
+    [[nodiscard]] virtual Result ReadGetPortsOk(ChannelReader& reader, std::vector<uint16_t>& ports) = 0;
+    [[nodiscard]] virtual Result SendGetPortsOk(ChannelWriter& writer, const std::vector<uint16_t>& ports) = 0;
+
+    [[nodiscard]] virtual Result ReadSetPorts(ChannelReader& reader, std::vector<PortMapperEntry>& entries) = 0;
+    [[nodiscard]] virtual Result SendSetPorts(ChannelWriter& writer, const std::vector<PortMapperEntry>& entries) = 0;
+
     [[nodiscard]] virtual uint32_t GetVersion() = 0;
 
     [[nodiscard]] virtual bool DoFlexRayOperations() = 0;
+
+    // Since protocol version 8, a non-empty list of changed signals is marked as sparse or dense
+    [[nodiscard]] virtual bool DoDenseSignalUpdates() = 0;
+
+    // Since protocol version 9, values of large signals are marked as full or delta. A delta only contains the changed chunks
+    [[nodiscard]] virtual bool DoDeltaSignalUpdates() = 0;
+
+    // The exchanges encode their lists with the codec of this encoding directly instead of calling the functions above
+    [[nodiscard]] virtual StepContext GetStepContext() = 0;
 };
 
 [[nodiscard]] Result CreateProtocol(uint32_t negotiatedVersion, std::unique_ptr<IProtocol>& protocol);
@@ -16,42 +16,36 @@
 #include "Protocol.hpp"
 #include "Result.hpp"
 #include "SignalExchangeCommon.hpp"
-#include "SignalExchangeLocalWin.hpp"
+#include "SignalExchangeLocal.hpp"
 #include "SignalExchangeLocked.hpp"
 #include "SignalExchangeRemote.hpp"
 
 namespace DsVeosCoSim {
 
 using SignalExchangeDetail::ISignalExchangePart;
-#ifdef _WIN32
 using SignalExchangeDetail::LocalSignalExchangePart;
-#endif
 using SignalExchangeDetail::LockedSignalExchangePart;
 using SignalExchangeDetail::RemoteSignalExchangePart;
 
 namespace {
 
 [[nodiscard]] Result CreateSignalExchangePart(CoSimType coSimType,
-                                              [[maybe_unused]] ConnectionKind connectionKind,
-                                              [[maybe_unused]] std::string_view name,
+                                              ConnectionKind connectionKind,
+                                              std::string_view name,
                                               const std::vector<IoSignal>& signals,
                                               IProtocol& protocol,
-                                              [[maybe_unused]] bool isWritePart,
+                                              bool isWritePart,
                                               std::unique_ptr<ISignalExchangePart>& signalExchangePart) {
-#ifdef _WIN32
     if (connectionKind == ConnectionKind::Local) {
         std::string partName = fmt::format("{}.{}", name, isWritePart ? "Outgoing" : "Incoming");
         if (coSimType == CoSimType::Server) {
             partName = fmt::format("{}.{}", name, isWritePart ? "Incoming" : "Outgoing");
         }
 
-        CheckResult(LocalSignalExchangePart::Create(protocol, signals, std::move(partName), signalExchangePart));
+        CheckResult(LocalSignalExchangePart::Create(protocol, signals, isWritePart, std::move(partName), signalExchangePart));
     } else {
-#endif
-        CheckResult(RemoteSignalExchangePart::Create(protocol, signals, signalExchangePart));
-#ifdef _WIN32
+        CheckResult(RemoteSignalExchangePart::Create(protocol, signals, isWritePart, signalExchangePart));
     }
-#endif
 
     if (coSimType == CoSimType::Client) {
         signalExchangePart = std::make_unique<LockedSignalExchangePart>(std::move(signalExchangePart));
@@ -73,6 +67,14 @@ void SignalExchange::ClearData() const {
     _writePart->ClearData();
 }
 
+void SignalExchange::MarkAllAsChanged() const {
+    _writePart->MarkAllAsChanged();
+}
+
+void SignalExchange::RequireFullValues() const {
+    _writePart->RequireFullValues();
+}
+
 [[nodiscard]] Result SignalExchange::Write(IoSignalId signalId, uint32_t length, const void* value) const {
     return _writePart->Write(signalId, length, value);
 }
@@ -85,6 +87,34 @@ void SignalExchange::ClearData() const {
     return _readPart->Read(signalId, length, value);
 }
 
+[[nodiscard]] Result SignalExchange::ResolveWriteSignal(IoSignalId signalId, IoSignalHandle& signalHandle) const {
+    return _writePart->Resolve(signalId, signalHandle);
+}
+
+[[nodiscard]] Result SignalExchange::ResolveReadSignal(IoSignalId signalId, IoSignalHandle& signalHandle) const {
+    return _readPart->Resolve(signalId, signalHandle);
+}
+
+[[nodiscard]] Result SignalExchange::Write(IoSignalHandle signalHandle, uint32_t length, const void* value) const {
+    return _writePart->Write(signalHandle, length, value);
+}
+
+[[nodiscard]] Result SignalExchange::Read(IoSignalHandle signalHandle, uint32_t& length, void* value) const {
+    return _readPart->Read(signalHandle, length, value);
+}
+
+[[nodiscard]] Result SignalExchange::Read(IoSignalHandle signalHandle, uint32_t& length, const void** value) const {
+    return _readPart->Read(signalHandle, length, value);
+}
+
+[[nodiscard]] Result SignalExchange::Write(const OutgoingSignalValue* signalValues, size_t count) const {
+    return _writePart->Write(signalValues, count);
+}
+
+[[nodiscard]] Result SignalExchange::Read(IncomingSignalValue* signalValues, size_t count) const {
+    return _readPart->Read(signalValues, count);
+}
+
 [[nodiscard]] Result SignalExchange::Serialize(ChannelWriter& writer) const {
     return _writePart->Serialize(writer);
 }
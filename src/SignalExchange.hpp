@@ -33,11 +33,21 @@ public:
     SignalExchange& operator=(SignalExchange&&) = delete;
 
     void ClearData() const;
+    void MarkAllAsChanged() const;
+    void RequireFullValues() const;
 
     [[nodiscard]] Result Write(IoSignalId signalId, uint32_t length, const void* value) const;
     [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, void* value) const;
     [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, const void** value) const;
 
+    [[nodiscard]] Result ResolveWriteSignal(IoSignalId signalId, IoSignalHandle& signalHandle) const;
+    [[nodiscard]] Result ResolveReadSignal(IoSignalId signalId, IoSignalHandle& signalHandle) const;
+    [[nodiscard]] Result Write(IoSignalHandle signalHandle, uint32_t length, const void* value) const;
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, void* value) const;
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, const void** value) const;
+    [[nodiscard]] Result Write(const OutgoingSignalValue* signalValues, size_t count) const;
+    [[nodiscard]] Result Read(IncomingSignalValue* signalValues, size_t count) const;
+
     [[nodiscard]] Result Serialize(ChannelWriter& writer) const;
     [[nodiscard]] Result Deserialize(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) const;
 
@@ -0,0 +1,150 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include "SignalExchangeCommon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef DSVEOSCOSIM_COMPARE_AND_COPY_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include <immintrin.h>
+#endif
+
+namespace DsVeosCoSim::SignalExchangeDetail {
+
+#ifdef DSVEOSCOSIM_COMPARE_AND_COPY_X86
+
+#if defined(_MSC_VER) && !defined(__clang__)
+// MSVC allows all intrinsics without enabling the instruction set
+#define DSVEOSCOSIM_TARGET(instructionSet)
+#else
+#define DSVEOSCOSIM_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#endif
+
+DSVEOSCOSIM_TARGET("sse2")
+bool CompareAndCopySse2(uint8_t* target, const void* source, size_t size, uint64_t* changedLineBits) {
+    const auto* sourceBytes = static_cast<const uint8_t*>(source);
+
+    bool changed{};
+    size_t fullLineCount = size / CacheLineSize;
+    for (size_t line = 0; line < fullLineCount; line++) {
+        size_t offset = line * CacheLineSize;
+        const auto* sourceLine = reinterpret_cast<const __m128i*>(sourceBytes + offset);
+        auto* targetLine = reinterpret_cast<__m128i*>(target + offset);
+
+        __m128i source0 = _mm_loadu_si128(sourceLine);
+        __m128i source1 = _mm_loadu_si128(sourceLine + 1);
+        __m128i source2 = _mm_loadu_si128(sourceLine + 2);
+        __m128i source3 = _mm_loadu_si128(sourceLine + 3);
+
+        __m128i equal01 = _mm_and_si128(_mm_cmpeq_epi8(source0, _mm_loadu_si128(targetLine)), _mm_cmpeq_epi8(source1, _mm_loadu_si128(targetLine + 1)));
+        __m128i equal23 = _mm_and_si128(_mm_cmpeq_epi8(source2, _mm_loadu_si128(targetLine + 2)), _mm_cmpeq_epi8(source3, _mm_loadu_si128(targetLine + 3)));
+        if (_mm_movemask_epi8(_mm_and_si128(equal01, equal23)) != 0xFFFF) {
+            _mm_storeu_si128(targetLine, source0);
+            _mm_storeu_si128(targetLine + 1, source1);
+            _mm_storeu_si128(targetLine + 2, source2);
+            _mm_storeu_si128(targetLine + 3, source3);
+            MarkLineAsChanged(changedLineBits, line);
+            changed = true;
+        }
+    }
+
+    return CompareAndCopyRemainder(target, sourceBytes, fullLineCount * CacheLineSize, size, changedLineBits) || changed;
+}
+
+DSVEOSCOSIM_TARGET("avx2")
+bool CompareAndCopyAvx2(uint8_t* target, const void* source, size_t size, uint64_t* changedLineBits) {
+    const auto* sourceBytes = static_cast<const uint8_t*>(source);
+
+    bool changed{};
+    size_t fullLineCount = size / CacheLineSize;
+    for (size_t line = 0; line < fullLineCount; line++) {
+        size_t offset = line * CacheLineSize;
+        const auto* sourceLine = reinterpret_cast<const __m256i*>(sourceBytes + offset);
+        auto* targetLine = reinterpret_cast<__m256i*>(target + offset);
+
+        __m256i source0 = _mm256_loadu_si256(sourceLine);
+        __m256i source1 = _mm256_loadu_si256(sourceLine + 1);
+
+        __m256i equal = _mm256_and_si256(_mm256_cmpeq_epi8(source0, _mm256_loadu_si256(targetLine)), _mm256_cmpeq_epi8(source1, _mm256_loadu_si256(targetLine + 1)));
+        if (_mm256_movemask_epi8(equal) != -1) {
+            _mm256_storeu_si256(targetLine, source0);
+            _mm256_storeu_si256(targetLine + 1, source1);
+            MarkLineAsChanged(changedLineBits, line);
+            changed = true;
+        }
+    }
+
+    return CompareAndCopyRemainder(target, sourceBytes, fullLineCount * CacheLineSize, size, changedLineBits) || changed;
+}
+
+#undef DSVEOSCOSIM_TARGET
+
+#ifdef _MSC_VER
+
+bool IsSse2Supported() {
+    int32_t info[4]{};
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+}
+
+bool IsAvx2Supported() {
+    int32_t info[4]{};
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+
+    // The operating system must save the upper halves of the vector registers as well
+    __cpuid(info, 1);
+    bool isOsxsaveSupported = (info[2] & (1 << 27)) != 0;
+    bool isAvxSupported = (info[2] & (1 << 28)) != 0;
+    if (!isOsxsaveSupported || !isAvxSupported || ((_xgetbv(0) & 0x6) != 0x6)) {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+}
+
+#else
+
+bool IsSse2Supported() {
+    return __builtin_cpu_supports("sse2") != 0;
+}
+
+bool IsAvx2Supported() {
+    return __builtin_cpu_supports("avx2") != 0;
+}
+
+#endif
+
+#endif
+
+namespace {
+
+[[nodiscard]] CompareAndCopyFunction SelectCompareAndCopyFunction() {
+#ifdef DSVEOSCOSIM_COMPARE_AND_COPY_X86
+    if (IsAvx2Supported()) {
+        return CompareAndCopyAvx2;
+    }
+
+    if (IsSse2Supported()) {
+        return CompareAndCopySse2;
+    }
+#endif
+
+    return CompareAndCopyScalar;
+}
+
+}  // namespace
+
+CompareAndCopyFunction GetCompareAndCopyFunction() {
+    static const CompareAndCopyFunction function = SelectCompareAndCopyFunction();
+    return function;
+}
+
+}  // namespace DsVeosCoSim::SignalExchangeDetail
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <unordered_map>
 #include <vector>
 
@@ -23,10 +24,19 @@ struct SignalMetaData {
 
 using SignalMetaDataPtr = SignalMetaData*;
 
+// Set in the handles of the written signals, so that a handle of a read signal cannot be used for writing and vice versa
+constexpr uint32_t WriteSignalHandleBit = 0x80000000U;
+
 // The registry keeps lookup-by-id while also assigning a dense signal index for
 // buffer-backed storage vectors.
 class SignalRegistry final {
-    explicit SignalRegistry(std::unordered_map<IoSignalId, SignalMetaData> metaDataLookup) : _metaDataLookup(std::move(metaDataLookup)) {
+    SignalRegistry(std::unordered_map<IoSignalId, SignalMetaData> metaDataLookup, uint32_t handleTag)
+        : _metaDataLookup(std::move(metaDataLookup)), _handleTag(handleTag) {
+        // The map nodes keep their addresses when the registry is moved
+        _metaDataByIndex.resize(_metaDataLookup.size());
+        for (auto& [signalId, metaData] : _metaDataLookup) {
+            _metaDataByIndex[metaData.signalIndex] = &metaData;
+        }
     }
 
 public:
@@ -39,7 +49,7 @@ public:
     SignalRegistry(SignalRegistry&&) noexcept = default;
     SignalRegistry& operator=(SignalRegistry&&) noexcept = default;
 
-    [[nodiscard]] static Result Create(const std::vector<IoSignal>& ioSignals, SignalRegistry& signalRegistry) {
+    [[nodiscard]] static Result Create(const std::vector<IoSignal>& ioSignals, bool isWritePart, SignalRegistry& signalRegistry) {
         std::unordered_map<IoSignalId, SignalMetaData> metaDataLookup;
         metaDataLookup.reserve(ioSignals.size());
 
@@ -73,7 +83,7 @@ public:
             metaDataLookup.emplace(ioSignal.id, metaData);
         }
 
-        signalRegistry = SignalRegistry(std::move(metaDataLookup));
+        signalRegistry = SignalRegistry(std::move(metaDataLookup), isWritePart ? WriteSignalHandleBit : 0);
         return CreateOk();
     }
 
@@ -88,14 +98,111 @@ public:
         return CreateError();
     }
 
+    [[nodiscard]] IoSignalHandle GetSignalHandle(const SignalMetaData& metaData) const {
+        return static_cast<IoSignalHandle>(static_cast<uint32_t>(metaData.signalIndex) | _handleTag);
+    }
+
+    [[nodiscard]] Result FindMetaData(IoSignalHandle signalHandle, SignalMetaDataPtr& metaData) const {
+        auto handle = static_cast<uint32_t>(signalHandle);
+        if ((handle & WriteSignalHandleBit) != _handleTag) {
+            LogError("IO signal handle {} belongs to the {} signals.", handle, _handleTag == 0 ? "written" : "read");
+            return CreateError();
+        }
+
+        auto signalIndex = static_cast<size_t>(handle & ~WriteSignalHandleBit);
+        if (signalIndex < _metaDataByIndex.size()) {
+            metaData = _metaDataByIndex[signalIndex];
+            return CreateOk();
+        }
+
+        LogError("IO signal handle {} is invalid.", handle);
+        return CreateError();
+    }
+
     [[nodiscard]] std::unordered_map<IoSignalId, SignalMetaData>& GetMetaDataLookup() {
         return _metaDataLookup;
     }
 
+    [[nodiscard]] const std::vector<SignalMetaDataPtr>& GetMetaDataByIndex() const {
+        return _metaDataByIndex;
+    }
+
 private:
     std::unordered_map<IoSignalId, SignalMetaData> _metaDataLookup;
+    std::vector<SignalMetaDataPtr> _metaDataByIndex;
+    uint32_t _handleTag{};
 };
 
+constexpr size_t CacheLineSize = 64;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define DSVEOSCOSIM_COMPARE_AND_COPY_X86
+#endif
+
+inline void MarkLineAsChanged(uint64_t* changedLineBits, size_t line) {
+    if (changedLineBits) {
+        changedLineBits[line / 64] |= uint64_t{1} << (line % 64);
+    }
+}
+
+// Handles the bytes behind the last full cache line, which start at the given offset
+[[nodiscard]] inline bool CompareAndCopyRemainder(uint8_t* target, const uint8_t* source, size_t offset, size_t size, uint64_t* changedLineBits) {
+    size_t remainingSize = size - offset;
+    if ((remainingSize == 0) || (memcmp(target + offset, source + offset, remainingSize) == 0)) {
+        return false;
+    }
+
+    memcpy(target + offset, source + offset, remainingSize);
+    MarkLineAsChanged(changedLineBits, offset / CacheLineSize);
+    return true;
+}
+
+// Compares and copies in one pass, one cache line at a time. Unchanged lines are only read. The fixed size of the full
+// lines lets the compiler inline memcmp and memcpy. The changed lines are marked in the given bitmap, if any. Used on
+// processors without a vector implementation below
+[[nodiscard]] inline bool CompareAndCopyScalar(uint8_t* target, const void* source, size_t size, uint64_t* changedLineBits) {
+    const auto* sourceBytes = static_cast<const uint8_t*>(source);
+
+    bool changed{};
+    size_t fullLineCount = size / CacheLineSize;
+    for (size_t line = 0; line < fullLineCount; line++) {
+        size_t offset = line * CacheLineSize;
+        if (memcmp(target + offset, sourceBytes + offset, CacheLineSize) != 0) {
+            memcpy(target + offset, sourceBytes + offset, CacheLineSize);
+            MarkLineAsChanged(changedLineBits, line);
+            changed = true;
+        }
+    }
+
+    return CompareAndCopyRemainder(target, sourceBytes, fullLineCount * CacheLineSize, size, changedLineBits) || changed;
+}
+
+#ifdef DSVEOSCOSIM_COMPARE_AND_COPY_X86
+// Same as CompareAndCopyScalar, but every line of the source is loaded into vector registers once and stored from there,
+// if it differs from the target
+[[nodiscard]] bool CompareAndCopySse2(uint8_t* target, const void* source, size_t size, uint64_t* changedLineBits);
+[[nodiscard]] bool CompareAndCopyAvx2(uint8_t* target, const void* source, size_t size, uint64_t* changedLineBits);
+
+[[nodiscard]] bool IsSse2Supported();
+[[nodiscard]] bool IsAvx2Supported();
+#endif
+
+using CompareAndCopyFunction = bool (*)(uint8_t* target, const void* source, size_t size, uint64_t* changedLineBits);
+
+// Selects the widest implementation, which the processor supports, on the first call
+[[nodiscard]] CompareAndCopyFunction GetCompareAndCopyFunction();
+
+// Copies the source into the target and returns true, if they differed. The changed cache lines are marked in the given
+// bitmap, if any
+[[nodiscard]] inline bool CompareAndCopy(uint8_t* target, const void* source, size_t size, uint64_t* changedLineBits) {
+    // Values shorter than a cache line are not worth the indirect call
+    if (size < CacheLineSize) {
+        return CompareAndCopyRemainder(target, static_cast<const uint8_t*>(source), 0, size, changedLineBits);
+    }
+
+    return GetCompareAndCopyFunction()(target, source, size, changedLineBits);
+}
+
 class ISignalExchangePart {
 public:
     ISignalExchangePart() = default;
@@ -108,9 +215,19 @@ public:
     ISignalExchangePart& operator=(ISignalExchangePart&&) = delete;
 
     virtual void ClearData() = 0;
+    // Makes the next serialization contain all values, e.g., after a frame might have been lost
+    virtual void MarkAllAsChanged() = 0;
     [[nodiscard]] virtual Result Write(IoSignalId signalId, uint32_t length, const void* value) = 0;
     [[nodiscard]] virtual Result Read(IoSignalId signalId, uint32_t& length, void* value) = 0;
     [[nodiscard]] virtual Result Read(IoSignalId signalId, uint32_t& length, const void** value) = 0;
+    [[nodiscard]] virtual Result Resolve(IoSignalId signalId, IoSignalHandle& signalHandle) = 0;
+    [[nodiscard]] virtual Result Write(IoSignalHandle signalHandle, uint32_t length, const void* value) = 0;
+    [[nodiscard]] virtual Result Read(IoSignalHandle signalHandle, uint32_t& length, void* value) = 0;
+    [[nodiscard]] virtual Result Read(IoSignalHandle signalHandle, uint32_t& length, const void** value) = 0;
+    [[nodiscard]] virtual Result Write(const OutgoingSignalValue* signalValues, size_t count) = 0;
+    [[nodiscard]] virtual Result Read(IncomingSignalValue* signalValues, size_t count) = 0;
+    // The receiver cleared its values, e.g., on start. The next changed values must not be sent as delta then
+    virtual void RequireFullValues() = 0;
     [[nodiscard]] virtual Result Serialize(ChannelWriter& writer) = 0;
     [[nodiscard]] virtual Result Deserialize(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) = 0;
 };
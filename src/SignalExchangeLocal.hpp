@@ -2,8 +2,6 @@
 
 #pragma once
 
-#ifdef _WIN32
-
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -17,6 +15,7 @@
 #include "Protocol.hpp"
 #include "RingBuffer.hpp"
 #include "SignalExchangeCommon.hpp"
+#include "StepCodec.hpp"
 
 namespace DsVeosCoSim::SignalExchangeDetail {
 
@@ -47,6 +46,7 @@ public:
           _signalStates(std::move(signalStates)),
           _sharedMemory(std::move(sharedMemory)),
           _changedSignalsQueue(std::move(changedSignalsQueue)) {
+        _incomingSignalChanges.reserve(_signalStates.size());
     }
 
     ~LocalSignalExchangePart() noexcept override = default;
@@ -59,10 +59,11 @@ public:
 
     [[nodiscard]] static Result Create(IProtocol& protocol,
                                        const std::vector<IoSignal>& ioSignals,
+                                       bool isWritePart,
                                        std::string name,
                                        std::unique_ptr<ISignalExchangePart>& signalExchangePart) {
         SignalRegistry signalRegistry;
-        CheckResult(SignalRegistry::Create(ioSignals, signalRegistry));
+        CheckResult(SignalRegistry::Create(ioSignals, isWritePart, signalRegistry));
 
         std::unordered_map<IoSignalId, SignalMetaData>& metaDataLookup = signalRegistry.GetMetaDataLookup();
         auto changedSignalsQueue = RingBuffer<SignalMetaDataPtr>(metaDataLookup.size());
@@ -108,6 +109,14 @@ public:
 
     // Each signal owns two parts inside shared memory. One is the active value
     // visible to readers, the other is a staging part for the next published update.
+    void MarkAllAsChanged() override {
+        // Both sides work on the same memory, so nothing can get lost
+    }
+
+    void RequireFullValues() override {
+        // Values are never sent as delta
+    }
+
     void ClearData() override {
         _changedSignalsQueue.Clear();
 
@@ -135,26 +144,111 @@ public:
     [[nodiscard]] Result Write(IoSignalId signalId, uint32_t length, const void* value) override {
         SignalMetaDataPtr metaData{};
         CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
-        SignalState& signalState = _signalStates[metaData->signalIndex];
+        return WriteValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, void* value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, const void** value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Resolve(IoSignalId signalId, IoSignalHandle& signalHandle) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
+        signalHandle = _signalRegistry.GetSignalHandle(*metaData);
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result Write(IoSignalHandle signalHandle, uint32_t length, const void* value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalHandle, metaData));
+        return WriteValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, void* value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalHandle, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, const void** value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalHandle, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Write(const OutgoingSignalValue* signalValues, size_t count) override {
+        for (size_t i = 0; i < count; i++) {
+            SignalMetaDataPtr metaData{};
+            CheckResult(_signalRegistry.FindMetaData(signalValues[i].signalHandle, metaData));
+            CheckResult(WriteValue(*metaData, signalValues[i].length, signalValues[i].value));
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result Read(IncomingSignalValue* signalValues, size_t count) override {
+        for (size_t i = 0; i < count; i++) {
+            SignalMetaDataPtr metaData{};
+            CheckResult(_signalRegistry.FindMetaData(signalValues[i].signalHandle, metaData));
+            CheckResult(ReadValue(*metaData, signalValues[i].length, signalValues[i].value));
+        }
+
+        return CreateOk();
+    }
+
+    // For local transport the payload bytes are already in shared memory. The
+    // channel only publishes which signal ids changed since the last transfer.
+    [[nodiscard]] Result Serialize(ChannelWriter& writer) override {
+        StepContext context = _protocol.GetStepContext();
+        return WithStepCodec(context.encoding, context.writeReferenceTime, [&](auto& codec) {
+            return Serialize(writer, codec);
+        });
+    }
+
+    [[nodiscard]] Result Deserialize(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) override {
+        StepContext context = _protocol.GetStepContext();
+        _incomingSignalChanges.clear();
+        CheckResult(WithStepCodec(context.encoding, context.readReferenceTime, [&](auto& codec) {
+            return Deserialize(reader, codec, simulationTime, callbacks);
+        }));
+
+        if (callbacks.incomingSignalsChangedCallback && !_incomingSignalChanges.empty()) {
+            callbacks.incomingSignalsChangedCallback(simulationTime, _incomingSignalChanges.data(), static_cast<uint32_t>(_incomingSignalChanges.size()));
+        }
+
+        return CreateOk();
+    }
+
+private:
+    [[nodiscard]] Result WriteValue(SignalMetaData& metaData, uint32_t length, const void* value) {
+        SignalState& signalState = _signalStates[metaData.signalIndex];
 
         SharedDataPtr activePart = GetSharedData(signalState.offsetOfActivePartInShm);
 
         bool currentLengthChanged{};
-        if (metaData->info.sizeKind == SizeKind::Variable) {
-            if (length > metaData->info.length) {
-                LogError("Length of variable sized IO signal '{}' exceeds max size.", metaData->info.name);
+        if (metaData.info.sizeKind == SizeKind::Variable) {
+            if (length > metaData.info.length) {
+                LogError("Length of variable sized IO signal '{}' exceeds max size.", metaData.info.name);
                 return CreateError();
             }
 
             currentLengthChanged = activePart->currentLength != length;
         } else {
-            if (length != metaData->info.length) {
-                LogError("Length of fixed sized IO signal '{}' must be {} but was {}.", metaData->info.name, metaData->info.length, length);
+            if (length != metaData.info.length) {
+                LogError("Length of fixed sized IO signal '{}' must be {} but was {}.", metaData.info.name, metaData.info.length, length);
                 return CreateError();
             }
         }
 
-        size_t totalSize = metaData->dataTypeSize * length;
+        size_t totalSize = metaData.dataTypeSize * length;
 
         bool dataChanged = memcmp(activePart->data, value, totalSize) != 0;
 
@@ -164,7 +258,7 @@ public:
 
         if (!signalState.isChanged) {
             signalState.isChanged = true;
-            if (!_changedSignalsQueue.TryPushBack(metaData)) {
+            if (!_changedSignalsQueue.TryPushBack(&metaData)) {
                 LogError("Changed signals queue is full.");
                 return CreateError();
             }
@@ -181,23 +275,19 @@ public:
         return CreateOk();
     }
 
-    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, void* value) override {
-        SignalMetaDataPtr metaData{};
-        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
-        SignalState& signalState = _signalStates[metaData->signalIndex];
+    [[nodiscard]] Result ReadValue(const SignalMetaData& metaData, uint32_t& length, void* value) const {
+        const SignalState& signalState = _signalStates[metaData.signalIndex];
 
         SharedDataPtr activePart = GetSharedData(signalState.offsetOfActivePartInShm);
 
         length = activePart->currentLength;
-        size_t totalSize = metaData->dataTypeSize * length;
+        size_t totalSize = metaData.dataTypeSize * length;
         memcpy(value, activePart->data, totalSize);
         return CreateOk();
     }
 
-    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, const void** value) override {
-        SignalMetaDataPtr metaData{};
-        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
-        SignalState& signalState = _signalStates[metaData->signalIndex];
+    [[nodiscard]] Result ReadValue(const SignalMetaData& metaData, uint32_t& length, const void** value) const {
+        const SignalState& signalState = _signalStates[metaData.signalIndex];
 
         SharedDataPtr activePart = GetSharedData(signalState.offsetOfActivePartInShm);
 
@@ -206,10 +296,9 @@ public:
         return CreateOk();
     }
 
-    // For local transport the payload bytes are already in shared memory. The
-    // channel only publishes which signal ids changed since the last transfer.
-    [[nodiscard]] Result Serialize(ChannelWriter& writer) override {
-        CheckResultWithMessage(_protocol.WriteSize(writer, _changedSignalsQueue.Size()), "Could not write count of changed signals.");
+    template <typename TCodec>
+    [[nodiscard]] Result Serialize(ChannelWriter& writer, TCodec& codec) {
+        CheckResultWithMessage(codec.WriteSize(writer, _changedSignalsQueue.Size()), "Could not write count of changed signals.");
 
         SignalMetaDataPtr metaData{};
         while (_changedSignalsQueue.TryPopFront(metaData)) {
@@ -220,7 +309,7 @@ public:
                 LogProtData(IoDataToString(metaData->info, activePart->currentLength, activePart->data));
             }
 
-            CheckResultWithMessage(_protocol.WriteSignalId(writer, metaData->info.id), "Could not write signal id.");
+            CheckResultWithMessage(codec.WriteSignalId(writer, metaData->info.id), "Could not write signal id.");
 
             signalState.isChanged = false;
         }
@@ -228,13 +317,14 @@ public:
         return CreateOk();
     }
 
-    [[nodiscard]] Result Deserialize(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) override {
+    template <typename TCodec>
+    [[nodiscard]] Result Deserialize(ChannelReader& reader, TCodec& codec, SimulationTime simulationTime, const Callbacks& callbacks) {
         size_t ioSignalChangedCount = 0;
-        CheckResultWithMessage(_protocol.ReadSize(reader, ioSignalChangedCount), "Could not read count of changed signals.");
+        CheckResultWithMessage(codec.ReadSize(reader, ioSignalChangedCount), "Could not read count of changed signals.");
 
         for (size_t i = 0; i < ioSignalChangedCount; i++) {
             IoSignalId signalId{};
-            CheckResultWithMessage(_protocol.ReadSignalId(reader, signalId), "Could not read signal id.");
+            CheckResultWithMessage(codec.ReadSignalId(reader, signalId), "Could not read signal id.");
 
             SignalMetaDataPtr metaData{};
             CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
@@ -248,7 +338,9 @@ public:
                 LogProtData(IoDataToString(metaData->info, activePart->currentLength, activePart->data));
             }
 
-            if (callbacks.incomingSignalChangedCallback) {
+            if (callbacks.incomingSignalsChangedCallback) {
+                _incomingSignalChanges.push_back({&metaData->info, activePart->currentLength, activePart->data});
+            } else if (callbacks.incomingSignalChangedCallback) {
                 callbacks.incomingSignalChangedCallback(simulationTime, metaData->info, activePart->currentLength, activePart->data);
             }
         }
@@ -256,7 +348,6 @@ public:
         return CreateOk();
     }
 
-private:
     [[nodiscard]] SharedDataPtr GetSharedData(size_t offset) const {
         return reinterpret_cast<SharedDataPtr>(_sharedMemory.GetData() + offset);
     }
@@ -271,8 +362,8 @@ private:
     std::vector<SignalState> _signalStates;
     SharedMemory _sharedMemory;
     RingBuffer<SignalMetaDataPtr> _changedSignalsQueue;
+    // Collected while deserializing a step, if the batch callback is set
+    std::vector<IncomingSignalChange> _incomingSignalChanges;
 };
 
 }  // namespace DsVeosCoSim::SignalExchangeDetail
-
-#endif
@@ -27,6 +27,11 @@ public:
         _proxiedPart->ClearData();
     }
 
+    void MarkAllAsChanged() override {
+        std::scoped_lock lock(_mutex);
+        _proxiedPart->MarkAllAsChanged();
+    }
+
     [[nodiscard]] Result Write(IoSignalId signalId, uint32_t length, const void* value) override {
         std::scoped_lock lock(_mutex);
         return _proxiedPart->Write(signalId, length, value);
@@ -42,6 +47,41 @@ public:
         return _proxiedPart->Read(signalId, length, value);
     }
 
+    [[nodiscard]] Result Resolve(IoSignalId signalId, IoSignalHandle& signalHandle) override {
+        std::scoped_lock lock(_mutex);
+        return _proxiedPart->Resolve(signalId, signalHandle);
+    }
+
+    [[nodiscard]] Result Write(IoSignalHandle signalHandle, uint32_t length, const void* value) override {
+        std::scoped_lock lock(_mutex);
+        return _proxiedPart->Write(signalHandle, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, void* value) override {
+        std::scoped_lock lock(_mutex);
+        return _proxiedPart->Read(signalHandle, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, const void** value) override {
+        std::scoped_lock lock(_mutex);
+        return _proxiedPart->Read(signalHandle, length, value);
+    }
+
+    [[nodiscard]] Result Write(const OutgoingSignalValue* signalValues, size_t count) override {
+        std::scoped_lock lock(_mutex);
+        return _proxiedPart->Write(signalValues, count);
+    }
+
+    [[nodiscard]] Result Read(IncomingSignalValue* signalValues, size_t count) override {
+        std::scoped_lock lock(_mutex);
+        return _proxiedPart->Read(signalValues, count);
+    }
+
+    void RequireFullValues() override {
+        std::scoped_lock lock(_mutex);
+        _proxiedPart->RequireFullValues();
+    }
+
     [[nodiscard]] Result Serialize(ChannelWriter& writer) override {
         std::scoped_lock lock(_mutex);
         return _proxiedPart->Serialize(writer);
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <vector>
@@ -12,25 +13,61 @@
 #include "Protocol.hpp"
 #include "RingBuffer.hpp"
 #include "SignalExchangeCommon.hpp"
+#include "StepCodec.hpp"
 
 namespace DsVeosCoSim::SignalExchangeDetail {
 
 class RemoteSignalExchangePart final : public ISignalExchangePart {
+    // The values of all signals are stored in one arena in the order of the signal indices. Values, which fill at least a
+    // cache line, start at a cache line
+    static constexpr size_t ArenaAlignment = CacheLineSize;
+
+    // Values of at least this many cache lines can be sent as delta, which only contains the changed cache lines
+    static constexpr size_t DeltaMinimumLineCount = 4;
+
+    // A state from an older epoch is reset before it is used. This makes ClearData independent of the signal count
     struct SignalValueState {
+        size_t offset{};
+        // Offset of the bitmap of the cache lines written since the last serialization. Only for delta capable signals
+        size_t changedLinesOffset{};
         uint32_t currentLength{};
+        uint32_t epoch{};
+        // The receiver holds the last sent value as base for a delta, if this equals _fullValueGeneration
+        uint64_t fullValueGeneration{};
         bool isChanged{};
-        std::vector<uint8_t> buffer;
+    };
+
+    // Sparse updates send the id of every changed signal. Dense updates send a bitmap over the signal indices instead and
+    // the values in index order
+    enum class UpdateEncoding : uint8_t {
+        Sparse,
+        Dense
+    };
+
+    // Full values contain all data. Delta values contain runs of changed cache lines, each one with its distance to the
+    // previous run
+    enum class ValueEncoding : uint8_t {
+        Full,
+        Delta
     };
 
 public:
     RemoteSignalExchangePart(IProtocol& protocol,
                              SignalRegistry signalRegistry,
                              std::vector<SignalValueState> signalStates,
+                             size_t arenaSize,
+                             size_t changedLinesWordCount,
                              RingBuffer<SignalMetaDataPtr> changedSignalsQueue)
         : _protocol(protocol),
           _signalRegistry(std::move(signalRegistry)),
           _signalStates(std::move(signalStates)),
-          _changedSignalsQueue(std::move(changedSignalsQueue)) {
+          _arenaStorage(arenaSize + ArenaAlignment - 1),
+          _changedLineBits(changedLinesWordCount),
+          _changedSignalsQueue(std::move(changedSignalsQueue)),
+          _bitmap((_signalStates.size() + 7) / 8) {
+        auto address = reinterpret_cast<uintptr_t>(_arenaStorage.data());
+        _arena = _arenaStorage.data() + (ArenaAlignment - address % ArenaAlignment) % ArenaAlignment;
+        _incomingSignalChanges.reserve(_signalStates.size());
     }
 
     ~RemoteSignalExchangePart() noexcept override = default;
@@ -41,57 +78,250 @@ public:
     RemoteSignalExchangePart(RemoteSignalExchangePart&&) = delete;
     RemoteSignalExchangePart& operator=(RemoteSignalExchangePart&&) = delete;
 
-    [[nodiscard]] static Result Create(IProtocol& protocol, const std::vector<IoSignal>& ioSignals, std::unique_ptr<ISignalExchangePart>& signalExchangePart) {
+    [[nodiscard]] static Result Create(IProtocol& protocol,
+                                       const std::vector<IoSignal>& ioSignals,
+                                       bool isWritePart,
+                                       std::unique_ptr<ISignalExchangePart>& signalExchangePart) {
         SignalRegistry signalRegistry;
-        CheckResult(SignalRegistry::Create(ioSignals, signalRegistry));
-
-        std::unordered_map<IoSignalId, SignalMetaData>& metaDataLookup = signalRegistry.GetMetaDataLookup();
-        auto changedSignalsQueue = RingBuffer<SignalMetaDataPtr>(metaDataLookup.size());
-        std::vector<SignalValueState> signalStates(metaDataLookup.size());
-        for (auto& [signalId, metaData] : metaDataLookup) {
-            SignalValueState signalState{};
-            signalState.buffer.resize(metaData.totalDataSize);
-            if (metaData.info.sizeKind == SizeKind::Fixed) {
-                signalState.currentLength = metaData.info.length;
+        CheckResult(SignalRegistry::Create(ioSignals, isWritePart, signalRegistry));
+
+        const std::vector<SignalMetaDataPtr>& metaDataByIndex = signalRegistry.GetMetaDataByIndex();
+        auto changedSignalsQueue = RingBuffer<SignalMetaDataPtr>(metaDataByIndex.size());
+        std::vector<SignalValueState> signalStates(metaDataByIndex.size());
+        size_t arenaSize = 0;
+        size_t changedLinesWordCount = 0;
+        for (SignalMetaDataPtr metaData : metaDataByIndex) {
+            size_t alignment = metaData->totalDataSize >= ArenaAlignment ? ArenaAlignment : metaData->dataTypeSize;
+            arenaSize = (arenaSize + alignment - 1) / alignment * alignment;
+
+            SignalValueState& signalState = signalStates[metaData->signalIndex];
+            signalState.offset = arenaSize;
+            if (metaData->info.sizeKind == SizeKind::Fixed) {
+                signalState.currentLength = metaData->info.length;
             }
 
-            signalStates[metaData.signalIndex] = std::move(signalState);
+            arenaSize += metaData->totalDataSize;
+
+            if (IsDeltaCapable(*metaData)) {
+                signalState.changedLinesOffset = changedLinesWordCount;
+                changedLinesWordCount += (GetLineCount(metaData->totalDataSize) + 63) / 64;
+            }
         }
 
-        signalExchangePart =
-            std::make_unique<RemoteSignalExchangePart>(protocol, std::move(signalRegistry), std::move(signalStates), std::move(changedSignalsQueue));
+        signalExchangePart = std::make_unique<RemoteSignalExchangePart>(protocol,
+                                                                        std::move(signalRegistry),
+                                                                        std::move(signalStates),
+                                                                        arenaSize,
+                                                                        changedLinesWordCount,
+                                                                        std::move(changedSignalsQueue));
         return CreateOk();
     }
 
     void ClearData() override {
         _changedSignalsQueue.Clear();
 
-        for (auto& [signalId, metaData] : _signalRegistry.GetMetaDataLookup()) {
-            auto& [currentLength, isChanged, buffer] = _signalStates[metaData.signalIndex];
-            isChanged = false;
-            if (metaData.info.sizeKind == SizeKind::Variable) {
-                currentLength = 0;
-            }
+        _epoch++;
+        if (_epoch != 0) {
+            return;
+        }
+
+        // The epoch wrapped around, so older states could look current again
+        for (SignalMetaDataPtr metaData : _signalRegistry.GetMetaDataByIndex()) {
+            SignalValueState& signalState = _signalStates[metaData->signalIndex];
+            signalState.epoch = UINT32_MAX;
+            (void)GetSignalState(*metaData);
+        }
+    }
 
-            std::fill(buffer.begin(), buffer.end(), static_cast<uint8_t>(0));
+    void MarkAllAsChanged() override {
+        // The receiver might have missed earlier values
+        _fullValueGeneration++;
+
+        for (SignalMetaDataPtr metaData : _signalRegistry.GetMetaDataByIndex()) {
+            bool& isChanged = GetSignalState(*metaData).isChanged;
+            if (!isChanged) {
+                isChanged = true;
+                (void)_changedSignalsQueue.TryPushBack(metaData);
+            }
         }
     }
 
+    void RequireFullValues() override {
+        _fullValueGeneration++;
+    }
+
     [[nodiscard]] Result Write(IoSignalId signalId, uint32_t length, const void* value) override {
         SignalMetaDataPtr metaData{};
         CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
-        auto& [currentLength, isChanged, buffer] = _signalStates[metaData->signalIndex];
+        return WriteValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, void* value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, const void** value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Resolve(IoSignalId signalId, IoSignalHandle& signalHandle) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
+        signalHandle = _signalRegistry.GetSignalHandle(*metaData);
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result Write(IoSignalHandle signalHandle, uint32_t length, const void* value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalHandle, metaData));
+        return WriteValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, void* value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalHandle, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Read(IoSignalHandle signalHandle, uint32_t& length, const void** value) override {
+        SignalMetaDataPtr metaData{};
+        CheckResult(_signalRegistry.FindMetaData(signalHandle, metaData));
+        return ReadValue(*metaData, length, value);
+    }
+
+    [[nodiscard]] Result Write(const OutgoingSignalValue* signalValues, size_t count) override {
+        for (size_t i = 0; i < count; i++) {
+            SignalMetaDataPtr metaData{};
+            CheckResult(_signalRegistry.FindMetaData(signalValues[i].signalHandle, metaData));
+            CheckResult(WriteValue(*metaData, signalValues[i].length, signalValues[i].value));
+        }
 
-        if (metaData->info.sizeKind == SizeKind::Variable) {
-            if (length > metaData->info.length) {
-                LogError("Length of variable sized IO signal '{}' exceeds max size.", metaData->info.name);
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result Read(IncomingSignalValue* signalValues, size_t count) override {
+        for (size_t i = 0; i < count; i++) {
+            SignalMetaDataPtr metaData{};
+            CheckResult(_signalRegistry.FindMetaData(signalValues[i].signalHandle, metaData));
+            CheckResult(ReadValue(*metaData, signalValues[i].length, signalValues[i].value));
+        }
+
+        return CreateOk();
+    }
+
+    // Remote transport sends the changed signals, but no shared memory is involved on this path. Since protocol version 8,
+    // the changed signals are either listed by id (sparse) or marked in a bitmap over all signals (dense), whichever is
+    // smaller. Values of variable sized signals are preceded by their current length. Since protocol version 9, values of
+    // large signals are sent either in full or as delta, which only contains the runs of changed cache lines.
+    [[nodiscard]] Result Serialize(ChannelWriter& writer) override {
+        StepContext context = _protocol.GetStepContext();
+        bool doDenseSignalUpdates = _protocol.DoDenseSignalUpdates();
+        bool doDeltaSignalUpdates = _protocol.DoDeltaSignalUpdates();
+        return WithStepCodec(context.encoding, context.writeReferenceTime, [&](auto& codec) {
+            return Serialize(writer, codec, doDenseSignalUpdates, doDeltaSignalUpdates);
+        });
+    }
+
+    [[nodiscard]] Result Deserialize(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) override {
+        StepContext context = _protocol.GetStepContext();
+        bool doDenseSignalUpdates = _protocol.DoDenseSignalUpdates();
+        bool doDeltaSignalUpdates = _protocol.DoDeltaSignalUpdates();
+        _incomingSignalChanges.clear();
+        CheckResult(WithStepCodec(context.encoding, context.readReferenceTime, [&](auto& codec) {
+            return Deserialize(reader, codec, doDenseSignalUpdates, doDeltaSignalUpdates, simulationTime, callbacks);
+        }));
+
+        if (callbacks.incomingSignalsChangedCallback && !_incomingSignalChanges.empty()) {
+            callbacks.incomingSignalsChangedCallback(simulationTime, _incomingSignalChanges.data(), static_cast<uint32_t>(_incomingSignalChanges.size()));
+        }
+
+        return CreateOk();
+    }
+
+private:
+    [[nodiscard]] static size_t GetLineCount(size_t size) {
+        return (size + CacheLineSize - 1) / CacheLineSize;
+    }
+
+    [[nodiscard]] static bool IsDeltaCapable(const SignalMetaData& metaData) {
+        return metaData.totalDataSize >= DeltaMinimumLineCount * CacheLineSize;
+    }
+
+    [[nodiscard]] static bool IsLineChanged(const uint64_t* changedLineBits, size_t line) {
+        return (changedLineBits[line / 64] & (uint64_t{1} << (line % 64))) != 0;
+    }
+
+    // Calls the function with the half-open range of every run of changed lines
+    template <typename Function>
+    [[nodiscard]] static Result ForEachChangedRun(const uint64_t* changedLineBits, size_t lineCount, const Function& function) {
+        size_t line = 0;
+        while (line < lineCount) {
+            if ((line % 64 == 0) && (changedLineBits[line / 64] == 0)) {
+                line += 64;
+                continue;
+            }
+
+            if (!IsLineChanged(changedLineBits, line)) {
+                line++;
+                continue;
+            }
+
+            size_t begin = line;
+            while ((line < lineCount) && IsLineChanged(changedLineBits, line)) {
+                line++;
+            }
+
+            CheckResult(function(begin, line));
+        }
+
+        return CreateOk();
+    }
+
+    [[nodiscard]] uint64_t* GetChangedLineBits(const SignalMetaData& metaData, const SignalValueState& signalState) {
+        if (!IsDeltaCapable(metaData)) {
+            return nullptr;
+        }
+
+        return _changedLineBits.data() + signalState.changedLinesOffset;
+    }
+
+    [[nodiscard]] SignalValueState& GetSignalState(const SignalMetaData& metaData) {
+        SignalValueState& signalState = _signalStates[metaData.signalIndex];
+        if (signalState.epoch != _epoch) {
+            signalState.epoch = _epoch;
+            signalState.isChanged = false;
+            signalState.fullValueGeneration = 0;
+            signalState.currentLength = metaData.info.sizeKind == SizeKind::Fixed ? metaData.info.length : 0;
+            memset(_arena + signalState.offset, 0, metaData.totalDataSize);
+            if (uint64_t* changedLineBits = GetChangedLineBits(metaData, signalState)) {
+                std::fill_n(changedLineBits, (GetLineCount(metaData.totalDataSize) + 63) / 64, uint64_t{0});
+            }
+        }
+
+        return signalState;
+    }
+
+    [[nodiscard]] Result WriteValue(SignalMetaData& metaData, uint32_t length, const void* value) {
+        SignalValueState& signalState = GetSignalState(metaData);
+        auto& [offset, changedLinesOffset, currentLength, epoch, fullValueGeneration, isChanged] = signalState;
+        uint8_t* buffer = _arena + offset;
+
+        if (metaData.info.sizeKind == SizeKind::Variable) {
+            if (length > metaData.info.length) {
+                LogError("Length of variable sized IO signal '{}' exceeds max size.", metaData.info.name);
                 return CreateError();
             }
 
             if (currentLength != length) {
+                // A delta cannot express a changed length
+                fullValueGeneration = 0;
                 if (!isChanged) {
                     isChanged = true;
-                    if (!_changedSignalsQueue.TryPushBack(metaData)) {
+                    if (!_changedSignalsQueue.TryPushBack(&metaData)) {
                         LogError("Changed signals queue is full.");
                         return CreateError();
                     }
@@ -100,24 +330,21 @@ public:
 
             currentLength = length;
         } else {
-            if (length != metaData->info.length) {
-                LogError("Length of fixed sized IO signal '{}' must be {} but was {}.", metaData->info.name, metaData->info.length, length);
+            if (length != metaData.info.length) {
+                LogError("Length of fixed sized IO signal '{}' must be {} but was {}.", metaData.info.name, metaData.info.length, length);
                 return CreateError();
             }
         }
 
-        size_t totalSize = metaData->dataTypeSize * length;
+        size_t totalSize = metaData.dataTypeSize * length;
 
-        int32_t compareResult = memcmp(buffer.data(), value, totalSize);
-        if (compareResult == 0) {
+        if (!CompareAndCopy(buffer, value, totalSize, GetChangedLineBits(metaData, signalState))) {
             return CreateOk();
         }
 
-        memcpy(buffer.data(), value, totalSize);
-
         if (!isChanged) {
             isChanged = true;
-            if (!_changedSignalsQueue.TryPushBack(metaData)) {
+            if (!_changedSignalsQueue.TryPushBack(&metaData)) {
                 LogError("Changed signals queue is full.");
                 return CreateError();
             }
@@ -126,97 +353,315 @@ public:
         return CreateOk();
     }
 
-    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, void* value) override {
-        SignalMetaDataPtr metaData{};
-        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
-        SignalValueState& signalState = _signalStates[metaData->signalIndex];
+    [[nodiscard]] Result ReadValue(const SignalMetaData& metaData, uint32_t& length, void* value) {
+        const SignalValueState& signalState = GetSignalState(metaData);
 
         length = signalState.currentLength;
-        size_t totalSize = metaData->dataTypeSize * length;
-        memcpy(value, signalState.buffer.data(), totalSize);
+        size_t totalSize = metaData.dataTypeSize * length;
+        memcpy(value, _arena + signalState.offset, totalSize);
         return CreateOk();
     }
 
-    [[nodiscard]] Result Read(IoSignalId signalId, uint32_t& length, const void** value) override {
-        SignalMetaDataPtr metaData{};
-        CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
-        SignalValueState& signalState = _signalStates[metaData->signalIndex];
+    [[nodiscard]] Result ReadValue(const SignalMetaData& metaData, uint32_t& length, const void** value) {
+        const SignalValueState& signalState = GetSignalState(metaData);
 
         length = signalState.currentLength;
-        *value = signalState.buffer.data();
+        *value = _arena + signalState.offset;
         return CreateOk();
     }
 
-    // Remote transport sends changed signal ids together with the current length
-    // and payload bytes. No shared memory is involved on this path.
-    [[nodiscard]] Result Serialize(ChannelWriter& writer) override {
-        CheckResultWithMessage(_protocol.WriteSize(writer, _changedSignalsQueue.Size()), "Could not write count of changed signals.");
-
-        SignalMetaDataPtr metaData{};
-        while (_changedSignalsQueue.TryPopFront(metaData)) {
-            auto& [currentLength, isChanged, buffer] = _signalStates[metaData->signalIndex];
-
-            CheckResultWithMessage(_protocol.WriteSignalId(writer, metaData->info.id), "Could not write signal id.");
+    template <typename TCodec>
+    [[nodiscard]] Result Serialize(ChannelWriter& writer, TCodec& codec, bool doDenseSignalUpdates, bool doDeltaSignalUpdates) {
+        size_t changedCount = _changedSignalsQueue.Size();
+        CheckResultWithMessage(codec.WriteSize(writer, changedCount), "Could not write count of changed signals.");
+        if (changedCount == 0) {
+            return CreateOk();
+        }
 
-            if (metaData->info.sizeKind == SizeKind::Variable) {
-                CheckResultWithMessage(_protocol.WriteLength(writer, currentLength), "Could not write signal length.");
+        if (doDenseSignalUpdates) {
+            // The bitmap costs one bit per signal, an id at least one byte per changed signal
+            UpdateEncoding encoding = changedCount * 8 > _signalStates.size() ? UpdateEncoding::Dense : UpdateEncoding::Sparse;
+            CheckResultWithMessage(codec.WriteData(writer, &encoding, sizeof(encoding)), "Could not write update encoding.");
+            if (encoding == UpdateEncoding::Dense) {
+                return SerializeDense(writer, codec, doDeltaSignalUpdates);
             }
+        }
 
-            size_t totalSize = metaData->dataTypeSize * currentLength;
-            CheckResultWithMessage(_protocol.WriteData(writer, buffer.data(), totalSize), "Could not write signal data.");
-            isChanged = false;
-
-            if (IsProtocolTracingEnabled()) {
-                LogProtData(IoDataToString(metaData->info, currentLength, buffer.data()));
-            }
+        SignalMetaDataPtr metaData{};
+        while (_changedSignalsQueue.TryPopFront(metaData)) {
+            CheckResultWithMessage(codec.WriteSignalId(writer, metaData->info.id), "Could not write signal id.");
+            CheckResult(SerializeValue(writer, codec, *metaData, doDeltaSignalUpdates));
         }
 
         return CreateOk();
     }
 
-    [[nodiscard]] Result Deserialize(ChannelReader& reader, SimulationTime simulationTime, const Callbacks& callbacks) override {
+    template <typename TCodec>
+    [[nodiscard]] Result Deserialize(ChannelReader& reader,
+                                     TCodec& codec,
+                                     bool doDenseSignalUpdates,
+                                     bool doDeltaSignalUpdates,
+                                     SimulationTime simulationTime,
+                                     const Callbacks& callbacks) {
         size_t ioSignalChangedCount = 0;
-        CheckResultWithMessage(_protocol.ReadSize(reader, ioSignalChangedCount), "Could not read count of changed signals.");
+        CheckResultWithMessage(codec.ReadSize(reader, ioSignalChangedCount), "Could not read count of changed signals.");
+        if (ioSignalChangedCount == 0) {
+            return CreateOk();
+        }
+
+        if (doDenseSignalUpdates) {
+            UpdateEncoding encoding{};
+            CheckResultWithMessage(codec.ReadData(reader, &encoding, sizeof(encoding)), "Could not read update encoding.");
+            if (encoding == UpdateEncoding::Dense) {
+                return DeserializeDense(reader, codec, ioSignalChangedCount, doDeltaSignalUpdates, simulationTime, callbacks);
+            }
+
+            if (encoding != UpdateEncoding::Sparse) {
+                LogError("Protocol error. Unknown update encoding {}.", static_cast<uint32_t>(encoding));
+                return CreateError();
+            }
+        }
 
         for (size_t i = 0; i < ioSignalChangedCount; i++) {
             IoSignalId signalId{};
-            CheckResultWithMessage(_protocol.ReadSignalId(reader, signalId), "Could not read signal id.");
+            CheckResultWithMessage(codec.ReadSignalId(reader, signalId), "Could not read signal id.");
 
             SignalMetaDataPtr metaData{};
             CheckResult(_signalRegistry.FindMetaData(signalId, metaData));
-            SignalValueState& signalState = _signalStates[metaData->signalIndex];
+            CheckResult(DeserializeValue(reader, codec, *metaData, doDeltaSignalUpdates, simulationTime, callbacks));
+        }
+
+        return CreateOk();
+    }
+
+    template <typename TCodec>
+    [[nodiscard]] Result SerializeDense(ChannelWriter& writer, TCodec& codec, bool doDeltaSignalUpdates) {
+        std::fill(_bitmap.begin(), _bitmap.end(), static_cast<uint8_t>(0));
+
+        SignalMetaDataPtr metaData{};
+        while (_changedSignalsQueue.TryPopFront(metaData)) {
+            _bitmap[metaData->signalIndex / 8] |= static_cast<uint8_t>(1U << (metaData->signalIndex % 8));
+        }
+
+        CheckResultWithMessage(codec.WriteData(writer, _bitmap.data(), _bitmap.size()), "Could not write changed signals bitmap.");
+
+        const std::vector<SignalMetaDataPtr>& metaDataByIndex = _signalRegistry.GetMetaDataByIndex();
+
+        for (size_t byteIndex = 0; byteIndex < _bitmap.size(); byteIndex++) {
+            uint8_t bits = _bitmap[byteIndex];
+            for (size_t bitIndex = 0; bits != 0; bitIndex++, bits >>= 1U) {
+                if ((bits & 1U) != 0) {
+                    CheckResult(SerializeValue(writer, codec, *metaDataByIndex[byteIndex * 8 + bitIndex], doDeltaSignalUpdates));
+                }
+            }
+        }
+
+        return CreateOk();
+    }
+
+    template <typename TCodec>
+    [[nodiscard]] Result DeserializeDense(ChannelReader& reader,
+                                          TCodec& codec,
+                                          size_t ioSignalChangedCount,
+                                          bool doDeltaSignalUpdates,
+                                          SimulationTime simulationTime,
+                                          const Callbacks& callbacks) {
+        CheckResultWithMessage(codec.ReadData(reader, _bitmap.data(), _bitmap.size()), "Could not read changed signals bitmap.");
+
+        const std::vector<SignalMetaDataPtr>& metaDataByIndex = _signalRegistry.GetMetaDataByIndex();
+
+        size_t readCount = 0;
+        for (size_t byteIndex = 0; byteIndex < _bitmap.size(); byteIndex++) {
+            uint8_t bits = _bitmap[byteIndex];
+            for (size_t bitIndex = 0; bits != 0; bitIndex++, bits >>= 1U) {
+                if ((bits & 1U) == 0) {
+                    continue;
+                }
 
-            if (metaData->info.sizeKind == SizeKind::Variable) {
-                uint32_t length = 0;
-                CheckResultWithMessage(_protocol.ReadLength(reader, length), "Could not read signal length.");
-                if (length > metaData->info.length) {
-                    LogError("Length of variable sized IO signal '{}' exceeds max size.", metaData->info.name);
+                size_t signalIndex = byteIndex * 8 + bitIndex;
+                if ((signalIndex >= metaDataByIndex.size()) || (readCount == ioSignalChangedCount)) {
+                    LogError("Protocol error. Changed signals bitmap does not match the count of changed signals.");
                     return CreateError();
                 }
 
-                signalState.currentLength = length;
+                CheckResult(DeserializeValue(reader, codec, *metaDataByIndex[signalIndex], doDeltaSignalUpdates, simulationTime, callbacks));
+                readCount++;
             }
+        }
+
+        if (readCount != ioSignalChangedCount) {
+            LogError("Protocol error. Changed signals bitmap does not match the count of changed signals.");
+            return CreateError();
+        }
+
+        return CreateOk();
+    }
+
+    template <typename TCodec>
+    [[nodiscard]] Result SerializeValue(ChannelWriter& writer, TCodec& codec, const SignalMetaData& metaData, bool doDeltaSignalUpdates) {
+        SignalValueState& signalState = GetSignalState(metaData);
+        uint32_t currentLength = signalState.currentLength;
+        const uint8_t* buffer = _arena + signalState.offset;
+
+        if (metaData.info.sizeKind == SizeKind::Variable) {
+            CheckResultWithMessage(codec.WriteLength(writer, currentLength), "Could not write signal length.");
+        }
+
+        size_t totalSize = metaData.dataTypeSize * currentLength;
+        if (doDeltaSignalUpdates && IsDeltaCapable(metaData)) {
+            CheckResult(SerializeDeltaCapableValue(writer, codec, metaData, signalState, totalSize));
+        } else {
+            CheckResultWithMessage(codec.WriteData(writer, buffer, totalSize), "Could not write signal data.");
+        }
 
-            size_t totalSize = metaData->dataTypeSize * signalState.currentLength;
-            CheckResultWithMessage(_protocol.ReadData(reader, signalState.buffer.data(), totalSize), "Could not read signal data.");
+        signalState.isChanged = false;
 
-            if (IsProtocolTracingEnabled()) {
-                LogProtData(IoDataToString(metaData->info, signalState.currentLength, signalState.buffer.data()));
+        if (IsProtocolTracingEnabled()) {
+            LogProtData(IoDataToString(metaData.info, currentLength, buffer));
+        }
+
+        return CreateOk();
+    }
+
+    template <typename TCodec>
+    [[nodiscard]] Result DeserializeValue(ChannelReader& reader,
+                                          TCodec& codec,
+                                          const SignalMetaData& metaData,
+                                          bool doDeltaSignalUpdates,
+                                          SimulationTime simulationTime,
+                                          const Callbacks& callbacks) {
+        SignalValueState& signalState = GetSignalState(metaData);
+        uint8_t* buffer = _arena + signalState.offset;
+
+        if (metaData.info.sizeKind == SizeKind::Variable) {
+            uint32_t length = 0;
+            CheckResultWithMessage(codec.ReadLength(reader, length), "Could not read signal length.");
+            if (length > metaData.info.length) {
+                LogError("Length of variable sized IO signal '{}' exceeds max size.", metaData.info.name);
+                return CreateError();
             }
 
-            if (callbacks.incomingSignalChangedCallback) {
-                callbacks.incomingSignalChangedCallback(simulationTime, metaData->info, signalState.currentLength, signalState.buffer.data());
+            signalState.currentLength = length;
+        }
+
+        size_t totalSize = metaData.dataTypeSize * signalState.currentLength;
+        if (doDeltaSignalUpdates && IsDeltaCapable(metaData)) {
+            CheckResult(DeserializeDeltaCapableValue(reader, codec, buffer, totalSize));
+        } else {
+            CheckResultWithMessage(codec.ReadData(reader, buffer, totalSize), "Could not read signal data.");
+        }
+
+        if (IsProtocolTracingEnabled()) {
+            LogProtData(IoDataToString(metaData.info, signalState.currentLength, buffer));
+        }
+
+        if (callbacks.incomingSignalsChangedCallback) {
+            _incomingSignalChanges.push_back({&metaData.info, signalState.currentLength, buffer});
+        } else if (callbacks.incomingSignalChangedCallback) {
+            callbacks.incomingSignalChangedCallback(simulationTime, metaData.info, signalState.currentLength, buffer);
+        }
+
+        return CreateOk();
+    }
+
+    // Sends a delta, if the receiver holds the previous value and at most half of the lines changed
+    template <typename TCodec>
+    [[nodiscard]] Result SerializeDeltaCapableValue(ChannelWriter& writer,
+                                                    TCodec& codec,
+                                                    const SignalMetaData& metaData,
+                                                    SignalValueState& signalState,
+                                                    size_t totalSize) {
+        const uint8_t* buffer = _arena + signalState.offset;
+        uint64_t* changedLineBits = GetChangedLineBits(metaData, signalState);
+        size_t lineCount = GetLineCount(totalSize);
+
+        size_t runCount = 0;
+        size_t changedLineCount = 0;
+        (void)ForEachChangedRun(changedLineBits, lineCount, [&](size_t begin, size_t end) {
+            runCount++;
+            changedLineCount += end - begin;
+            return CreateOk();
+        });
+
+        bool hasBase = signalState.fullValueGeneration == _fullValueGeneration;
+        ValueEncoding encoding = hasBase && (changedLineCount * 2 <= lineCount) ? ValueEncoding::Delta : ValueEncoding::Full;
+        CheckResultWithMessage(codec.WriteData(writer, &encoding, sizeof(encoding)), "Could not write value encoding.");
+
+        if (encoding == ValueEncoding::Full) {
+            CheckResultWithMessage(codec.WriteData(writer, buffer, totalSize), "Could not write signal data.");
+            signalState.fullValueGeneration = _fullValueGeneration;
+        } else {
+            CheckResultWithMessage(codec.WriteLength(writer, static_cast<uint32_t>(runCount)), "Could not write count of changed runs.");
+
+            size_t previousEnd = 0;
+            CheckResult(ForEachChangedRun(changedLineBits, lineCount, [&](size_t begin, size_t end) {
+                CheckResultWithMessage(codec.WriteLength(writer, static_cast<uint32_t>(begin - previousEnd)), "Could not write changed run offset.");
+                CheckResultWithMessage(codec.WriteLength(writer, static_cast<uint32_t>(end - begin)), "Could not write changed run length.");
+
+                size_t beginOffset = begin * CacheLineSize;
+                size_t endOffset = std::min(end * CacheLineSize, totalSize);
+                CheckResultWithMessage(codec.WriteData(writer, buffer + beginOffset, endOffset - beginOffset), "Could not write signal data.");
+                previousEnd = end;
+                return CreateOk();
+            }));
+        }
+
+        std::fill_n(changedLineBits, (GetLineCount(metaData.totalDataSize) + 63) / 64, uint64_t{0});
+        return CreateOk();
+    }
+
+    template <typename TCodec>
+    [[nodiscard]] Result DeserializeDeltaCapableValue(ChannelReader& reader, TCodec& codec, uint8_t* buffer, size_t totalSize) {
+        ValueEncoding encoding{};
+        CheckResultWithMessage(codec.ReadData(reader, &encoding, sizeof(encoding)), "Could not read value encoding.");
+        if (encoding == ValueEncoding::Full) {
+            CheckResultWithMessage(codec.ReadData(reader, buffer, totalSize), "Could not read signal data.");
+            return CreateOk();
+        }
+
+        if (encoding != ValueEncoding::Delta) {
+            LogError("Protocol error. Unknown value encoding {}.", static_cast<uint32_t>(encoding));
+            return CreateError();
+        }
+
+        uint32_t runCount{};
+        CheckResultWithMessage(codec.ReadLength(reader, runCount), "Could not read count of changed runs.");
+
+        size_t lineCount = GetLineCount(totalSize);
+        size_t previousEnd = 0;
+        for (uint32_t i = 0; i < runCount; i++) {
+            uint32_t distance{};
+            uint32_t length{};
+            CheckResultWithMessage(codec.ReadLength(reader, distance), "Could not read changed run offset.");
+            CheckResultWithMessage(codec.ReadLength(reader, length), "Could not read changed run length.");
+            if ((distance > lineCount - previousEnd) || (length > lineCount - previousEnd - distance)) {
+                LogError("Protocol error. Changed run exceeds the signal data.");
+                return CreateError();
             }
+
+            size_t begin = previousEnd + distance;
+            size_t end = begin + length;
+            size_t beginOffset = begin * CacheLineSize;
+            size_t endOffset = std::min(end * CacheLineSize, totalSize);
+            CheckResultWithMessage(codec.ReadData(reader, buffer + beginOffset, endOffset - beginOffset), "Could not read signal data.");
+            previousEnd = end;
         }
 
         return CreateOk();
     }
 
-private:
     IProtocol& _protocol;
     SignalRegistry _signalRegistry;
     std::vector<SignalValueState> _signalStates;
+    std::vector<uint8_t> _arenaStorage;
+    uint8_t* _arena{};
+    uint32_t _epoch{};
+    std::vector<uint64_t> _changedLineBits;
+    uint64_t _fullValueGeneration = 1;
     RingBuffer<SignalMetaDataPtr> _changedSignalsQueue;
+    std::vector<uint8_t> _bitmap;
+    // Collected while deserializing a step, if the batch callback is set
+    std::vector<IncomingSignalChange> _incomingSignalChanges;
 };
 
 }  // namespace DsVeosCoSim::SignalExchangeDetail
@@ -0,0 +1,512 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Channel.hpp"
+#include "CoSimTypes.hpp"
+#include "Logger.hpp"
+#include "Result.hpp"
+
+namespace DsVeosCoSim {
+
+constexpr size_t CanMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(BusMessageId) + sizeof(CanMessageFlags) + sizeof(uint32_t);
+constexpr size_t EthMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(EthMessageFlags) + sizeof(uint32_t);
+constexpr size_t LinMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(BusMessageId) + sizeof(LinMessageFlags) + sizeof(uint32_t);
+constexpr size_t FrMessageSize = sizeof(SimulationTime) + sizeof(BusControllerId) + sizeof(BusMessageId) + sizeof(FrMessageFlags) + sizeof(uint32_t);
+
+enum class StepEncoding : uint8_t {
+    // Fixed size fields up to protocol version 6
+    Fixed,
+    // Variable-length integers since protocol version 7
+    Varint
+};
+
+// Simulation times of the step frames, which are currently read and written. Bus message timestamps are encoded relative
+// to them
+struct StepContext {
+    StepEncoding encoding{};
+    SimulationTime readReferenceTime{};
+    SimulationTime writeReferenceTime{};
+};
+
+// The codecs encode the values of one list within a step frame. They are no interfaces on purpose. The exchanges instantiate
+// their serialization for each of them, so all fields of a list are encoded without any virtual call
+class FixedStepCodec final {
+public:
+    explicit FixedStepCodec(SimulationTime referenceTime) : _referenceTime(referenceTime) {
+    }
+
+    [[nodiscard]] SimulationTime GetReferenceTime() const {
+        return _referenceTime;
+    }
+
+    [[nodiscard]] static Result ReadSize(ChannelReader& reader, size_t& size) {
+        uint32_t intSize{};
+        CheckResult(reader.Read(intSize));
+        size = static_cast<size_t>(intSize);
+        return CreateOk();
+    }
+
+    [[nodiscard]] static Result WriteSize(ChannelWriter& writer, size_t size) {
+        if (size > UINT32_MAX) {
+            LogError("Size exceeds maximum supported value.");
+            return CreateError();
+        }
+
+        return writer.Write(static_cast<uint32_t>(size));
+    }
+
+    [[nodiscard]] static Result ReadLength(ChannelReader& reader, uint32_t& length) {
+        return reader.Read(length);
+    }
+
+    [[nodiscard]] static Result WriteLength(ChannelWriter& writer, uint32_t length) {
+        return writer.Write(length);
+    }
+
+    [[nodiscard]] static Result ReadSignalId(ChannelReader& reader, IoSignalId& signalId) {
+        return reader.Read(signalId);
+    }
+
+    [[nodiscard]] static Result WriteSignalId(ChannelWriter& writer, IoSignalId signalId) {
+        return writer.Write(signalId);
+    }
+
+    [[nodiscard]] static Result ReadData(ChannelReader& reader, void* data, size_t size) {
+        return reader.Read(data, size);
+    }
+
+    [[nodiscard]] static Result WriteData(ChannelWriter& writer, const void* data, size_t size) {
+        return writer.Write(data, size);
+    }
+
+    [[nodiscard]] static Result ReadMessage(ChannelReader& reader, CanMessageContainer& messageContainer) {
+        BlockReader blockReader;
+        CheckResult(reader.ReadBlock(CanMessageSize, blockReader));
+
+        ReadTimestamp(blockReader, messageContainer.timestamp);
+        blockReader.Read(messageContainer.controllerId);
+        blockReader.Read(messageContainer.id);
+        blockReader.Read(messageContainer.flags);
+        blockReader.Read(messageContainer.length);
+        blockReader.EndRead();
+
+        if (messageContainer.length > CanMessageMaxLength) {
+            LogError("CAN message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] static Result WriteMessage(ChannelWriter& writer, const CanMessageContainer& messageContainer) {
+        BlockWriter blockWriter;
+        CheckResult(writer.Reserve(CanMessageSize + messageContainer.length, blockWriter));
+
+        WriteTimestamp(blockWriter, messageContainer.timestamp);
+        blockWriter.Write(messageContainer.controllerId);
+        blockWriter.Write(messageContainer.id);
+        blockWriter.Write(messageContainer.flags);
+        blockWriter.Write(messageContainer.length);
+        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
+        blockWriter.EndWrite();
+        return CreateOk();
+    }
+
+    [[nodiscard]] static Result ReadMessage(ChannelReader& reader, EthMessageContainer& messageContainer) {
+        BlockReader blockReader;
+        CheckResult(reader.ReadBlock(EthMessageSize, blockReader));
+
+        ReadTimestamp(blockReader, messageContainer.timestamp);
+        blockReader.Read(messageContainer.controllerId);
+        blockReader.Read(messageContainer.flags);
+        blockReader.Read(messageContainer.length);
+        blockReader.EndRead();
+
+        if (messageContainer.length > EthMessageMaxLength) {
+            LogError("Ethernet message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] static Result WriteMessage(ChannelWriter& writer, const EthMessageContainer& messageContainer) {
+        BlockWriter blockWriter;
+        CheckResult(writer.Reserve(EthMessageSize + messageContainer.length, blockWriter));
+
+        WriteTimestamp(blockWriter, messageContainer.timestamp);
+        blockWriter.Write(messageContainer.controllerId);
+        blockWriter.Write(messageContainer.flags);
+        blockWriter.Write(messageContainer.length);
+        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
+        blockWriter.EndWrite();
+        return CreateOk();
+    }
+
+    [[nodiscard]] static Result ReadMessage(ChannelReader& reader, LinMessageContainer& messageContainer) {
+        BlockReader blockReader;
+        CheckResult(reader.ReadBlock(LinMessageSize, blockReader));
+
+        ReadTimestamp(blockReader, messageContainer.timestamp);
+        blockReader.Read(messageContainer.controllerId);
+        blockReader.Read(messageContainer.id);
+        blockReader.Read(messageContainer.flags);
+        blockReader.Read(messageContainer.length);
+        blockReader.EndRead();
+
+        if (messageContainer.length > LinMessageMaxLength) {
+            LogError("LIN message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] static Result WriteMessage(ChannelWriter& writer, const LinMessageContainer& messageContainer) {
+        BlockWriter blockWriter;
+        CheckResult(writer.Reserve(LinMessageSize + messageContainer.length, blockWriter));
+
+        WriteTimestamp(blockWriter, messageContainer.timestamp);
+        blockWriter.Write(messageContainer.controllerId);
+        blockWriter.Write(messageContainer.id);
+        blockWriter.Write(messageContainer.flags);
+        blockWriter.Write(messageContainer.length);
+        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
+        blockWriter.EndWrite();
+        return CreateOk();
+    }
+
+    [[nodiscard]] static Result ReadMessage(ChannelReader& reader, FrMessageContainer& messageContainer) {
+        BlockReader blockReader;
+        CheckResult(reader.ReadBlock(FrMessageSize, blockReader));
+
+        ReadTimestamp(blockReader, messageContainer.timestamp);
+        blockReader.Read(messageContainer.controllerId);
+        blockReader.Read(messageContainer.id);
+        blockReader.Read(messageContainer.flags);
+        blockReader.Read(messageContainer.length);
+        blockReader.EndRead();
+
+        if (messageContainer.length > FrMessageMaxLength) {
+            LogError("FlexRay message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] static Result WriteMessage(ChannelWriter& writer, const FrMessageContainer& messageContainer) {
+        BlockWriter blockWriter;
+        CheckResult(writer.Reserve(FrMessageSize + messageContainer.length, blockWriter));
+
+        WriteTimestamp(blockWriter, messageContainer.timestamp);
+        blockWriter.Write(messageContainer.controllerId);
+        blockWriter.Write(messageContainer.id);
+        blockWriter.Write(messageContainer.flags);
+        blockWriter.Write(messageContainer.length);
+        blockWriter.Write(messageContainer.data.data(), messageContainer.length);
+        blockWriter.EndWrite();
+        return CreateOk();
+    }
+
+private:
+    static void ReadTimestamp(BlockReader& reader, SimulationTime& timestamp) {
+        uint64_t tmpValue{};
+        reader.Read(tmpValue);
+        timestamp = SimulationTime(tmpValue);
+    }
+
+    static void WriteTimestamp(BlockWriter& writer, SimulationTime timestamp) {
+        writer.Write(static_cast<uint64_t>(timestamp.count()));
+    }
+
+    SimulationTime _referenceTime{};
+};
+
+// Sizes, lengths, ids and flags are variable-length integers. Signal ids are stored as difference to the previous id of the
+// same list and message timestamps as difference to the reference time
+class VarintStepCodec final {
+public:
+    explicit VarintStepCodec(SimulationTime referenceTime) : _referenceTime(referenceTime) {
+    }
+
+    [[nodiscard]] SimulationTime GetReferenceTime() const {
+        return _referenceTime;
+    }
+
+    [[nodiscard]] Result ReadSize(ChannelReader& reader, size_t& size) {
+        uint32_t value{};
+        CheckResult(ReadVarint(reader, value));
+        size = static_cast<size_t>(value);
+
+        // Every list of signal ids starts with its size
+        _lastSignalId = 0;
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteSize(ChannelWriter& writer, size_t size) {
+        if (size > UINT32_MAX) {
+            LogError("Size exceeds maximum supported value.");
+            return CreateError();
+        }
+
+        _lastSignalId = 0;
+        return WriteVarint(writer, size);
+    }
+
+    [[nodiscard]] static Result ReadLength(ChannelReader& reader, uint32_t& length) {
+        return ReadVarint(reader, length);
+    }
+
+    [[nodiscard]] static Result WriteLength(ChannelWriter& writer, uint32_t length) {
+        return WriteVarint(writer, length);
+    }
+
+    [[nodiscard]] Result ReadSignalId(ChannelReader& reader, IoSignalId& signalId) {
+        uint32_t delta{};
+        CheckResult(ReadVarint(reader, delta));
+
+        // Wraps around on purpose, so any order of ids is supported
+        _lastSignalId += static_cast<uint32_t>(DecodeZigZag(delta));
+        signalId = static_cast<IoSignalId>(_lastSignalId);
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result WriteSignalId(ChannelWriter& writer, IoSignalId signalId) {
+        auto id = static_cast<uint32_t>(signalId);
+        uint64_t delta = EncodeZigZag(static_cast<uint32_t>(id - _lastSignalId));
+        _lastSignalId = id;
+        return WriteVarint(writer, delta);
+    }
+
+    [[nodiscard]] static Result ReadData(ChannelReader& reader, void* data, size_t size) {
+        return reader.Read(data, size);
+    }
+
+    [[nodiscard]] static Result WriteData(ChannelWriter& writer, const void* data, size_t size) {
+        return writer.Write(data, size);
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, CanMessageContainer& messageContainer) const {
+        CheckResult(ReadTimestamp(reader, messageContainer.timestamp));
+        CheckResult(ReadVarint(reader, messageContainer.controllerId));
+        CheckResult(ReadVarint(reader, messageContainer.id));
+        CheckResult(ReadVarint(reader, messageContainer.flags));
+        CheckResult(ReadVarint(reader, messageContainer.length));
+
+        if (messageContainer.length > CanMessageMaxLength) {
+            LogError("CAN message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const CanMessageContainer& messageContainer) const {
+        MessageHeader header;
+        header.AddTimestamp(messageContainer.timestamp, _referenceTime);
+        header.Add(messageContainer.controllerId);
+        header.Add(messageContainer.id);
+        header.Add(messageContainer.flags);
+        header.Add(messageContainer.length);
+        return WriteMessage(writer, header, messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, EthMessageContainer& messageContainer) const {
+        CheckResult(ReadTimestamp(reader, messageContainer.timestamp));
+        CheckResult(ReadVarint(reader, messageContainer.controllerId));
+        CheckResult(ReadVarint(reader, messageContainer.flags));
+        CheckResult(ReadVarint(reader, messageContainer.length));
+
+        if (messageContainer.length > EthMessageMaxLength) {
+            LogError("Ethernet message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const EthMessageContainer& messageContainer) const {
+        MessageHeader header;
+        header.AddTimestamp(messageContainer.timestamp, _referenceTime);
+        header.Add(messageContainer.controllerId);
+        header.Add(messageContainer.flags);
+        header.Add(messageContainer.length);
+        return WriteMessage(writer, header, messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, LinMessageContainer& messageContainer) const {
+        CheckResult(ReadTimestamp(reader, messageContainer.timestamp));
+        CheckResult(ReadVarint(reader, messageContainer.controllerId));
+        CheckResult(ReadVarint(reader, messageContainer.id));
+        CheckResult(ReadVarint(reader, messageContainer.flags));
+        CheckResult(ReadVarint(reader, messageContainer.length));
+
+        if (messageContainer.length > LinMessageMaxLength) {
+            LogError("LIN message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const LinMessageContainer& messageContainer) const {
+        MessageHeader header;
+        header.AddTimestamp(messageContainer.timestamp, _referenceTime);
+        header.Add(messageContainer.controllerId);
+        header.Add(messageContainer.id);
+        header.Add(messageContainer.flags);
+        header.Add(messageContainer.length);
+        return WriteMessage(writer, header, messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] Result ReadMessage(ChannelReader& reader, FrMessageContainer& messageContainer) const {
+        CheckResult(ReadTimestamp(reader, messageContainer.timestamp));
+        CheckResult(ReadVarint(reader, messageContainer.controllerId));
+        CheckResult(ReadVarint(reader, messageContainer.id));
+        CheckResult(ReadVarint(reader, messageContainer.flags));
+        CheckResult(ReadVarint(reader, messageContainer.length));
+
+        if (messageContainer.length > FrMessageMaxLength) {
+            LogError("FlexRay message data exceeds maximum length.");
+            return CreateError();
+        }
+
+        return reader.Read(messageContainer.data.data(), messageContainer.length);
+    }
+
+    [[nodiscard]] Result WriteMessage(ChannelWriter& writer, const FrMessageContainer& messageContainer) const {
+        MessageHeader header;
+        header.AddTimestamp(messageContainer.timestamp, _referenceTime);
+        header.Add(messageContainer.controllerId);
+        header.Add(messageContainer.id);
+        header.Add(messageContainer.flags);
+        header.Add(messageContainer.length);
+        return WriteMessage(writer, header, messageContainer.data.data(), messageContainer.length);
+    }
+
+private:
+    static constexpr size_t MaxVarintSize = 10;
+
+    // Timestamp, controller id, message id, flags and length
+    static constexpr size_t MaxMessageHeaderSize = MaxVarintSize * 5;
+
+    class MessageHeader final {
+    public:
+        template <typename TValue>
+        void Add(TValue value) {
+            _size += EncodeVarint(static_cast<uint64_t>(value), &_data[_size]);
+        }
+
+        void AddTimestamp(SimulationTime timestamp, SimulationTime referenceTime) {
+            Add(EncodeZigZag(static_cast<uint64_t>(timestamp.count()) - static_cast<uint64_t>(referenceTime.count())));
+        }
+
+        [[nodiscard]] const uint8_t* GetData() const {
+            return _data;
+        }
+
+        [[nodiscard]] size_t GetSize() const {
+            return _size;
+        }
+
+    private:
+        uint8_t _data[MaxMessageHeaderSize]{};
+        size_t _size{};
+    };
+
+    [[nodiscard]] static uint64_t EncodeZigZag(uint64_t value) {
+        return (value << 1U) ^ (0U - (value >> 63U));
+    }
+
+    [[nodiscard]] static uint64_t EncodeZigZag(uint32_t value) {
+        return static_cast<uint32_t>((value << 1U) ^ (0U - (value >> 31U)));
+    }
+
+    [[nodiscard]] static uint64_t DecodeZigZag(uint64_t value) {
+        return (value >> 1U) ^ (0U - (value & 1U));
+    }
+
+    [[nodiscard]] static size_t EncodeVarint(uint64_t value, uint8_t* data) {
+        size_t size = 0;
+        while (value >= 0x80U) {
+            data[size++] = static_cast<uint8_t>(value | 0x80U);
+            value >>= 7U;
+        }
+
+        data[size++] = static_cast<uint8_t>(value);
+        return size;
+    }
+
+    [[nodiscard]] static Result WriteVarint(ChannelWriter& writer, uint64_t value) {
+        uint8_t data[MaxVarintSize];
+        size_t size = EncodeVarint(value, data);
+        return writer.Write(data, size);
+    }
+
+    [[nodiscard]] static Result ReadVarint(ChannelReader& reader, uint64_t& value) {
+        value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7) {
+            uint8_t byte{};
+            CheckResult(reader.Read(byte));
+            value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0) {
+                return CreateOk();
+            }
+        }
+
+        LogError("Protocol error. Variable-length integer is too long.");
+        return CreateError();
+    }
+
+    template <typename TValue>
+    [[nodiscard]] static Result ReadVarint(ChannelReader& reader, TValue& value) {
+        uint64_t tmpValue{};
+        CheckResult(ReadVarint(reader, tmpValue));
+        if (tmpValue > UINT32_MAX) {
+            LogError("Protocol error. Value exceeds maximum supported value.");
+            return CreateError();
+        }
+
+        value = static_cast<TValue>(tmpValue);
+        return CreateOk();
+    }
+
+    [[nodiscard]] Result ReadTimestamp(ChannelReader& reader, SimulationTime& timestamp) const {
+        uint64_t delta{};
+        CheckResult(ReadVarint(reader, delta));
+        timestamp = SimulationTime(static_cast<int64_t>(static_cast<uint64_t>(_referenceTime.count()) + DecodeZigZag(delta)));
+        return CreateOk();
+    }
+
+    [[nodiscard]] static Result WriteMessage(ChannelWriter& writer, const MessageHeader& header, const uint8_t* data, uint32_t length) {
+        BlockWriter blockWriter;
+        CheckResult(writer.Reserve(header.GetSize() + length, blockWriter));
+
+        blockWriter.Write(header.GetData(), header.GetSize());
+        blockWriter.Write(data, length);
+        blockWriter.EndWrite();
+        return CreateOk();
+    }
+
+    SimulationTime _referenceTime{};
+    uint32_t _lastSignalId{};
+};
+
+// Calls the function with the codec of the negotiated encoding. The function is instantiated for every codec
+template <typename Function>
+[[nodiscard]] Result WithStepCodec(StepEncoding encoding, SimulationTime referenceTime, const Function& function) {
+    if (encoding == StepEncoding::Varint) {
+        VarintStepCodec codec(referenceTime);
+        return function(codec);
+    }
+
+    FixedStepCodec codec(referenceTime);
+    return function(codec);
+}
+
+}  // namespace DsVeosCoSim
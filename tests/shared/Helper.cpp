@@ -233,6 +233,8 @@ void FillWithRandomData(uint8_t* data, size_t length) {
 [[nodiscard]] std::vector<uint8_t> GenerateIoData(const IoSignalContainer& signal) {
     std::vector<uint8_t> data = CreateZeroedIoData(signal);
     FillWithRandomData(data.data(), data.size());
+    // An all zero value equals the initial value and would not be detected as a change
+    data[0] |= 1U;
     return data;
 }
 
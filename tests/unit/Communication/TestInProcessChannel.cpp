@@ -0,0 +1,345 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Channel.hpp"
+#include "Helper.hpp"
+#include "Poller.hpp"
+#include "TestHelper.hpp"
+
+using namespace DsVeosCoSim;
+
+namespace {
+
+[[nodiscard]] std::string GenerateInProcessChannelName() {
+    return GenerateString("InProcessChannel");
+}
+
+void EstablishConnection(const std::string& name, std::unique_ptr<Channel>& connectChannel, std::unique_ptr<Channel>& acceptChannel) {
+    std::unique_ptr<ChannelServer> server;
+    AssertOk(CreateInProcessChannelServer(name, server));
+
+    AssertOk(TryConnectToInProcessChannel(name, connectChannel));
+
+    AssertOk(server->TryAccept(acceptChannel));
+}
+
+class TestInProcessChannel : public testing::Test {};
+
+TEST_F(TestInProcessChannel, StartServer) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<ChannelServer> server;
+
+    // Act
+    Result result = CreateInProcessChannelServer(name, server);
+
+    // Assert
+    AssertOk(result);
+}
+
+TEST_F(TestInProcessChannel, StartServerWithSameNameTwiceShouldFail) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<ChannelServer> server1;
+    AssertOk(CreateInProcessChannelServer(name, server1));
+
+    std::unique_ptr<ChannelServer> server2;
+
+    // Act
+    Result result = CreateInProcessChannelServer(name, server2);
+
+    // Assert
+    AssertError(result);
+}
+
+TEST_F(TestInProcessChannel, ConnectWithoutStart) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    {
+        std::unique_ptr<ChannelServer> server;
+        AssertOk(CreateInProcessChannelServer(name, server));
+    }
+
+    std::unique_ptr<Channel> connectChannel;
+
+    // Act
+    Result result = TryConnectToInProcessChannel(name, connectChannel);
+
+    // Assert
+    AssertNotConnected(result);
+}
+
+TEST_F(TestInProcessChannel, Connect) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<ChannelServer> server;
+    AssertOk(CreateInProcessChannelServer(name, server));
+
+    std::unique_ptr<Channel> connectChannel;
+
+    // Act
+    Result result = TryConnectToInProcessChannel(name, connectChannel);
+
+    // Assert
+    AssertOk(result);
+}
+
+TEST_F(TestInProcessChannel, AcceptWithoutConnect) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<ChannelServer> server;
+    AssertOk(CreateInProcessChannelServer(name, server));
+
+    std::unique_ptr<Channel> acceptChannel;
+
+    // Act
+    Result result = server->TryAccept(acceptChannel);
+
+    // Assert
+    AssertNotConnected(result);
+}
+
+TEST_F(TestInProcessChannel, Accept) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<ChannelServer> server;
+    AssertOk(CreateInProcessChannelServer(name, server));
+
+    std::unique_ptr<Channel> connectChannel;
+    AssertOk(TryConnectToInProcessChannel(name, connectChannel));
+
+    std::unique_ptr<Channel> acceptChannel;
+
+    // Act
+    Result result = server->TryAccept(acceptChannel);
+
+    // Assert
+    AssertOk(result);
+}
+
+// After disconnect, the server should still be able to accept it
+TEST_F(TestInProcessChannel, AcceptAfterDisconnect) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<ChannelServer> server;
+    AssertOk(CreateInProcessChannelServer(name, server));
+
+    std::unique_ptr<Channel> connectChannel;
+    AssertOk(TryConnectToInProcessChannel(name, connectChannel));
+
+    connectChannel->Disconnect();
+
+    std::unique_ptr<Channel> acceptChannel;
+
+    // Act
+    Result result = server->TryAccept(acceptChannel);
+
+    // Assert
+    AssertOk(result);
+}
+
+TEST_F(TestInProcessChannel, ReadUInt16FromChannel) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestReadUInt16FromChannel(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, ReadUInt32FromChannel) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestReadUInt32FromChannel(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, ReadUInt64FromChannel) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestReadUInt64FromChannel(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, ReadBufferFromChannel) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestReadBufferFromChannel(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, PingPong) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestPingPong(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, SendTwoFramesAtOnce) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestSendTwoFramesAtOnce(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, Stream) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestStream(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, SendAndReceiveBigElement) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestBigElement(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, SendAndReceiveElementSpanningManyFrames) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestElementSpanningManyFrames(connectChannel, acceptChannel);
+}
+
+TEST_F(TestInProcessChannel, ReceiveFramesSentBeforeDisconnect) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    uint32_t sendValue = GenerateU32();
+    AssertOk(connectChannel->GetWriter().Write(sendValue));
+    AssertOk(connectChannel->GetWriter().EndWrite());
+    connectChannel->Disconnect();
+
+    uint32_t receiveValue{};
+
+    // Act
+    Result result = acceptChannel->GetReader().Read(receiveValue);
+
+    // Assert
+    AssertOk(result);
+    ASSERT_EQ(sendValue, receiveValue);
+    AssertNotConnected(acceptChannel->GetReader().Read(receiveValue));
+    AssertNotConnected(acceptChannel->GetWriter().EndWrite());
+}
+
+#ifndef _WIN32
+
+TEST_F(TestInProcessChannel, WriteMakesFileDescriptorOfReaderReadable) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    std::vector<int32_t> fileDescriptors;
+    acceptChannel->GetFileDescriptors(fileDescriptors);
+
+    Poller poller;
+    AssertOk(Poller::Create(poller));
+    AssertOk(poller.SetFileDescriptors(fileDescriptors));
+    AssertTimeout(poller.Wait(0));
+
+    uint32_t sendValue = GenerateU32();
+
+    // Act
+    AssertOk(connectChannel->GetWriter().Write(sendValue));
+    AssertOk(connectChannel->GetWriter().EndWrite());
+
+    // Assert
+    AssertOk(poller.Wait(DefaultTimeoutInMilliseconds));
+
+    uint32_t receiveValue{};
+    AssertOk(acceptChannel->GetReader().Read(receiveValue));
+    acceptChannel->GetReader().EndRead();
+    ASSERT_EQ(sendValue, receiveValue);
+    AssertTimeout(poller.Wait(0));
+}
+
+TEST_F(TestInProcessChannel, DisconnectMakesFileDescriptorOfCounterpartReadable) {
+    // Arrange
+    std::string name = GenerateInProcessChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    std::vector<int32_t> fileDescriptors;
+    acceptChannel->GetFileDescriptors(fileDescriptors);
+
+    Poller poller;
+    AssertOk(Poller::Create(poller));
+    AssertOk(poller.SetFileDescriptors(fileDescriptors));
+
+    // Act
+    connectChannel->Disconnect();
+
+    // Assert
+    AssertOk(poller.Wait(DefaultTimeoutInMilliseconds));
+}
+
+#endif
+
+}  // namespace
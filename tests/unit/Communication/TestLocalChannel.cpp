@@ -1,12 +1,15 @@
 // Copyright dSPACE SE & Co. KG. All rights reserved.
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "Channel.hpp"
 #include "Helper.hpp"
+#include "Poller.hpp"
 #include "TestHelper.hpp"
 
 using namespace DsVeosCoSim;
@@ -228,4 +231,74 @@ TEST_F(TestLocalChannel, SendAndReceiveBigElement) {
     TestBigElement(connectChannel, acceptChannel);
 }
 
+TEST_F(TestLocalChannel, SendAndReceiveElementSpanningManyFrames) {
+    // Arrange
+    std::string name = GenerateLocalChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestElementSpanningManyFrames(connectChannel, acceptChannel);
+}
+
+#ifndef _WIN32
+
+TEST_F(TestLocalChannel, WriteMakesFileDescriptorOfReaderReadable) {
+    // Arrange
+    std::string name = GenerateLocalChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    std::vector<int32_t> fileDescriptors;
+    acceptChannel->GetFileDescriptors(fileDescriptors);
+
+    Poller poller;
+    AssertOk(Poller::Create(poller));
+    AssertOk(poller.SetFileDescriptors(fileDescriptors));
+    AssertTimeout(poller.Wait(0));
+
+    uint32_t sendValue = GenerateU32();
+
+    // Act
+    AssertOk(connectChannel->GetWriter().Write(sendValue));
+    AssertOk(connectChannel->GetWriter().EndWrite());
+
+    // Assert
+    AssertOk(poller.Wait(DefaultTimeoutInMilliseconds));
+
+    uint32_t receiveValue{};
+    AssertOk(acceptChannel->GetReader().Read(receiveValue));
+    acceptChannel->GetReader().EndRead();
+    ASSERT_EQ(sendValue, receiveValue);
+    AssertTimeout(poller.Wait(0));
+}
+
+TEST_F(TestLocalChannel, DisconnectMakesFileDescriptorOfCounterpartReadable) {
+    // Arrange
+    std::string name = GenerateLocalChannelName();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(name, connectChannel, acceptChannel);
+
+    std::vector<int32_t> fileDescriptors;
+    acceptChannel->GetFileDescriptors(fileDescriptors);
+
+    Poller poller;
+    AssertOk(Poller::Create(poller));
+    AssertOk(poller.SetFileDescriptors(fileDescriptors));
+
+    // Act
+    connectChannel->Disconnect();
+
+    // Assert
+    AssertOk(poller.Wait(DefaultTimeoutInMilliseconds));
+}
+
+#endif
+
 }  // namespace
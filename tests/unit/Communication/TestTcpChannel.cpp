@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 
 #include "Channel.hpp"
+#include "Helper.hpp"
 #include "Socket.hpp"
 #include "TestHelper.hpp"
 
@@ -333,6 +334,31 @@ TEST_P(TestTcpChannel, SendTwoFramesAtOnce) {
     TestSendTwoFramesAtOnce(connectChannel, acceptChannel);
 }
 
+TEST_P(TestTcpChannel, ReceiveTwoFramesWithOneReceiveCall) {
+    // Arrange
+    TcpChannelParam param = GetParam();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(param, connectChannel, acceptChannel);
+
+    AssertOk(connectChannel->GetWriter().Write(GenerateU32()));
+    AssertOk(connectChannel->GetWriter().EndWrite());
+    AssertOk(connectChannel->GetWriter().Write(GenerateU64()));
+    AssertOk(connectChannel->GetWriter().EndWrite());
+
+    // Act
+    uint32_t receiveValue1{};
+    uint64_t receiveValue2{};
+    AssertOk(acceptChannel->GetReader().Read(receiveValue1));
+    AssertOk(acceptChannel->GetReader().Read(receiveValue2));
+
+    // Assert
+    const ChannelReaderStatistics& statistics = acceptChannel->GetReader().GetStatistics();
+    ASSERT_EQ(2U, statistics.frameCount);
+    ASSERT_EQ(1U, statistics.receiveCount);
+}
+
 TEST_P(TestTcpChannel, Stream) {
     // Arrange
     TcpChannelParam param = GetParam();
@@ -357,4 +383,87 @@ TEST_P(TestTcpChannel, SendAndReceiveBigElement) {
     TestBigElement(connectChannel, acceptChannel);
 }
 
+TEST_P(TestTcpChannel, SendAndReceiveElementSpanningManyFrames) {
+    // Arrange
+    TcpChannelParam param = GetParam();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(param, connectChannel, acceptChannel);
+
+    // Act and assert
+    TestElementSpanningManyFrames(connectChannel, acceptChannel);
+}
+
+TEST_P(TestTcpChannel, SendAndReceiveElementSpanningManyFramesWithIncreasedFrameSize) {
+    // Arrange
+    TcpChannelParam param = GetParam();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(param, connectChannel, acceptChannel);
+
+    connectChannel->GetWriter().SetMaxFrameSize(4 * BufferSize);
+    acceptChannel->GetReader().SetMaxFrameSize(4 * BufferSize);
+
+    // Act and assert
+    TestElementSpanningManyFrames(connectChannel, acceptChannel);
+}
+
+TEST_P(TestTcpChannel, TryReceiveFrameWaitsForCompleteFrame) {
+    // Arrange
+    TcpChannelParam param = GetParam();
+
+    std::unique_ptr<ChannelServer> server;
+    AssertOk(CreateTcpChannelServer(0, param.enableRemoteAccess, server));
+
+    SocketClient connectClient;
+    AssertOk(SocketClient::TryConnect(GetLoopBackAddress(param.addressFamily), server->GetLocalPort(), 0, DefaultTimeoutInMilliseconds, connectClient));
+
+    std::unique_ptr<Channel> acceptChannel;
+    AssertOk(server->TryAccept(acceptChannel));
+
+    uint32_t sendValue = GenerateU32();
+    int32_t frameSize = HeaderSize + static_cast<int32_t>(sizeof(sendValue));
+    AssertOk(connectClient.Send(&frameSize, sizeof(frameSize)));
+    AssertOk(connectClient.Send(&sendValue, 2));
+    AssertOk(acceptChannel->GetReader().WaitForData(DefaultTimeoutInMilliseconds));
+
+    // Act
+    Result resultOfIncompleteFrame = acceptChannel->GetReader().TryReceiveFrame();
+    AssertOk(connectClient.Send(reinterpret_cast<uint8_t*>(&sendValue) + 2, 2));
+    AssertOk(acceptChannel->GetReader().WaitForData(DefaultTimeoutInMilliseconds));
+    Result resultOfCompleteFrame = acceptChannel->GetReader().TryReceiveFrame();
+
+    // Assert
+    AssertTimeout(resultOfIncompleteFrame);
+    AssertOk(resultOfCompleteFrame);
+    uint32_t receiveValue{};
+    AssertOk(acceptChannel->GetReader().Read(receiveValue));
+    acceptChannel->GetReader().EndRead();
+    ASSERT_EQ(sendValue, receiveValue);
+}
+
+TEST_P(TestTcpChannel, ReceiveFrameExceedingMaxFrameSizeShouldFail) {
+    // Arrange
+    TcpChannelParam param = GetParam();
+
+    std::unique_ptr<Channel> connectChannel;
+    std::unique_ptr<Channel> acceptChannel;
+    EstablishConnection(param, connectChannel, acceptChannel);
+
+    connectChannel->GetWriter().SetMaxFrameSize(4 * BufferSize);
+
+    std::vector<uint8_t> sendBuffer(2 * BufferSize);
+    AssertOk(connectChannel->GetWriter().Write(sendBuffer.data(), sendBuffer.size()));
+    AssertOk(connectChannel->GetWriter().EndWrite());
+
+    // Act
+    uint8_t value{};
+    Result result = acceptChannel->GetReader().Read(value);
+
+    // Assert
+    AssertError(result);
+}
+
 }  // namespace
@@ -5,6 +5,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -61,8 +62,6 @@ using namespace DsVeosCoSim;
     return CreateBusExchange(coSimType, connectionKind, name, {}, {}, {}, controllers, protocol, busExchange);
 }
 
-#ifdef _WIN32
-
 void TestSendAfterDisconnectOnRemoteClient(ShmPipeClient& client1, ShmPipeClient& client2) {
     // Arrange
     client1.Disconnect();
@@ -76,8 +75,6 @@ void TestSendAfterDisconnectOnRemoteClient(ShmPipeClient& client1, ShmPipeClient
     AssertNotConnected(result);
 }
 
-#endif
-
 void TestWriteUInt16ToChannel(std::unique_ptr<Channel>& writeChannel) {
     uint16_t sendValue = GenerateU16();
 
@@ -286,6 +283,40 @@ void TestBigElement(std::unique_ptr<Channel>& writeChannel, std::unique_ptr<Chan
     thread.join();
 }
 
+void TestElementSpanningManyFrames(std::unique_ptr<Channel>& writeChannel, std::unique_ptr<Channel>& readChannel) {
+    constexpr size_t Count = 0x40000;
+
+    std::thread thread([&] {
+        uint16_t firstValue{};
+        AssertOk(readChannel->GetReader().Read(firstValue));
+        ASSERT_EQ(static_cast<uint16_t>(42), firstValue);
+
+        std::vector<size_t> receiveArray(Count);
+        AssertOk(readChannel->GetReader().Read(receiveArray.data(), receiveArray.size() * sizeof(size_t)));
+
+        uint16_t lastValue{};
+        AssertOk(readChannel->GetReader().Read(lastValue));
+        ASSERT_EQ(static_cast<uint16_t>(43), lastValue);
+
+        for (size_t i = 0; i < receiveArray.size(); i++) {
+            ASSERT_EQ(i, receiveArray[i]);
+        }
+    });
+
+    std::vector<size_t> sendArray(Count);
+    for (size_t i = 0; i < sendArray.size(); i++) {
+        sendArray[i] = i;
+    }
+
+    // Act and assert
+    AssertOk(writeChannel->GetWriter().Write(static_cast<uint16_t>(42)));  // Forcing the following elements to be unaligned
+    AssertOk(writeChannel->GetWriter().Write(sendArray.data(), sendArray.size() * sizeof(size_t)));
+    AssertOk(writeChannel->GetWriter().Write(static_cast<uint16_t>(43)));
+    AssertOk(writeChannel->GetWriter().EndWrite());
+
+    thread.join();
+}
+
 namespace DsVeosCoSim {
 
 std::ostream& operator<<(std::ostream& stream, SimulationTime simulationTime) {
@@ -16,12 +16,8 @@
 #include "Protocol.hpp"
 #include "Socket.hpp"
 
-#ifdef _WIN32
-
 #include "OsUtilities.hpp"
 
-#endif
-
 [[maybe_unused]] constexpr uint32_t DefaultTimeoutInMilliseconds = 1000;
 
 #define AssertOk(result) ASSERT_EQ(result, DsVeosCoSim::CreateOk())
@@ -142,12 +138,8 @@ void TestPingPong(TClient& client1, TClient& client2) {
     }
 }
 
-#ifdef _WIN32
-
 void TestSendAfterDisconnectOnRemoteClient(DsVeosCoSim::ShmPipeClient& client1, DsVeosCoSim::ShmPipeClient& client2);
 
-#endif
-
 [[nodiscard]] DsVeosCoSim::CoSimType GetCounterPart(DsVeosCoSim::CoSimType coSimType);
 [[nodiscard]] std::string GetCounterPart(const std::string& name, DsVeosCoSim::ConnectionKind connectionKind);
 
@@ -196,6 +188,7 @@ void TestSendTwoFramesAtOnce(std::unique_ptr<DsVeosCoSim::Channel>& writeChannel
 void TestStream(std::unique_ptr<DsVeosCoSim::Channel>& writeChannel, std::unique_ptr<DsVeosCoSim::Channel>& readChannel);
 
 void TestBigElement(std::unique_ptr<DsVeosCoSim::Channel>& writeChannel, std::unique_ptr<DsVeosCoSim::Channel>& readChannel);
+void TestElementSpanningManyFrames(std::unique_ptr<DsVeosCoSim::Channel>& writeChannel, std::unique_ptr<DsVeosCoSim::Channel>& readChannel);
 
 namespace DsVeosCoSim {
 
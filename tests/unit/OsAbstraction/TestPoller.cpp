@@ -0,0 +1,118 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#ifndef _WIN32
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "OsUtilities.hpp"
+#include "Poller.hpp"
+#include "Socket.hpp"
+#include "TestHelper.hpp"
+
+using namespace DsVeosCoSim;
+
+namespace {
+
+class TestPoller : public testing::Test {};
+
+TEST_F(TestPoller, CreateShouldWork) {
+    // Arrange
+    Poller poller;
+
+    // Act
+    Result result = Poller::Create(poller);
+
+    // Assert
+    AssertOk(result);
+    ASSERT_TRUE(poller.IsValid());
+}
+
+TEST_F(TestPoller, WaitWithoutReadableFileDescriptorShouldTimeOut) {
+    // Arrange
+    SocketListener listener;
+    AssertOk(SocketListener::Create(AddressFamily::Ipv4, 0, false, listener));
+
+    Poller poller;
+    AssertOk(Poller::Create(poller));
+    AssertOk(poller.SetFileDescriptors({listener.GetHandle().Get()}));
+
+    // Act
+    Result result = poller.Wait(1);
+
+    // Assert
+    AssertTimeout(result);
+}
+
+TEST_F(TestPoller, WaitShouldReturnWhenClientConnects) {
+    // Arrange
+    SocketListener listener;
+    AssertOk(SocketListener::Create(AddressFamily::Ipv4, 0, false, listener));
+    uint16_t port{};
+    AssertOk(listener.GetLocalPort(port));
+
+    Poller poller;
+    AssertOk(Poller::Create(poller));
+    AssertOk(poller.SetFileDescriptors({listener.GetHandle().Get()}));
+
+    SocketClient connectClient;
+    AssertOk(SocketClient::TryConnect("127.0.0.1", port, 0, 0, connectClient));
+
+    // Act
+    Result result = poller.Wait(Infinite);
+
+    // Assert
+    AssertOk(result);
+}
+
+TEST_F(TestPoller, WaitOnNestedPollerShouldReturnWhenClientConnects) {
+    // Arrange
+    SocketListener listener;
+    AssertOk(SocketListener::Create(AddressFamily::Ipv4, 0, false, listener));
+    uint16_t port{};
+    AssertOk(listener.GetLocalPort(port));
+
+    Poller innerPoller;
+    AssertOk(Poller::Create(innerPoller));
+    AssertOk(innerPoller.SetFileDescriptors({listener.GetHandle().Get()}));
+
+    Poller outerPoller;
+    AssertOk(Poller::Create(outerPoller));
+    AssertOk(outerPoller.SetFileDescriptors({innerPoller.GetFileDescriptor()}));
+
+    SocketClient connectClient;
+    AssertOk(SocketClient::TryConnect("127.0.0.1", port, 0, 0, connectClient));
+
+    // Act
+    Result result = outerPoller.Wait(Infinite);
+
+    // Assert
+    AssertOk(result);
+}
+
+TEST_F(TestPoller, SetFileDescriptorsShouldReplacePreviousOnes) {
+    // Arrange
+    SocketListener listener;
+    AssertOk(SocketListener::Create(AddressFamily::Ipv4, 0, false, listener));
+    uint16_t port{};
+    AssertOk(listener.GetLocalPort(port));
+
+    Poller poller;
+    AssertOk(Poller::Create(poller));
+    AssertOk(poller.SetFileDescriptors({listener.GetHandle().Get()}));
+
+    SocketClient connectClient;
+    AssertOk(SocketClient::TryConnect("127.0.0.1", port, 0, 0, connectClient));
+
+    // Act
+    AssertOk(poller.SetFileDescriptors({}));
+
+    // Assert
+    AssertTimeout(poller.Wait(1));
+}
+
+}  // namespace
+
+#endif
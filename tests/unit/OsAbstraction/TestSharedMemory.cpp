@@ -1,7 +1,5 @@
 // Copyright dSPACE SE & Co. KG. All rights reserved.
 
-#ifdef _WIN32
-
 #include <string>
 
 #include <gtest/gtest.h>
@@ -102,6 +100,27 @@ TEST_F(TestSharedMemory, CouldNotOpenNonExisting) {
     AssertNotConnected(result);
 }
 
-}  // namespace
+#ifndef _WIN32
+
+TEST_F(TestSharedMemory, CloseShouldNotRemoveNameOfRecreatedSharedMemory) {
+    // Arrange
+    std::string name = GenerateSharedMemoryName();
+
+    SharedMemory oldSharedMemory;
+    AssertOk(SharedMemory::CreateOrOpen(name, 100, oldSharedMemory));
+    oldSharedMemory.Unlink();
+
+    SharedMemory newSharedMemory;
+    AssertOk(SharedMemory::CreateOrOpen(name, 100, newSharedMemory));
+
+    // Act
+    oldSharedMemory.Close();
+
+    // Assert
+    SharedMemory sharedMemory;
+    AssertOk(SharedMemory::TryOpenExisting(name, 100, sharedMemory));
+}
 
 #endif
+
+}  // namespace
@@ -1,7 +1,5 @@
 // Copyright dSPACE SE & Co. KG. All rights reserved.
 
-#ifdef _WIN32
-
 #include <chrono>
 #include <future>
 #include <string>
@@ -77,6 +75,40 @@ TEST_F(TestShmPipe, CreateListenerShouldWork) {
     AssertOk(result);
 }
 
+TEST_F(TestShmPipe, CreateSecondListenerWithSameNameShouldNotWork) {
+    // Arrange
+    std::string name = GenerateShmPipeName();
+
+    ShmPipeListener listener1;
+    AssertOk(ShmPipeListener::Create(name, listener1));
+
+    ShmPipeListener listener2;
+
+    // Act
+    Result result = ShmPipeListener::Create(name, listener2);
+
+    // Assert
+    AssertError(result);
+    ASSERT_TRUE(listener1.IsRunning());
+}
+
+TEST_F(TestShmPipe, CreateListenerAfterStopShouldWork) {
+    // Arrange
+    std::string name = GenerateShmPipeName();
+
+    ShmPipeListener listener1;
+    AssertOk(ShmPipeListener::Create(name, listener1));
+    listener1.Stop();
+
+    ShmPipeListener listener2;
+
+    // Act
+    Result result = ShmPipeListener::Create(name, listener2);
+
+    // Assert
+    AssertOk(result);
+}
+
 TEST_F(TestShmPipe, ConnectToListeningSocketShouldWork) {
     // Arrange
     std::string name = GenerateShmPipeName();
@@ -491,5 +523,3 @@ TEST_F(TestShmPipe, WaitForDataTimesOutWhenNoDataArrives) {
 }
 
 }  // namespace
-
-#endif
@@ -447,6 +447,102 @@ TEST_P(TestTcpSocket, SendBigElementFromConnectClientToAcceptClientShouldWork) {
     TestBigElement(connectClient, acceptClient);
 }
 
+TEST_P(TestTcpSocket, SendManyBuffersAtOnceFromConnectClientToAcceptClientShouldWork) {
+    // Arrange
+    TcpSocketParam param = GetParam();
+
+    SocketClient connectClient;
+    SocketClient acceptClient;
+    EstablishConnection(param, connectClient, acceptClient);
+
+    constexpr size_t Count = 200;
+    std::vector<size_t> sendValues(Count);
+    std::vector<SendBuffer> sendBuffers(Count);
+    for (size_t i = 0; i < Count; i++) {
+        sendValues[i] = i;
+        sendBuffers[i] = {&sendValues[i], sizeof(size_t)};
+    }
+
+    std::thread thread([&] {
+        std::vector<size_t> receiveValues(Count);
+        AssertOk(ReceiveComplete(acceptClient, receiveValues.data(), receiveValues.size() * sizeof(size_t)));
+        ASSERT_EQ(sendValues, receiveValues);
+    });
+
+    // Act
+    Result result = connectClient.Send(sendBuffers.data(), sendBuffers.size());
+
+    // Assert
+    AssertOk(result);
+    thread.join();
+}
+
+TEST_P(TestTcpSocket, SendAndReceiveInOneCallShouldWork) {
+    // Arrange
+    TcpSocketParam param = GetParam();
+
+    SocketClient connectClient;
+    SocketClient acceptClient;
+    EstablishConnection(param, connectClient, acceptClient);
+
+    // Falls back to separate calls, if io_uring is not available
+    (void)connectClient.TryEnableIoUring();
+
+    constexpr size_t Count = 0x40000;
+    std::vector<size_t> sendValues(Count);
+    for (size_t i = 0; i < Count; i++) {
+        sendValues[i] = i;
+    }
+
+    uint32_t replyValue = GenerateU32();
+    std::thread thread([&] {
+        std::vector<size_t> receiveValues(Count);
+        AssertOk(ReceiveComplete(acceptClient, receiveValues.data(), receiveValues.size() * sizeof(size_t)));
+        ASSERT_EQ(sendValues, receiveValues);
+        AssertOk(acceptClient.Send(&replyValue, sizeof(replyValue)));
+    });
+
+    uint32_t receiveValue{};
+    size_t receivedSize{};
+
+    // Act
+    Result result = connectClient.SendAndReceive(sendValues.data(), sendValues.size() * sizeof(size_t), &receiveValue, sizeof(receiveValue), receivedSize);
+
+    // Assert
+    AssertOk(result);
+    thread.join();
+    ASSERT_EQ(sizeof(receiveValue), receivedSize);
+    ASSERT_EQ(replyValue, receiveValue);
+}
+
+TEST_P(TestTcpSocket, SendAndReceiveInOneCallOnDisconnectedRemoteClientShouldNotWork) {
+    // Arrange
+    TcpSocketParam param = GetParam();
+
+    SocketClient connectClient;
+    SocketClient acceptClient;
+    EstablishConnection(param, connectClient, acceptClient);
+
+    (void)connectClient.TryEnableIoUring();
+
+    std::thread thread([&] {
+        uint32_t value{};
+        AssertOk(ReceiveComplete(acceptClient, &value, sizeof(value)));
+        acceptClient.Disconnect();
+    });
+
+    uint32_t sendValue = GenerateU32();
+    uint32_t receiveValue{};
+    size_t receivedSize{};
+
+    // Act
+    Result result = connectClient.SendAndReceive(&sendValue, sizeof(sendValue), &receiveValue, sizeof(receiveValue), receivedSize);
+
+    // Assert
+    thread.join();
+    AssertNotConnected(result);
+}
+
 TEST_P(TestTcpSocket, SendOnDisconnectedConnectClientShouldNotWork) {
     // Arrange
     TcpSocketParam param = GetParam();
@@ -498,4 +594,68 @@ TEST_P(TestTcpSocket, WaitForDataTimesOutWhenNoDataArrives) {
     AssertTimeout(result);
 }
 
+TEST_P(TestTcpSocket, TryReceiveWithoutDataReturnsImmediately) {
+    // Arrange
+    TcpSocketParam param = GetParam();
+
+    SocketClient connectClient;
+    SocketClient acceptClient;
+    EstablishConnection(param, connectClient, acceptClient);
+
+    uint32_t receiveValue{};
+    size_t receivedSize = 1;
+
+    // Act
+    Result result = acceptClient.TryReceive(&receiveValue, sizeof(receiveValue), receivedSize);
+
+    // Assert
+    AssertOk(result);
+    ASSERT_EQ(0U, receivedSize);
+}
+
+TEST_P(TestTcpSocket, TryReceiveAfterSendReceivesData) {
+    // Arrange
+    TcpSocketParam param = GetParam();
+
+    SocketClient connectClient;
+    SocketClient acceptClient;
+    EstablishConnection(param, connectClient, acceptClient);
+
+    uint32_t sendValue = GenerateU32();
+    AssertOk(connectClient.Send(&sendValue, sizeof(sendValue)));
+    AssertOk(acceptClient.WaitForData(DefaultTimeoutInMilliseconds));
+
+    uint32_t receiveValue{};
+    size_t receivedSize{};
+
+    // Act
+    Result result = acceptClient.TryReceive(&receiveValue, sizeof(receiveValue), receivedSize);
+
+    // Assert
+    AssertOk(result);
+    ASSERT_EQ(sizeof(receiveValue), receivedSize);
+    ASSERT_EQ(sendValue, receiveValue);
+}
+
+TEST_P(TestTcpSocket, TryReceiveOnDisconnectedRemoteClientShouldNotWork) {
+    // Arrange
+    TcpSocketParam param = GetParam();
+
+    SocketClient connectClient;
+    SocketClient acceptClient;
+    EstablishConnection(param, connectClient, acceptClient);
+
+    connectClient.Disconnect();
+    AssertOk(acceptClient.WaitForData(DefaultTimeoutInMilliseconds));
+
+    uint32_t receiveValue{};
+    size_t receivedSize{};
+
+    // Act
+    Result result = acceptClient.TryReceive(&receiveValue, sizeof(receiveValue), receivedSize);
+
+    // Assert
+    AssertNotConnected(result);
+}
+
 }  // namespace
@@ -3,9 +3,11 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "BusExchange.hpp"
@@ -199,6 +201,55 @@ protected:
 
         ASSERT_TRUE(expectedCallbacks.empty());
     }
+
+    void TransferBatch(ConnectionKind connectionKind,
+                       BusExchange& senderBusExchange,
+                       BusExchange& receiverBusExchange,
+                       const std::vector<TMessageContainer>& expectedMessageContainers) {
+        ChannelReader& reader = connectionKind == ConnectionKind::Remote ? _remoteReceiverChannel->GetReader() : _localReceiverChannel->GetReader();
+        ChannelWriter& writer = connectionKind == ConnectionKind::Remote ? _remoteSenderChannel->GetWriter() : _localSenderChannel->GetWriter();
+
+        SimulationTime expectedSimulationTime = GenerateSimulationTime();
+
+        size_t callCount = 0;
+        auto batchCallback = [&](SimulationTime simulationTime, const TMessageContainer* messageContainers, uint32_t count) {
+            ASSERT_EQ(simulationTime, expectedSimulationTime);
+            std::vector<TMessageContainer> receivedMessageContainers(messageContainers, messageContainers + count);
+            ASSERT_THAT(receivedMessageContainers, ContainerEq(expectedMessageContainers));
+            callCount++;
+        };
+        auto singleCallback = [&](SimulationTime, const TController&, const TMessageContainer&) {
+            FAIL() << "Single message container callback must not be called if the batch callback is set.";
+        };
+
+        Callbacks callbacks{};
+        if constexpr (std::is_same_v<TController, CanController>) {
+            callbacks.canMessageContainersReceivedCallback = batchCallback;
+            callbacks.canMessageContainerReceivedCallback = singleCallback;
+        }
+
+        if constexpr (std::is_same_v<TController, EthController>) {
+            callbacks.ethMessageContainersReceivedCallback = batchCallback;
+            callbacks.ethMessageContainerReceivedCallback = singleCallback;
+        }
+
+        if constexpr (std::is_same_v<TController, LinController>) {
+            callbacks.linMessageContainersReceivedCallback = batchCallback;
+            callbacks.linMessageContainerReceivedCallback = singleCallback;
+        }
+
+        if constexpr (std::is_same_v<TController, FrController>) {
+            callbacks.frMessageContainersReceivedCallback = batchCallback;
+            callbacks.frMessageContainerReceivedCallback = singleCallback;
+        }
+
+        AssertOk(senderBusExchange.Serialize(writer));
+        AssertOk(writer.EndWrite());
+
+        AssertOk(receiverBusExchange.Deserialize(reader, expectedSimulationTime, callbacks));
+
+        ASSERT_EQ(expectedMessageContainers.empty() ? 0U : 1U, callCount);
+    }
 };
 
 template <typename Types>
@@ -743,6 +794,58 @@ TYPED_TEST(TestBusExchange, ReceiveTransmittedMessageContainersByEventWithTransf
     TestBusExchange<TypeParam>::Transfer(connectionKind, *senderBusExchange, *receiverBusExchange, expectedEvents);
 }
 
+TYPED_TEST(TestBusExchange, ReceiveTransmittedMessageContainersByBatchEvent) {
+    using TControllerContainer = typename TypeParam::ControllerContainer;
+    using TController = typename TypeParam::Controller;
+    using TMessageContainer = typename TypeParam::MessageContainer;
+
+    CoSimType coSimType = TypeParam::GetCoSimType();
+    ConnectionKind connectionKind = TypeParam::GetConnectionKind();
+
+    // Arrange
+    std::string name = GenerateString("BusExchange名前");
+
+    TControllerContainer controllerContainer1{};
+    FillWithRandom(controllerContainer1);
+
+    TController controller1 = controllerContainer1.Convert();
+
+    TControllerContainer controllerContainer2{};
+    FillWithRandom(controllerContainer2);
+
+    TController controller2 = controllerContainer2.Convert();
+
+    std::unique_ptr<IProtocol> protocol;
+    AssertOk(CreateProtocol(ProtocolVersionLatest, protocol));
+
+    std::unique_ptr<BusExchange> senderBusExchange;
+    AssertOk(CreateBusExchange(coSimType, connectionKind, name, {controller1, controller2}, *protocol, senderBusExchange));
+
+    std::unique_ptr<BusExchange> receiverBusExchange;
+    AssertOk(CreateBusExchange(GetCounterPart(coSimType),
+                               connectionKind,
+                               GetCounterPart(name, connectionKind),
+                               {controller1, controller2},
+                               *protocol,
+                               receiverBusExchange));
+
+    std::vector<TMessageContainer> expectedMessageContainers;
+
+    for (uint32_t i = 0; i < controller1.queueSize + controller2.queueSize; i++) {
+        TController* controller = (i % 2) == 0 ? &controller1 : &controller2;
+
+        TMessageContainer sendMessageContainer{};
+        FillWithRandom(sendMessageContainer, controller->id);
+
+        expectedMessageContainers.push_back(sendMessageContainer);
+        AssertOk(senderBusExchange->Transmit(sendMessageContainer));
+    }
+
+    // Act and assert
+    TestBusExchange<TypeParam>::TransferBatch(connectionKind, *senderBusExchange, *receiverBusExchange, expectedMessageContainers);
+    TestBusExchange<TypeParam>::TransferBatch(connectionKind, *senderBusExchange, *receiverBusExchange, {});
+}
+
 TYPED_TEST(TestBusExchange, DoNotReceiveNotFullyTransmittedMessageContainer) {
     using TControllerContainer = typename TypeParam::ControllerContainer;
     using TController = typename TypeParam::Controller;
@@ -0,0 +1,178 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Catalog.hpp"
+#include "CoSimTypes.hpp"
+#include "Helper.hpp"
+#include "TestHelper.hpp"
+
+using namespace DsVeosCoSim;
+using namespace testing;
+
+namespace {
+
+class TestCatalog : public Test {};
+
+TEST_F(TestCatalog, SerializeAndDeserialize) {
+    // Arrange
+    std::vector<IoSignalContainer> sendIncomingSignals = CreateSignals(3);
+    std::vector<IoSignalContainer> sendOutgoingSignals = CreateSignals(2);
+    std::vector<CanControllerContainer> sendCanControllers = CreateCanControllers(2);
+    std::vector<EthControllerContainer> sendEthControllers = CreateEthControllers(3);
+    std::vector<LinControllerContainer> sendLinControllers = CreateLinControllers(1);
+    std::vector<FrControllerContainer> sendFrControllers = CreateFrControllers(2);
+
+    std::vector<uint8_t> catalog;
+    AssertOk(SerializeCatalog(sendIncomingSignals,
+                              sendOutgoingSignals,
+                              sendCanControllers,
+                              sendEthControllers,
+                              sendLinControllers,
+                              sendFrControllers,
+                              catalog));
+
+    // Act
+    std::vector<IoSignalContainer> receiveIncomingSignals;
+    std::vector<IoSignalContainer> receiveOutgoingSignals;
+    std::vector<CanControllerContainer> receiveCanControllers;
+    std::vector<EthControllerContainer> receiveEthControllers;
+    std::vector<LinControllerContainer> receiveLinControllers;
+    std::vector<FrControllerContainer> receiveFrControllers;
+    Result result = DeserializeCatalog(catalog,
+                                       receiveIncomingSignals,
+                                       receiveOutgoingSignals,
+                                       receiveCanControllers,
+                                       receiveEthControllers,
+                                       receiveLinControllers,
+                                       receiveFrControllers);
+
+    // Assert
+    AssertOk(result);
+    EXPECT_THAT(receiveIncomingSignals, ContainerEq(sendIncomingSignals));
+    EXPECT_THAT(receiveOutgoingSignals, ContainerEq(sendOutgoingSignals));
+    EXPECT_THAT(receiveCanControllers, ContainerEq(sendCanControllers));
+    EXPECT_THAT(receiveEthControllers, ContainerEq(sendEthControllers));
+    EXPECT_THAT(receiveLinControllers, ContainerEq(sendLinControllers));
+    EXPECT_THAT(receiveFrControllers, ContainerEq(sendFrControllers));
+}
+
+TEST_F(TestCatalog, SerializeAndDeserializeEmptyCatalog) {
+    // Arrange
+    std::vector<uint8_t> catalog;
+    AssertOk(SerializeCatalog({}, {}, {}, {}, {}, {}, catalog));
+
+    // Act
+    std::vector<IoSignalContainer> incomingSignals = CreateSignals(1);
+    std::vector<IoSignalContainer> outgoingSignals;
+    std::vector<CanControllerContainer> canControllers;
+    std::vector<EthControllerContainer> ethControllers;
+    std::vector<LinControllerContainer> linControllers;
+    std::vector<FrControllerContainer> frControllers;
+    Result result = DeserializeCatalog(catalog, incomingSignals, outgoingSignals, canControllers, ethControllers, linControllers, frControllers);
+
+    // Assert
+    AssertOk(result);
+    EXPECT_TRUE(incomingSignals.empty());
+    EXPECT_TRUE(frControllers.empty());
+}
+
+TEST_F(TestCatalog, NamesAreStoredOnlyOnce) {
+    // Arrange
+    std::vector<IoSignalContainer> signals = CreateSignals(1);
+    std::vector<IoSignalContainer> signalsWithSameName = CreateSignals(2);
+    signalsWithSameName[1].name = signalsWithSameName[0].name = signals[0].name;
+
+    std::vector<uint8_t> catalog;
+    AssertOk(SerializeCatalog(signals, {}, {}, {}, {}, {}, catalog));
+
+    // Act
+    std::vector<uint8_t> catalogWithSameNames;
+    AssertOk(SerializeCatalog(signalsWithSameName, signalsWithSameName, {}, {}, {}, {}, catalogWithSameNames));
+
+    // Assert
+    size_t recordsSize = catalogWithSameNames.size() - catalog.size();
+    EXPECT_LT(recordsSize, signals[0].name.size() * 3);
+}
+
+TEST_F(TestCatalog, HashDependsOnContent) {
+    // Arrange
+    std::vector<IoSignalContainer> signals = CreateSignals(2);
+    std::vector<uint8_t> catalog;
+    AssertOk(SerializeCatalog(signals, {}, {}, {}, {}, {}, catalog));
+    std::vector<uint8_t> sameCatalog;
+    AssertOk(SerializeCatalog(signals, {}, {}, {}, {}, {}, sameCatalog));
+
+    signals[1].name += "Changed";
+    std::vector<uint8_t> changedCatalog;
+    AssertOk(SerializeCatalog(signals, {}, {}, {}, {}, {}, changedCatalog));
+
+    // Act
+    uint64_t hash = GetCatalogHash(catalog);
+
+    // Assert
+    EXPECT_NE(0U, hash);
+    EXPECT_EQ(hash, GetCatalogHash(sameCatalog));
+    EXPECT_NE(hash, GetCatalogHash(changedCatalog));
+}
+
+TEST_F(TestCatalog, DeserializeTruncatedCatalogShouldFail) {
+    // Arrange
+    std::vector<uint8_t> catalog;
+    AssertOk(SerializeCatalog(CreateSignals(2), {}, CreateCanControllers(1), {}, {}, {}, catalog));
+    catalog.pop_back();
+
+    // Act
+    std::vector<IoSignalContainer> incomingSignals;
+    std::vector<IoSignalContainer> outgoingSignals;
+    std::vector<CanControllerContainer> canControllers;
+    std::vector<EthControllerContainer> ethControllers;
+    std::vector<LinControllerContainer> linControllers;
+    std::vector<FrControllerContainer> frControllers;
+    Result result = DeserializeCatalog(catalog, incomingSignals, outgoingSignals, canControllers, ethControllers, linControllers, frControllers);
+
+    // Assert
+    AssertError(result);
+}
+
+TEST_F(TestCatalog, StoreAndLoadCachedCatalog) {
+    // Arrange
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / GenerateString("CatalogCache");
+    std::filesystem::create_directories(directory);
+    std::string key = GenerateString("Server名前");
+
+    std::vector<uint8_t> catalog;
+    AssertOk(SerializeCatalog(CreateSignals(2), CreateSignals(1), {}, {}, {}, {}, catalog));
+    AssertOk(StoreCachedCatalog(directory.string(), key, catalog));
+
+    // Act
+    std::vector<uint8_t> cachedCatalog;
+    Result result = LoadCachedCatalog(directory.string(), key, cachedCatalog);
+
+    // Assert
+    AssertOk(result);
+    EXPECT_EQ(catalog, cachedCatalog);
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(TestCatalog, LoadMissingCachedCatalogShouldFail) {
+    // Arrange
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / GenerateString("CatalogCache");
+    std::filesystem::create_directories(directory);
+
+    // Act
+    std::vector<uint8_t> cachedCatalog;
+    Result result = LoadCachedCatalog(directory.string(), GenerateString("Server名前"), cachedCatalog);
+
+    // Assert
+    AssertError(result);
+    std::filesystem::remove_all(directory);
+}
+
+}  // namespace
@@ -1,16 +1,23 @@
 // Copyright dSPACE SE & Co. KG. All rights reserved.
 
+#include <atomic>
 #include <chrono>
 #include <cstring>
 #include <future>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <poll.h>
+#endif
 
 #include <fmt/format.h>
 
 #include <gtest/gtest.h>
 
+#include "Catalog.hpp"
 #include "Channel.hpp"
 #include "CoSimClient.hpp"
 #include "CoSimServer.hpp"
@@ -28,22 +35,28 @@ class TestCoSimClient : public testing::TestWithParam<ConnectionKind> {
 protected:
     void CustomSetUp(ConnectionKind connectionKind) {
         _serverName = GenerateString("CoSimServer名前");
+        CreateServer(connectionKind);
+
+        AssertOk(CreateProtocol(ProtocolVersion1, _serverProtocol));
+        _client = std::make_unique<CoSimClient>();
+    }
 
+    void CreateServer(ConnectionKind connectionKind) {
         if (connectionKind == ConnectionKind::Remote) {
             AssertOk(CreateTcpChannelServer(0, true, _server));
             _serverPort = _server->GetLocalPort();
+        } else if (connectionKind == ConnectionKind::InProcess) {
+            AssertOk(CreateInProcessChannelServer(_serverName, _server));
         } else {
             AssertOk(CreateLocalChannelServer(_serverName, _server));
         }
-
-        AssertOk(CreateProtocol(ProtocolVersion1, _serverProtocol));
-        _client = std::make_unique<CoSimClient>();
     }
 
     [[nodiscard]] ConnectConfig MakeConfig(ConnectionKind connectionKind) const {
         ConnectConfig config;
         config.serverName = _serverName;
         config.clientName = "TestClient";
+        config.useInProcessChannel = (connectionKind == ConnectionKind::InProcess);
         if (connectionKind == ConnectionKind::Remote) {
             config.remoteIpAddress = "127.0.0.1";
             config.remotePort = _serverPort;
@@ -142,7 +155,8 @@ protected:
                                            canControllers,
                                            ethControllers,
                                            linControllers,
-                                           frControllers));
+                                           frControllers,
+                                           BufferSize));
         return CreateOk();
     }
 
@@ -163,6 +177,88 @@ protected:
         return CreateOk();
     }
 
+    // Acts as a client, which does not know anything about the session except its token
+    [[nodiscard]] static Result ConnectAndReceiveSession(Channel& channel,
+                                                         std::unique_ptr<IProtocol>& protocol,
+                                                         std::string_view serverName,
+                                                         uint64_t& sessionToken) {
+        CheckResult(CreateProtocol(ProtocolVersion1, protocol));
+        CheckResult(protocol->SendConnect(channel.GetWriter(), ProtocolVersionLatest, {}, serverName, "TestClient"));
+
+        FrameKind frameKind{};
+        CheckResult(protocol->ReceiveHeader(channel.GetReader(), frameKind));
+        if (frameKind != FrameKind::ConnectOk) {
+            return CreateError();
+        }
+
+        uint32_t version{};
+        CheckResult(protocol->ReadConnectOkVersion(channel.GetReader(), version));
+        CheckResult(CreateProtocol(version, protocol));
+
+        Mode mode{};
+        SimulationTime stepSize{};
+        SimulationState simulationState{};
+        std::vector<IoSignalContainer> incomingSignals;
+        std::vector<IoSignalContainer> outgoingSignals;
+        std::vector<CanControllerContainer> canControllers;
+        std::vector<EthControllerContainer> ethControllers;
+        std::vector<LinControllerContainer> linControllers;
+        std::vector<FrControllerContainer> frControllers;
+        uint32_t maxFrameSize{};
+        CheckResult(protocol->ReadConnectOk(channel.GetReader(),
+                                            mode,
+                                            stepSize,
+                                            simulationState,
+                                            incomingSignals,
+                                            outgoingSignals,
+                                            canControllers,
+                                            ethControllers,
+                                            linControllers,
+                                            frControllers,
+                                            maxFrameSize));
+
+        CheckResult(protocol->ReceiveHeader(channel.GetReader(), frameKind));
+        if (frameKind != FrameKind::Session) {
+            return CreateError();
+        }
+
+        uint32_t resumeTimeout{};
+        return protocol->ReadSession(channel.GetReader(), sessionToken, resumeTimeout);
+    }
+
+    [[nodiscard]] static Result RequestCatalog(Channel& channel,
+                                               IProtocol& protocol,
+                                               uint64_t cachedCatalogHash,
+                                               uint64_t& catalogHash,
+                                               std::vector<uint8_t>& catalog) {
+        CheckResult(protocol.SendGetCatalog(channel.GetWriter(), cachedCatalogHash));
+
+        FrameKind frameKind{};
+        CheckResult(protocol.ReceiveHeader(channel.GetReader(), frameKind));
+        if (frameKind != FrameKind::Catalog) {
+            return CreateError();
+        }
+
+        return protocol.ReadCatalog(channel.GetReader(), catalogHash, catalog);
+    }
+
+    [[nodiscard]] static Result ReceiveCommandAndSendOk(Channel& channel, IProtocol& protocol, FrameKind expectedFrameKind) {
+        FrameKind frameKind{};
+        CheckResult(protocol.ReceiveHeader(channel.GetReader(), frameKind));
+        if (frameKind != expectedFrameKind) {
+            return CreateError();
+        }
+
+        SimulationTime simulationTime{};
+        if (frameKind == FrameKind::Start) {
+            CheckResult(protocol.ReadStart(channel.GetReader(), simulationTime));
+        } else {
+            CheckResult(protocol.ReadStop(channel.GetReader(), simulationTime));
+        }
+
+        return protocol.SendOk(channel.GetWriter());
+    }
+
     std::unique_ptr<ChannelServer> _server;
     std::unique_ptr<Channel> _serverChannel;
     std::unique_ptr<IProtocol> _serverProtocol;
@@ -193,7 +289,7 @@ protected:
 
 INSTANTIATE_TEST_SUITE_P(,
                          TestCoSimClient,
-                         testing::Values(ConnectionKind::Local, ConnectionKind::Remote),
+                         testing::Values(ConnectionKind::Local, ConnectionKind::Remote, ConnectionKind::InProcess),
                          [](const testing::TestParamInfo<ConnectionKind>& info) {
                              return fmt::format("{}", info.param);
                          });
@@ -353,6 +449,70 @@ TEST_F(TestCoSimClient, GetConnectionStateAfterFailedConnectShouldBeDisconnected
     ASSERT_EQ(ConnectionState::Disconnected, state);
 }
 
+#ifndef _WIN32
+
+TEST_P(TestCoSimClient, ConnectMakesServerWaitHandleReadable) {
+    // Arrange
+    ConnectionKind connectionKind = GetParam();
+    _serverName = GenerateString("CoSimServer名前");
+    CoSimServerConfig config{};
+    config.serverName = _serverName;
+    config.enableRemoteAccess = (connectionKind == ConnectionKind::Remote);
+    config.isClientOptional = true;
+    config.registerAtPortMapper = false;
+
+    _coSimServer = std::make_unique<CoSimServer>();
+    AssertOk(_coSimServer->Load(config));
+    uint16_t port{};
+    AssertOk(_coSimServer->GetLocalPort(port));
+    _serverPort = port;
+
+    int32_t fileDescriptor{};
+    AssertOk(_coSimServer->GetWaitHandle(fileDescriptor));
+
+    pollfd pfd{};
+    pfd.fd = fileDescriptor;
+    pfd.events = POLLIN;
+    ASSERT_EQ(0, poll(&pfd, 1, 0));
+
+    _client = std::make_unique<CoSimClient>();
+    auto clientTask = std::async(std::launch::async, [this, connectionKind] {
+        return _client->Connect(MakeConfig(connectionKind));
+    });
+
+    // Act
+    int32_t pollResult = poll(&pfd, 1, static_cast<int32_t>(DefaultTimeoutInMilliseconds));
+
+    // Assert
+    ASSERT_EQ(1, pollResult);
+
+    SimulationTime roundTripTime{};
+    AssertOk(_coSimServer->BackgroundService(roundTripTime));
+    AssertOk(clientTask.get());
+    ASSERT_EQ(ConnectionState::Connected, _client->GetConnectionState());
+}
+
+TEST_P(TestCoSimClient, DisconnectMakesServerWaitHandleReadable) {
+    // Arrange
+    ConnectAndStartPolling(GetParam());
+
+    int32_t fileDescriptor{};
+    AssertOk(_coSimServer->GetWaitHandle(fileDescriptor));
+
+    pollfd pfd{};
+    pfd.fd = fileDescriptor;
+    pfd.events = POLLIN;
+    ASSERT_EQ(0, poll(&pfd, 1, 0));
+
+    // Act
+    _client->Disconnect();
+
+    // Assert
+    ASSERT_EQ(1, poll(&pfd, 1, static_cast<int32_t>(DefaultTimeoutInMilliseconds)));
+}
+
+#endif
+
 // --- Reconnect ---
 
 TEST_P(TestCoSimClient, ReconnectAfterDisconnect) {
@@ -369,12 +529,7 @@ TEST_P(TestCoSimClient, ReconnectAfterDisconnect) {
 
     // Second connection needs a fresh server
     _serverName = GenerateString("CoSimServer名前");
-    if (GetParam() == ConnectionKind::Local) {
-        AssertOk(CreateLocalChannelServer(_serverName, _server));
-    } else {
-        AssertOk(CreateTcpChannelServer(0, true, _server));
-        _serverPort = _server->GetLocalPort();
-    }
+    CreateServer(GetParam());
 
     auto serverTask2 = RunServer([](Channel& channel, IProtocol& protocol) {
         return AcceptAndSendConnectOk(channel, protocol);
@@ -596,12 +751,7 @@ TEST_P(TestCoSimClient, StartPollingBasedCoSimulationAfterCallbackModeShouldSucc
 
     // Reconnect
     _serverName = GenerateString("CoSimServer名前");
-    if (GetParam() == ConnectionKind::Local) {
-        AssertOk(CreateLocalChannelServer(_serverName, _server));
-    } else {
-        AssertOk(CreateTcpChannelServer(0, true, _server));
-        _serverPort = _server->GetLocalPort();
-    }
+    CreateServer(GetParam());
 
     auto connectServerTask = std::async(std::launch::async, [this]() {
         CheckResult(WaitForAccept(_serverChannel));
@@ -1401,6 +1551,341 @@ TEST_F(TestCoSimClient, WriteSignal) {
     ASSERT_EQ(0, std::memcmp(ioData.data(), value, ioData.size()));
 }
 
+TEST_F(TestCoSimClient, WriteSignalWithPipelinedSteppingIsAppliedOneStepLater) {
+    // Arrange
+    auto outSignal = CreateSignal(DataType::Float64, SizeKind::Fixed);
+    CoSimServerConfig config{};
+    config.outgoingSignals = {outSignal};
+    config.enablePipelinedStepping = true;
+    ConnectAndStartPolling(ConnectionKind::Remote, config);
+
+    auto ioData = GenerateIoData(outSignal);
+    AssertOk(_client->Write(outSignal.id, outSignal.length, ioData.data()));
+
+    // The first step does not wait for the client
+    SimulationTime nextTime{};
+    AssertOk(_coSimServer->Step(SimulationTime{}, nextTime));
+
+    SimulationTime simulationTime{};
+    Command command{};
+    AssertOk(_client->PollCommand(simulationTime, command, Infinite));
+    ASSERT_EQ(Command::Step, command);
+    AssertOk(_client->FinishCommand());
+
+    // Act
+    AssertOk(_coSimServer->Step(SimulationTime{}, nextTime));
+
+    // Assert
+    uint32_t length = outSignal.length;
+    const void* value{};
+    bool valueRead{};
+    AssertOk(_coSimServer->Read(outSignal.id, length, &value, valueRead));
+    ASSERT_TRUE(valueRead);
+    ASSERT_EQ(0, std::memcmp(ioData.data(), value, ioData.size()));
+
+    AssertOk(_client->PollCommand(simulationTime, command, Infinite));
+    ASSERT_EQ(Command::Step, command);
+    AssertOk(_client->FinishCommand());
+}
+
+TEST_F(TestCoSimClient, StopWithPipelinedSteppingFinishesPendingStep) {
+    // Arrange
+    CoSimServerConfig config{};
+    config.enablePipelinedStepping = true;
+    ConnectAndStartPolling(ConnectionKind::Remote, config);
+
+    SimulationTime nextTime{};
+    AssertOk(_coSimServer->Step(SimulationTime{}, nextTime));
+
+    auto serverTask = std::async(std::launch::async, [this] {
+        return _coSimServer->Stop(SimulationTime{});
+    });
+
+    SimulationTime simulationTime{};
+    Command command{};
+    AssertOk(_client->PollCommand(simulationTime, command, Infinite));
+    ASSERT_EQ(Command::Step, command);
+    AssertOk(_client->FinishCommand());
+
+    // Act
+    AssertOk(_client->PollCommand(simulationTime, command, Infinite));
+    AssertOk(_client->FinishCommand());
+
+    // Assert
+    ASSERT_EQ(Command::Stop, command);
+    AssertOk(serverTask.get());
+}
+
+TEST_F(TestCoSimClient, StepWithTwoClientsWaitsForBothClients) {
+    // Arrange
+    auto outSignal = CreateSignal(DataType::Float64, SizeKind::Fixed);
+    _serverName = GenerateString("CoSimServer名前");
+    CoSimServerConfig config{};
+    config.serverName = _serverName;
+    config.enableRemoteAccess = true;
+    config.registerAtPortMapper = false;
+    config.maxClientCount = 2;
+    config.outgoingSignals = {outSignal};
+
+    _coSimServer = std::make_unique<CoSimServer>();
+    AssertOk(_coSimServer->Load(config));
+    uint16_t port{};
+    AssertOk(_coSimServer->GetLocalPort(port));
+    _serverPort = port;
+
+    auto serverStartTask = std::async(std::launch::async, [this] {
+        return _coSimServer->Start(SimulationTime{});
+    });
+
+    std::vector<std::unique_ptr<CoSimClient>> clients;
+    SimulationTime simulationTime{};
+    Command command{};
+    for (int32_t i = 0; i < 2; i++) {
+        auto& client = clients.emplace_back(std::make_unique<CoSimClient>());
+        AssertOk(client->Connect(MakeConfig(ConnectionKind::Remote)));
+        AssertOk(client->StartPollingBasedCoSimulation({}));
+    }
+
+    for (const auto& client : clients) {
+        AssertOk(client->PollCommand(simulationTime, command, Infinite));
+        ASSERT_EQ(Command::Start, command);
+        AssertOk(client->FinishCommand());
+    }
+
+    AssertOk(serverStartTask.get());
+
+    auto ioData = GenerateIoData(outSignal);
+    AssertOk(clients[1]->Write(outSignal.id, outSignal.length, ioData.data()));
+
+    // Act
+    auto serverStepTask = std::async(std::launch::async, [this] {
+        SimulationTime nextTime{};
+        return _coSimServer->Step(SimulationTime{}, nextTime);
+    });
+
+    for (const auto& client : clients) {
+        AssertOk(client->PollCommand(simulationTime, command, Infinite));
+        ASSERT_EQ(Command::Step, command);
+        AssertOk(client->FinishCommand());
+    }
+
+    // Assert
+    AssertOk(serverStepTask.get());
+
+    uint32_t length = outSignal.length;
+    const void* value{};
+    bool valueRead{};
+    AssertOk(_coSimServer->Read(outSignal.id, length, &value, valueRead));
+    ASSERT_TRUE(valueRead);
+    ASSERT_EQ(0, std::memcmp(ioData.data(), value, ioData.size()));
+}
+
+// --- Session resumption ---
+
+TEST_F(TestCoSimClient, PollCommandResumesSessionAfterConnectionLoss) {
+    // Arrange
+    CustomSetUp(ConnectionKind::Remote);
+    AssertOk(CreateProtocol(ProtocolVersion5, _serverProtocol));
+
+    uint64_t sessionToken = GenerateU64() | 1U;
+    SimulationTime expectedTime(std::chrono::nanoseconds(1000));
+
+    auto serverTask = std::async(std::launch::async, [this, sessionToken, expectedTime]() -> Result {
+        CheckResult(WaitForAccept(_serverChannel));
+        CheckResult(AcceptAndSendConnectOk(*_serverChannel, *_serverProtocol, ProtocolVersion5, SimulationTime{}, SimulationState::Stopped));
+        CheckResult(_serverProtocol->SendSession(_serverChannel->GetWriter(), sessionToken, DefaultTimeoutInMilliseconds));
+        _serverChannel->Disconnect();
+
+        std::unique_ptr<Channel> channel;
+        CheckResult(WaitForAccept(channel));
+
+        FrameKind frameKind{};
+        CheckResult(_serverProtocol->ReceiveHeader(channel->GetReader(), frameKind));
+        uint64_t receivedSessionToken{};
+        if (frameKind != FrameKind::Resume) {
+            return CreateError();
+        }
+
+        CheckResult(_serverProtocol->ReadResume(channel->GetReader(), receivedSessionToken));
+        if (receivedSessionToken != sessionToken) {
+            return CreateError();
+        }
+
+        CheckResult(_serverProtocol->SendOk(channel->GetWriter()));
+        CheckResult(_serverProtocol->SendStart(channel->GetWriter(), expectedTime));
+        _serverChannel = std::move(channel);
+        return CreateOk();
+    });
+
+    AssertOk(_client->Connect(MakeConfig(ConnectionKind::Remote)));
+    AssertOk(_client->StartPollingBasedCoSimulation({}));
+
+    // Act
+    SimulationTime simulationTime{};
+    Command command{};
+    Result result = _client->PollCommand(simulationTime, command, Infinite);
+
+    // Assert
+    AssertOk(result);
+    ASSERT_EQ(Command::Start, command);
+    ASSERT_EQ(expectedTime, simulationTime);
+    ASSERT_EQ(ConnectionState::Connected, _client->GetConnectionState());
+    AssertOk(serverTask.get());
+}
+
+TEST_F(TestCoSimClient, ServerResumesSessionOfReconnectedClient) {
+    // Arrange
+    _serverName = GenerateString("CoSimServer名前");
+    bool stoppedCallbackCalled{};
+    CoSimServerConfig config{};
+    config.serverName = _serverName;
+    config.enableRemoteAccess = true;
+    config.registerAtPortMapper = false;
+    config.sessionResumeTimeoutInMilliseconds = DefaultTimeoutInMilliseconds;
+    config.simulationStoppedCallback = [&stoppedCallbackCalled](SimulationTime) {
+        stoppedCallbackCalled = true;
+    };
+
+    _coSimServer = std::make_unique<CoSimServer>();
+    AssertOk(_coSimServer->Load(config));
+    uint16_t port{};
+    AssertOk(_coSimServer->GetLocalPort(port));
+
+    auto serverStartTask = std::async(std::launch::async, [this] {
+        return _coSimServer->Start(SimulationTime{});
+    });
+
+    std::unique_ptr<Channel> channel;
+    std::unique_ptr<IProtocol> protocol;
+    uint64_t sessionToken{};
+    AssertOk(TryConnectToTcpChannel("127.0.0.1", port, 0, DefaultTimeoutInMilliseconds, channel));
+    uint64_t catalogHash{};
+    std::vector<uint8_t> catalog;
+    AssertOk(ConnectAndReceiveSession(*channel, protocol, _serverName, sessionToken));
+    AssertOk(RequestCatalog(*channel, *protocol, 0, catalogHash, catalog));
+    AssertOk(ReceiveCommandAndSendOk(*channel, *protocol, FrameKind::Start));
+    AssertOk(serverStartTask.get());
+    ASSERT_NE(0U, sessionToken);
+
+    channel->Disconnect();
+    SimulationTime nextTime{};
+    AssertOk(_coSimServer->Step(SimulationTime{}, nextTime));
+    AssertOk(_coSimServer->GetLocalPort(port));
+
+    // Act
+    auto serverStopTask = std::async(std::launch::async, [this] {
+        return _coSimServer->Stop(SimulationTime{});
+    });
+
+    AssertOk(TryConnectToTcpChannel("127.0.0.1", port, 0, DefaultTimeoutInMilliseconds, channel));
+    AssertOk(protocol->SendResume(channel->GetWriter(), sessionToken));
+
+    // Assert
+    FrameKind frameKind{};
+    AssertOk(protocol->ReceiveHeader(channel->GetReader(), frameKind));
+    ASSERT_EQ(FrameKind::Ok, frameKind);
+    AssertOk(protocol->ReadOk(channel->GetReader()));
+
+    AssertOk(ReceiveCommandAndSendOk(*channel, *protocol, FrameKind::Stop));
+    AssertOk(serverStopTask.get());
+    ASSERT_FALSE(stoppedCallbackCalled);
+}
+
+TEST_F(TestCoSimClient, ServerRejectsUnknownSession) {
+    // Arrange
+    _serverName = GenerateString("CoSimServer名前");
+    CoSimServerConfig config{};
+    config.serverName = _serverName;
+    config.enableRemoteAccess = true;
+    config.isClientOptional = true;
+    config.registerAtPortMapper = false;
+    config.sessionResumeTimeoutInMilliseconds = DefaultTimeoutInMilliseconds;
+
+    _coSimServer = std::make_unique<CoSimServer>();
+    AssertOk(_coSimServer->Load(config));
+    uint16_t port{};
+    AssertOk(_coSimServer->GetLocalPort(port));
+
+    std::unique_ptr<Channel> channel;
+    std::unique_ptr<IProtocol> protocol;
+    AssertOk(CreateProtocol(ProtocolVersionLatest, protocol));
+    AssertOk(TryConnectToTcpChannel("127.0.0.1", port, 0, DefaultTimeoutInMilliseconds, channel));
+
+    std::atomic<bool> stopServer{};
+    auto serverTask = std::async(std::launch::async, [this, &stopServer] {
+        SimulationTime roundTripTime{};
+        while (!stopServer) {
+            CheckResult(_coSimServer->BackgroundService(roundTripTime));
+            std::this_thread::yield();
+        }
+
+        return CreateOk();
+    });
+
+    // Act
+    AssertOk(protocol->SendResume(channel->GetWriter(), GenerateU64() | 1U));
+    FrameKind frameKind{};
+    Result result = protocol->ReceiveHeader(channel->GetReader(), frameKind);
+    stopServer = true;
+
+    // Assert
+    AssertOk(serverTask.get());
+    AssertOk(result);
+    ASSERT_EQ(FrameKind::Error, frameKind);
+}
+
+// --- Catalog ---
+
+TEST_F(TestCoSimClient, ServerSkipsCatalogCachedByClient) {
+    // Arrange
+    _serverName = GenerateString("CoSimServer名前");
+    CoSimServerConfig config{};
+    config.serverName = _serverName;
+    config.enableRemoteAccess = true;
+    config.registerAtPortMapper = false;
+    config.maxClientCount = 2;
+    config.incomingSignals = CreateSignals(3);
+    config.canControllers = CreateCanControllers(2);
+
+    _coSimServer = std::make_unique<CoSimServer>();
+    AssertOk(_coSimServer->Load(config));
+    uint16_t port{};
+    AssertOk(_coSimServer->GetLocalPort(port));
+
+    auto serverStartTask = std::async(std::launch::async, [this] {
+        return _coSimServer->Start(SimulationTime{});
+    });
+
+    std::unique_ptr<Channel> firstChannel;
+    std::unique_ptr<IProtocol> firstProtocol;
+    uint64_t sessionToken{};
+    uint64_t firstCatalogHash{};
+    std::vector<uint8_t> firstCatalog;
+    AssertOk(TryConnectToTcpChannel("127.0.0.1", port, 0, DefaultTimeoutInMilliseconds, firstChannel));
+    AssertOk(ConnectAndReceiveSession(*firstChannel, firstProtocol, _serverName, sessionToken));
+    AssertOk(RequestCatalog(*firstChannel, *firstProtocol, 0, firstCatalogHash, firstCatalog));
+
+    std::unique_ptr<Channel> secondChannel;
+    std::unique_ptr<IProtocol> secondProtocol;
+    AssertOk(TryConnectToTcpChannel("127.0.0.1", port, 0, DefaultTimeoutInMilliseconds, secondChannel));
+    AssertOk(ConnectAndReceiveSession(*secondChannel, secondProtocol, _serverName, sessionToken));
+
+    // Act
+    uint64_t secondCatalogHash{};
+    std::vector<uint8_t> secondCatalog;
+    AssertOk(RequestCatalog(*secondChannel, *secondProtocol, firstCatalogHash, secondCatalogHash, secondCatalog));
+
+    // Assert
+    ASSERT_FALSE(firstCatalog.empty());
+    ASSERT_EQ(GetCatalogHash(firstCatalog), firstCatalogHash);
+    ASSERT_EQ(firstCatalogHash, secondCatalogHash);
+    ASSERT_TRUE(secondCatalog.empty());
+
+    AssertOk(ReceiveCommandAndSendOk(*firstChannel, *firstProtocol, FrameKind::Start));
+    AssertOk(ReceiveCommandAndSendOk(*secondChannel, *secondProtocol, FrameKind::Start));
+    AssertOk(serverStartTask.get());
+}
+
 // --- Read ---
 
 TEST_F(TestCoSimClient, ReadWhenNotConnectedShouldFail) {
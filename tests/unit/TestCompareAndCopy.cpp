@@ -0,0 +1,117 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Helper.hpp"
+#include "SignalExchangeCommon.hpp"
+
+using namespace DsVeosCoSim::SignalExchangeDetail;
+using namespace testing;
+
+namespace {
+
+struct CompareAndCopyParam {
+    std::string name;
+    CompareAndCopyFunction function{};
+    bool (*isSupported)(){};
+};
+
+[[nodiscard]] bool IsAlwaysSupported() {
+    return true;
+}
+
+[[nodiscard]] std::vector<CompareAndCopyParam> GetCompareAndCopyParameters() {
+    std::vector<CompareAndCopyParam> values;
+    values.push_back(CompareAndCopyParam{"Scalar", CompareAndCopyScalar, IsAlwaysSupported});
+    values.push_back(CompareAndCopyParam{"Dispatched", CompareAndCopy, IsAlwaysSupported});
+#ifdef DSVEOSCOSIM_COMPARE_AND_COPY_X86
+    values.push_back(CompareAndCopyParam{"Sse2", CompareAndCopySse2, IsSse2Supported});
+    values.push_back(CompareAndCopyParam{"Avx2", CompareAndCopyAvx2, IsAvx2Supported});
+#endif
+    return values;
+}
+
+// Covers values shorter than a line, exactly one line and full lines with and without a remainder
+auto Sizes = Values(size_t{1}, size_t{63}, size_t{64}, size_t{65}, size_t{192}, size_t{1000});
+
+class TestCompareAndCopy : public TestWithParam<std::tuple<CompareAndCopyParam, size_t>> {
+protected:
+    void SetUp() override {
+        if (!std::get<0>(GetParam()).isSupported()) {
+            GTEST_SKIP() << "Not supported by this processor.";
+        }
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(,
+                         TestCompareAndCopy,
+                         Combine(ValuesIn(GetCompareAndCopyParameters()), Sizes),
+                         [](const TestParamInfo<std::tuple<CompareAndCopyParam, size_t>>& info) {
+                             return std::get<0>(info.param).name + "_" + std::to_string(std::get<1>(info.param));
+                         });
+
+TEST_P(TestCompareAndCopy, EqualValueIsNotCopied) {
+    // Arrange
+    auto [param, size] = GetParam();
+    std::vector<uint8_t> source = GenerateBytes(size);
+    std::vector<uint8_t> target = source;
+    std::vector<uint64_t> changedLineBits(1 + (size / CacheLineSize / 64));
+
+    // Act
+    bool changed = param.function(target.data(), source.data(), size, changedLineBits.data());
+
+    // Assert
+    ASSERT_FALSE(changed);
+    for (uint64_t bits : changedLineBits) {
+        ASSERT_EQ(0U, bits);
+    }
+}
+
+TEST_P(TestCompareAndCopy, OnlyChangedLineIsMarked) {
+    auto [param, size] = GetParam();
+    size_t lineCount = (size + CacheLineSize - 1) / CacheLineSize;
+
+    for (size_t line = 0; line < lineCount; line++) {
+        // Arrange
+        std::vector<uint8_t> source = GenerateBytes(size);
+        std::vector<uint8_t> target = source;
+        size_t changedIndex = std::min(size - 1, (line * CacheLineSize) + GenerateRandom(size_t{0}, CacheLineSize - 1));
+        source[changedIndex] = static_cast<uint8_t>(source[changedIndex] + 1);
+        std::vector<uint64_t> changedLineBits(1 + (size / CacheLineSize / 64));
+
+        // Act
+        bool changed = param.function(target.data(), source.data(), size, changedLineBits.data());
+
+        // Assert
+        ASSERT_TRUE(changed);
+        ASSERT_EQ(source, target);
+        for (size_t index = 0; index < changedLineBits.size(); index++) {
+            uint64_t expectedBits = index == line / 64 ? uint64_t{1} << (line % 64) : 0;
+            ASSERT_EQ(expectedBits, changedLineBits[index]);
+        }
+    }
+}
+
+TEST_P(TestCompareAndCopy, CopyToUnalignedTarget) {
+    // Arrange
+    auto [param, size] = GetParam();
+    std::vector<uint8_t> source = GenerateBytes(size + 1);
+    std::vector<uint8_t> target = GenerateBytes(size + 3);
+    std::vector<uint8_t> expectedTarget = target;
+    std::copy(source.begin() + 1, source.end(), expectedTarget.begin() + 3);
+
+    // Act
+    (void)param.function(target.data() + 3, source.data() + 1, size, nullptr);
+
+    // Assert
+    ASSERT_EQ(expectedTarget, target);
+}
+
+}  // namespace
@@ -43,6 +43,7 @@ TEST(TestDsVeosCoSimLifecycle, DestroyWithNullHandleShouldNotCrash) {
 TEST(TestDsVeosCoSimLifecycle, AllHandleFunctionsRejectNullHandle) {
     DsVeosCoSim_ConnectConfig config{};
     DsVeosCoSim_Callbacks callbacks{};
+    DsVeosCoSim_BatchCallbacks batchCallbacks{};
     DsVeosCoSim_ConnectionState connectionState{};
     DsVeosCoSim_SimulationTime simulationTime{};
     DsVeosCoSim_SimulationState simulationState{};
@@ -64,6 +65,7 @@ TEST(TestDsVeosCoSimLifecycle, AllHandleFunctionsRejectNullHandle) {
     DsVeosCoSim_FrMessageContainer frMsgContainer{};
     uint8_t value{};
     uint32_t length{};
+    DsVeosCoSim_IoSignalHandle signalHandle{};
 
     // Connection
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_Connect(nullptr, config));
@@ -73,6 +75,8 @@ TEST(TestDsVeosCoSimLifecycle, AllHandleFunctionsRejectNullHandle) {
     // Co-simulation control
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_RunCallbackBasedCoSimulation(nullptr, callbacks));
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_StartPollingBasedCoSimulation(nullptr, callbacks));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_RunCallbackBasedCoSimulation2(nullptr, callbacks, batchCallbacks));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_StartPollingBasedCoSimulation2(nullptr, callbacks, batchCallbacks));
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_PollCommand(nullptr, &simulationTime, &command));
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_PollCommand2(nullptr, &simulationTime, &command, 0));
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_FinishCommand(nullptr));
@@ -96,6 +100,12 @@ TEST(TestDsVeosCoSimLifecycle, AllHandleFunctionsRejectNullHandle) {
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ReadIncomingSignal(nullptr, {}, &length, &value));
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_GetOutgoingSignals(nullptr, &count, &signals));
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_WriteOutgoingSignal(nullptr, {}, 0, nullptr));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ResolveIncomingSignal(nullptr, {}, &signalHandle));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ReadIncomingSignalByHandle(nullptr, {}, &length, &value));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ResolveOutgoingSignal(nullptr, {}, &signalHandle));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_WriteOutgoingSignalByHandle(nullptr, {}, 0, nullptr));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ReadIncomingSignals(nullptr, 0, nullptr));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_WriteOutgoingSignals(nullptr, 0, nullptr));
 
     // CAN
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_GetCanControllers(nullptr, &count, &canControllers));
@@ -188,6 +198,19 @@ TEST_F(TestDsVeosCoSim, ReadIncomingSignalNullOutputPointers) {
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ReadIncomingSignal(_handle, {}, &length, nullptr));
 }
 
+TEST_F(TestDsVeosCoSim, ResolveSignalNullOutputPointers) {
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ResolveIncomingSignal(_handle, {}, nullptr));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ResolveOutgoingSignal(_handle, {}, nullptr));
+}
+
+TEST_F(TestDsVeosCoSim, ReadIncomingSignalByHandleNullOutputPointers) {
+    uint32_t length{};
+    uint8_t value{};
+
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ReadIncomingSignalByHandle(_handle, {}, nullptr, &value));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ReadIncomingSignalByHandle(_handle, {}, &length, nullptr));
+}
+
 TEST_F(TestDsVeosCoSim, GetCanControllersNullOutputPointers) {
     uint32_t count{};
     const DsVeosCoSim_CanController* controllers{};
@@ -271,6 +294,15 @@ TEST_F(TestDsVeosCoSim, WriteOutgoingSignalNullValueWithNonZeroLengthShouldRetur
     EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_WriteOutgoingSignal(_handle, {}, 1, nullptr));
 }
 
+TEST_F(TestDsVeosCoSim, WriteOutgoingSignalByHandleNullValueWithNonZeroLengthShouldReturnInvalidArgument) {
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_WriteOutgoingSignalByHandle(_handle, {}, 1, nullptr));
+}
+
+TEST_F(TestDsVeosCoSim, SignalValuesNullArrayWithNonZeroCountShouldReturnInvalidArgument) {
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_ReadIncomingSignals(_handle, 1, nullptr));
+    EXPECT_EQ(DsVeosCoSim_Result_InvalidArgument, DsVeosCoSim_WriteOutgoingSignals(_handle, 1, nullptr));
+}
+
 // --- SetLogCallback ---
 
 namespace {
@@ -1,12 +1,18 @@
 // Copyright dSPACE SE & Co. KG. All rights reserved.
 
+#include <chrono>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "Environment.hpp"
 #include "Helper.hpp"
 #include "PortMapper.hpp"
+#include "Socket.hpp"
 #include "TestHelper.hpp"
 
 using namespace DsVeosCoSim;
@@ -100,4 +106,125 @@ TEST_F(TestPortMapper, GetPortOfNonExistingServer) {
     AssertError(result);
 }
 
+TEST_F(TestPortMapper, SetPortsAndGetPorts) {
+    // Arrange
+    std::vector<PortMapperEntry> entries{{GenerateString("Server名前"), GenerateU16()}, {GenerateString("Server名前"), GenerateU16()}};
+    std::string nonExistingServerName = GenerateString("OtherServer名前");
+
+    // Act
+    AssertOk(PortMapperSetPorts(entries));
+
+    // Assert
+    std::vector<uint16_t> ports;
+    AssertOk(PortMapperGetPorts("127.0.0.1", {entries[0].serverName, nonExistingServerName, entries[1].serverName}, ports));
+    ASSERT_EQ(3U, ports.size());
+    EXPECT_EQ(entries[0].port, ports[0]);
+    EXPECT_EQ(0, ports[1]);
+    EXPECT_EQ(entries[1].port, ports[2]);
+}
+
+TEST_F(TestPortMapper, SeveralRequestsOverOneConnection) {
+    // Arrange
+    std::unique_ptr<PortMapperClient> client;
+    AssertOk(CreatePortMapperClient("127.0.0.1", client));
+    std::string serverName = GenerateString("Server名前");
+    uint16_t port = GenerateU16();
+
+    // Act and assert
+    AssertOk(client->SetPort(serverName, port));
+
+    uint16_t retrievedPort{};
+    AssertOk(client->GetPort(serverName, retrievedPort));
+    EXPECT_EQ(port, retrievedPort);
+
+    AssertOk(client->UnsetPort(serverName));
+    AssertError(client->GetPort(serverName, retrievedPort));
+
+    // The error reply keeps the connection usable
+    AssertOk(client->SetPort(serverName, port));
+    AssertOk(client->GetPort(serverName, retrievedPort));
+    EXPECT_EQ(port, retrievedPort);
+}
+
+TEST_F(TestPortMapper, ServeSeveralConnectedClients) {
+    // Arrange
+    constexpr size_t clientCount = 8;
+    std::vector<std::unique_ptr<PortMapperClient>> clients(clientCount);
+    for (auto& client : clients) {
+        AssertOk(CreatePortMapperClient("127.0.0.1", client));
+    }
+
+    std::vector<std::string> serverNames;
+    for (size_t i = 0; i < clientCount; i++) {
+        serverNames.push_back(GenerateString("Server名前"));
+    }
+
+    // Act
+    std::vector<std::future<Result>> futures;
+    for (size_t i = 0; i < clientCount; i++) {
+        futures.push_back(std::async(std::launch::async, [&, i] {
+            return clients[i]->SetPort(serverNames[i], static_cast<uint16_t>(i + 1));
+        }));
+    }
+
+    // Assert
+    for (auto& future : futures) {
+        AssertOk(future.get());
+    }
+
+    std::vector<uint16_t> ports;
+    AssertOk(clients[0]->GetPorts(serverNames, ports));
+    for (size_t i = 0; i < clientCount; i++) {
+        EXPECT_EQ(i + 1, ports[i]);
+    }
+}
+
+TEST_F(TestPortMapper, ServeClientNextToStalledClient) {
+    // Arrange
+    // Declared before the stalled client, so that its disconnect would release a blocked port mapper before waiting for it
+    std::future<Result> future;
+
+    // Sends only part of a request and then stalls. It connects first, so the port mapper looks at it first
+    SocketClient stalledClient;
+    AssertOk(SocketClient::TryConnect("127.0.0.1", GetPortMapperPort(), 0, DefaultTimeoutInMilliseconds, stalledClient));
+    int32_t frameSize = 100;
+    AssertOk(stalledClient.Send(&frameSize, sizeof(frameSize)));
+    AssertOk(stalledClient.Send(&frameSize, sizeof(frameSize)));
+
+    std::unique_ptr<PortMapperClient> client;
+    AssertOk(CreatePortMapperClient("127.0.0.1", client));
+    std::string serverName = GenerateString("Server名前");
+    uint16_t port = GenerateU16();
+
+    // Act
+    future = std::async(std::launch::async, [&] {
+        return client->SetPort(serverName, port);
+    });
+
+    // Assert
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+    AssertOk(future.get());
+    uint16_t retrievedPort{};
+    AssertOk(client->GetPort(serverName, retrievedPort));
+    EXPECT_EQ(port, retrievedPort);
+}
+
+TEST_F(TestPortMapper, GetPortAfterRestartOfPortMapper) {
+    // Arrange
+    std::string serverName = GenerateString("Server名前");
+    uint16_t port = GenerateU16();
+    AssertOk(PortMapperSetPort(serverName, port));
+    _portMapperServer.reset();
+    AssertOk(CreatePortMapperServer(true, _portMapperServer));
+
+    // Act
+    Result result = PortMapperSetPort(serverName, port);
+
+    // Assert
+    AssertOk(result);
+    uint16_t retrievedPort{};
+    AssertOk(PortMapperGetPort("127.0.0.1", serverName, retrievedPort));
+    EXPECT_EQ(port, retrievedPort);
+}
+
 }  // namespace
@@ -0,0 +1,147 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "Helper.hpp"
+#include "PortRegistry.hpp"
+#include "TestHelper.hpp"
+
+using namespace DsVeosCoSim;
+using namespace testing;
+
+namespace {
+
+class TestPortRegistry : public Test {};
+
+TEST_F(TestPortRegistry, SetPort) {
+    // Arrange
+    std::string serverName = GenerateString("Server名前");
+    uint16_t port = GenerateU16();
+
+    // Act
+    Result result = PortRegistrySetPort(serverName, port);
+
+    // Assert
+    AssertOk(result);
+    uint16_t retrievedPort{};
+    AssertOk(PortRegistryGetPort(serverName, retrievedPort));
+    EXPECT_EQ(port, retrievedPort);
+    AssertOk(PortRegistryUnsetPort(serverName));
+}
+
+TEST_F(TestPortRegistry, SetPortOfExistingServer) {
+    // Arrange
+    std::string serverName = GenerateString("Server名前");
+    uint16_t port = GenerateU16();
+    AssertOk(PortRegistrySetPort(serverName, GenerateU16()));
+
+    // Act
+    Result result = PortRegistrySetPort(serverName, port);
+
+    // Assert
+    AssertOk(result);
+    uint16_t retrievedPort{};
+    AssertOk(PortRegistryGetPort(serverName, retrievedPort));
+    EXPECT_EQ(port, retrievedPort);
+    AssertOk(PortRegistryUnsetPort(serverName));
+    AssertNotConnected(PortRegistryGetPort(serverName, retrievedPort));
+}
+
+TEST_F(TestPortRegistry, UnsetPort) {
+    // Arrange
+    std::string serverName = GenerateString("Server名前");
+    std::string otherServerName = GenerateString("OtherServer名前");
+    uint16_t otherPort = GenerateU16();
+    AssertOk(PortRegistrySetPort(serverName, GenerateU16()));
+    AssertOk(PortRegistrySetPort(otherServerName, otherPort));
+
+    // Act
+    Result result = PortRegistryUnsetPort(serverName);
+
+    // Assert
+    AssertOk(result);
+    uint16_t retrievedPort{};
+    AssertNotConnected(PortRegistryGetPort(serverName, retrievedPort));
+    AssertOk(PortRegistryGetPort(otherServerName, retrievedPort));
+    EXPECT_EQ(otherPort, retrievedPort);
+    AssertOk(PortRegistryUnsetPort(otherServerName));
+}
+
+TEST_F(TestPortRegistry, GetPortOfNonExistingServer) {
+    // Arrange
+    std::string serverName = GenerateString("Server名前");
+
+    // Act
+    uint16_t port{};
+    Result result = PortRegistryGetPort(serverName, port);
+
+    // Assert
+    AssertNotConnected(result);
+}
+
+TEST_F(TestPortRegistry, SetPortWithTooLongServerName) {
+    // Arrange
+    std::string serverName(1000, 'a');
+
+    // Act
+    Result result = PortRegistrySetPort(serverName, GenerateU16());
+
+    // Assert
+    AssertError(result);
+}
+
+#ifndef _WIN32
+
+// Free entries are used before stale ones, so the registry is filled up until it has to claim the stale entry
+TEST(TestPortRegistryDeathTest, ClaimStaleEntry) {
+    // Arrange
+    // A freshly started process is needed, so that the stale entry belongs to another pid
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_EXIT(
+        {
+            (void)PortRegistrySetPort(fmt::format("StaleServer.{}", getppid()), GenerateU16());
+            std::_Exit(0);
+        },
+        ExitedWithCode(0),
+        "");
+
+    std::string staleServerName = fmt::format("StaleServer.{}", getpid());
+    std::vector<std::string> serverNames;
+    std::vector<uint16_t> ports;
+
+    // Act
+    while (true) {
+        std::string serverName = GenerateString("Server名前");
+        uint16_t port = GenerateU16();
+        if (!IsOk(PortRegistrySetPort(serverName, port))) {
+            break;
+        }
+
+        serverNames.push_back(serverName);
+        ports.push_back(port);
+        ASSERT_LE(serverNames.size(), 1024U);
+    }
+
+    // Assert
+    uint16_t retrievedPort{};
+    AssertNotConnected(PortRegistryGetPort(staleServerName, retrievedPort));
+    for (size_t i = 0; i < serverNames.size(); i++) {
+        AssertOk(PortRegistryGetPort(serverNames[i], retrievedPort));
+        EXPECT_EQ(ports[i], retrievedPort);
+        AssertOk(PortRegistryUnsetPort(serverNames[i]));
+    }
+}
+
+#endif
+
+}  // namespace
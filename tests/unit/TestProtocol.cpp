@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -114,6 +115,30 @@ TEST_P(TestProtocol, SendAndReceiveSignalId) {
     ASSERT_EQ(sendSignalId, receiveSignalId);
 }
 
+TEST_P(TestProtocol, SendAndReceiveUnorderedSignalIds) {
+    // Arrange
+    std::vector<IoSignalId> sendSignalIds = {IoSignalId{5}, IoSignalId{3}, IoSignalId{UINT32_MAX}, IoSignalId{}, GenerateIoSignalId()};
+
+    // Act
+    AssertOk(_protocol->WriteSize(_senderChannel->GetWriter(), sendSignalIds.size()));
+    for (IoSignalId signalId : sendSignalIds) {
+        AssertOk(_protocol->WriteSignalId(_senderChannel->GetWriter(), signalId));
+    }
+
+    AssertOk(_senderChannel->GetWriter().EndWrite());
+
+    // Assert
+    size_t size{};
+    AssertOk(_protocol->ReadSize(_receiverChannel->GetReader(), size));
+    std::vector<IoSignalId> receiveSignalIds(size);
+    for (IoSignalId& signalId : receiveSignalIds) {
+        AssertOk(_protocol->ReadSignalId(_receiverChannel->GetReader(), signalId));
+    }
+
+    _receiverChannel->GetReader().EndRead();
+    ASSERT_THAT(receiveSignalIds, ContainerEq(sendSignalIds));
+}
+
 TEST_P(TestProtocol, SendAndReceiveCanMessageContainer) {
     // Arrange
     CanMessageContainer sendCanMessageContainer;
@@ -261,6 +286,7 @@ TEST_P(TestProtocol, SendAndReceiveConnectOk) {
     Mode sendMode{};
     SimulationTime sendStepSize = GenerateSimulationTime();
     constexpr SimulationState sendSimulationState{};
+    uint32_t sendMaxFrameSize = GenerateU32();
     std::vector<IoSignalContainer> sendIncomingSignals = CreateSignals(2);
     std::vector<IoSignalContainer> sendOutgoingSignals = CreateSignals(3);
     std::vector<CanControllerContainer> sendCanControllers = CreateCanControllers(4);
@@ -279,7 +305,8 @@ TEST_P(TestProtocol, SendAndReceiveConnectOk) {
                                       sendCanControllers,
                                       sendEthControllers,
                                       sendLinControllers,
-                                      sendFrControllers));
+                                      sendFrControllers,
+                                      sendMaxFrameSize));
 
     // Assert
     AssertFrame(FrameKind::ConnectOk);
@@ -294,6 +321,7 @@ TEST_P(TestProtocol, SendAndReceiveConnectOk) {
     std::vector<EthControllerContainer> receiveEthControllers;
     std::vector<LinControllerContainer> receiveLinControllers;
     std::vector<FrControllerContainer> receiveFrControllers;
+    uint32_t receiveMaxFrameSize{};
     AssertOk(_protocol->ReadConnectOkVersion(_receiverChannel->GetReader(), receiveProtocolVersion));
     AssertOk(_protocol->ReadConnectOk(_receiverChannel->GetReader(),
                                       receiveMode,
@@ -304,10 +332,12 @@ TEST_P(TestProtocol, SendAndReceiveConnectOk) {
                                       receiveCanControllers,
                                       receiveEthControllers,
                                       receiveLinControllers,
-                                      receiveFrControllers));
+                                      receiveFrControllers,
+                                      receiveMaxFrameSize));
     EXPECT_EQ(sendProtocolVersion, receiveProtocolVersion);
     EXPECT_EQ(sendMode, receiveMode);
     EXPECT_EQ(sendStepSize, receiveStepSize);
+    EXPECT_EQ(sendMaxFrameSize, receiveMaxFrameSize);
     EXPECT_THAT(receiveIncomingSignals, ContainerEq(sendIncomingSignals));
     EXPECT_THAT(receiveOutgoingSignals, ContainerEq(sendOutgoingSignals));
     EXPECT_THAT(receiveCanControllers, ContainerEq(sendCanControllers));
@@ -396,6 +426,7 @@ TEST_P(TestProtocol, SendAndReceiveContinue) {
 
 TEST_P(TestProtocol, SendAndReceiveStep) {
     // Arrange
+    uint32_t sendSequenceNumber = GenerateU32();
     SimulationTime sendSimulationTime = GenerateSimulationTime();
 
     SerializeFunction serializeFunction = [=]([[maybe_unused]] ChannelWriter& writer) {
@@ -408,18 +439,77 @@ TEST_P(TestProtocol, SendAndReceiveStep) {
         };
 
     // Act
-    AssertOk(_protocol->SendStep(_senderChannel->GetWriter(), sendSimulationTime, serializeFunction, serializeFunction));
+    AssertOk(_protocol->SendStep(_senderChannel->GetWriter(), sendSequenceNumber, sendSimulationTime, serializeFunction, serializeFunction));
 
     // Assert
     AssertFrame(FrameKind::Step);
 
+    uint32_t receiveSequenceNumber{};
     SimulationTime receiveSimulationTime{};
-    AssertOk(_protocol->ReadStep(_receiverChannel->GetReader(), receiveSimulationTime, deserializeFunction, deserializeFunction, {}));
+    AssertOk(_protocol->ReadStep(_receiverChannel->GetReader(), receiveSequenceNumber, receiveSimulationTime, deserializeFunction, deserializeFunction, {}));
+    ASSERT_EQ(sendSequenceNumber, receiveSequenceNumber);
     ASSERT_EQ(sendSimulationTime, receiveSimulationTime);
 }
 
+TEST_P(TestProtocol, SendAndReceiveStepWithMessages) {
+    // Arrange
+    SimulationTime sendSimulationTime = GenerateSimulationTime();
+
+    std::vector<CanMessageContainer> sendMessageContainers(3);
+    for (CanMessageContainer& messageContainer : sendMessageContainers) {
+        FillWithRandom(messageContainer, GenerateBusControllerId());
+    }
+
+    sendMessageContainers[0].timestamp = sendSimulationTime;
+    sendMessageContainers[1].timestamp = sendSimulationTime - SimulationTime(GenerateU32());
+    sendMessageContainers[2].timestamp = sendSimulationTime + SimulationTime(GenerateU32());
+
+    SerializeFunction serializeNothing = [=]([[maybe_unused]] ChannelWriter& writer) {
+        return CreateOk();
+    };
+
+    SerializeFunction serializeMessages = [&](ChannelWriter& writer) {
+        CheckResult(_protocol->WriteSize(writer, sendMessageContainers.size()));
+        for (const CanMessageContainer& messageContainer : sendMessageContainers) {
+            CheckResult(_protocol->WriteMessage(writer, messageContainer));
+        }
+
+        return CreateOk();
+    };
+
+    std::vector<CanMessageContainer> receiveMessageContainers;
+    DeserializeFunction deserializeNothing =
+        [=]([[maybe_unused]] ChannelReader& reader, [[maybe_unused]] SimulationTime simulationTime, [[maybe_unused]] const Callbacks& callbacks) {
+            return CreateOk();
+        };
+
+    DeserializeFunction deserializeMessages =
+        [&](ChannelReader& reader, [[maybe_unused]] SimulationTime simulationTime, [[maybe_unused]] const Callbacks& callbacks) {
+            size_t size{};
+            CheckResult(_protocol->ReadSize(reader, size));
+            receiveMessageContainers.resize(size);
+            for (CanMessageContainer& messageContainer : receiveMessageContainers) {
+                CheckResult(_protocol->ReadMessage(reader, messageContainer));
+            }
+
+            return CreateOk();
+        };
+
+    // Act
+    AssertOk(_protocol->SendStep(_senderChannel->GetWriter(), GenerateU32(), sendSimulationTime, serializeNothing, serializeMessages));
+
+    // Assert
+    AssertFrame(FrameKind::Step);
+
+    uint32_t receiveSequenceNumber{};
+    SimulationTime receiveSimulationTime{};
+    AssertOk(_protocol->ReadStep(_receiverChannel->GetReader(), receiveSequenceNumber, receiveSimulationTime, deserializeNothing, deserializeMessages, {}));
+    ASSERT_THAT(receiveMessageContainers, ContainerEq(sendMessageContainers));
+}
+
 TEST_P(TestProtocol, SendAndReceiveStepOk) {
     // Arrange
+    uint32_t sendSequenceNumber = GenerateU32();
     SimulationTime sendSimulationTime = GenerateSimulationTime();
 
     auto sendCommand = static_cast<Command>(GenerateU32());
@@ -434,14 +524,22 @@ TEST_P(TestProtocol, SendAndReceiveStepOk) {
         };
 
     // Act
-    AssertOk(_protocol->SendStepOk(_senderChannel->GetWriter(), sendSimulationTime, sendCommand, serializeFunction, serializeFunction));
+    AssertOk(_protocol->SendStepOk(_senderChannel->GetWriter(), sendSequenceNumber, sendSimulationTime, sendCommand, serializeFunction, serializeFunction));
 
     // Assert
     AssertFrame(FrameKind::StepOk);
 
+    uint32_t receiveSequenceNumber{};
     SimulationTime receiveSimulationTime{};
     Command receiveCommand{};
-    AssertOk(_protocol->ReadStepOk(_receiverChannel->GetReader(), receiveSimulationTime, receiveCommand, deserializeFunction, deserializeFunction, {}));
+    AssertOk(_protocol->ReadStepOk(_receiverChannel->GetReader(),
+                                   receiveSequenceNumber,
+                                   receiveSimulationTime,
+                                   receiveCommand,
+                                   deserializeFunction,
+                                   deserializeFunction,
+                                   {}));
+    ASSERT_EQ(sendSequenceNumber, receiveSequenceNumber);
     ASSERT_EQ(sendSimulationTime, receiveSimulationTime);
 }
 
@@ -508,6 +606,138 @@ TEST_P(TestProtocol, SendAndReceiveUnsetPort) {
     ASSERT_EQ(sendServerName, receiveServerName);
 }
 
+TEST_P(TestProtocol, SendAndReceiveGetPorts) {
+    // Arrange
+    std::vector<std::string> sendServerNames{GenerateString("Server名前"), GenerateString("Server名前"), std::string()};
+
+    // Act
+    AssertOk(_protocol->SendGetPorts(_senderChannel->GetWriter(), sendServerNames));
+
+    // Assert
+    AssertFrame(FrameKind::GetPorts);
+
+    std::vector<std::string> receiveServerNames;
+    AssertOk(_protocol->ReadGetPorts(_receiverChannel->GetReader(), receiveServerNames));
+    ASSERT_EQ(sendServerNames, receiveServerNames);
+}
+
+TEST_P(TestProtocol, SendAndReceiveGetPortsOk) {
+    // Arrange
+    std::vector<uint16_t> sendPorts{GenerateU16(), 0, GenerateU16()};
+
+    // Act
+    AssertOk(_protocol->SendGetPortsOk(_senderChannel->GetWriter(), sendPorts));
+
+    // Assert
+    AssertFrame(FrameKind::GetPortsOk);
+
+    std::vector<uint16_t> receivePorts;
+    AssertOk(_protocol->ReadGetPortsOk(_receiverChannel->GetReader(), receivePorts));
+    ASSERT_EQ(sendPorts, receivePorts);
+}
+
+TEST_P(TestProtocol, SendAndReceiveSetPorts) {
+    // Arrange
+    std::vector<PortMapperEntry> sendEntries{{GenerateString("Server名前"), GenerateU16()}, {GenerateString("Server名前"), GenerateU16()}};
+
+    // Act
+    AssertOk(_protocol->SendSetPorts(_senderChannel->GetWriter(), sendEntries));
+
+    // Assert
+    AssertFrame(FrameKind::SetPorts);
+
+    std::vector<PortMapperEntry> receiveEntries;
+    AssertOk(_protocol->ReadSetPorts(_receiverChannel->GetReader(), receiveEntries));
+    ASSERT_EQ(sendEntries.size(), receiveEntries.size());
+    for (size_t i = 0; i < sendEntries.size(); i++) {
+        EXPECT_EQ(sendEntries[i].serverName, receiveEntries[i].serverName);
+        EXPECT_EQ(sendEntries[i].port, receiveEntries[i].port);
+    }
+}
+
+TEST_P(TestProtocol, SendAndReceiveSession) {
+    // Arrange
+    uint64_t sendSessionToken = GenerateU64();
+    uint32_t sendResumeTimeout = GenerateU32();
+
+    // Act
+    AssertOk(_protocol->SendSession(_senderChannel->GetWriter(), sendSessionToken, sendResumeTimeout));
+
+    // Assert
+    AssertFrame(FrameKind::Session);
+
+    uint64_t receiveSessionToken{};
+    uint32_t receiveResumeTimeout{};
+    AssertOk(_protocol->ReadSession(_receiverChannel->GetReader(), receiveSessionToken, receiveResumeTimeout));
+    ASSERT_EQ(sendSessionToken, receiveSessionToken);
+    ASSERT_EQ(sendResumeTimeout, receiveResumeTimeout);
+}
+
+TEST_P(TestProtocol, SendAndReceiveResume) {
+    // Arrange
+    uint64_t sendSessionToken = GenerateU64();
+
+    // Act
+    AssertOk(_protocol->SendResume(_senderChannel->GetWriter(), sendSessionToken));
+
+    // Assert
+    AssertFrame(FrameKind::Resume);
+
+    uint64_t receiveSessionToken{};
+    AssertOk(_protocol->ReadResume(_receiverChannel->GetReader(), receiveSessionToken));
+    ASSERT_EQ(sendSessionToken, receiveSessionToken);
+}
+
+TEST_P(TestProtocol, SendAndReceiveGetCatalog) {
+    // Arrange
+    uint64_t sendCachedCatalogHash = GenerateU64();
+
+    // Act
+    AssertOk(_protocol->SendGetCatalog(_senderChannel->GetWriter(), sendCachedCatalogHash));
+
+    // Assert
+    AssertFrame(FrameKind::GetCatalog);
+
+    uint64_t receiveCachedCatalogHash{};
+    AssertOk(_protocol->ReadGetCatalog(_receiverChannel->GetReader(), receiveCachedCatalogHash));
+    ASSERT_EQ(sendCachedCatalogHash, receiveCachedCatalogHash);
+}
+
+TEST_P(TestProtocol, SendAndReceiveCatalog) {
+    // Arrange
+    uint64_t sendCatalogHash = GenerateU64();
+    std::vector<uint8_t> sendCatalog = GenerateBytes(1000);
+
+    // Act
+    AssertOk(_protocol->SendCatalog(_senderChannel->GetWriter(), sendCatalogHash, sendCatalog));
+
+    // Assert
+    AssertFrame(FrameKind::Catalog);
+
+    uint64_t receiveCatalogHash{};
+    std::vector<uint8_t> receiveCatalog;
+    AssertOk(_protocol->ReadCatalog(_receiverChannel->GetReader(), receiveCatalogHash, receiveCatalog));
+    ASSERT_EQ(sendCatalogHash, receiveCatalogHash);
+    ASSERT_EQ(sendCatalog, receiveCatalog);
+}
+
+TEST_P(TestProtocol, SendAndReceiveEmptyCatalog) {
+    // Arrange
+    uint64_t sendCatalogHash = GenerateU64();
+
+    // Act
+    AssertOk(_protocol->SendCatalog(_senderChannel->GetWriter(), sendCatalogHash, {}));
+
+    // Assert
+    AssertFrame(FrameKind::Catalog);
+
+    uint64_t receiveCatalogHash{};
+    std::vector<uint8_t> receiveCatalog = GenerateBytes(10);
+    AssertOk(_protocol->ReadCatalog(_receiverChannel->GetReader(), receiveCatalogHash, receiveCatalog));
+    ASSERT_EQ(sendCatalogHash, receiveCatalogHash);
+    ASSERT_TRUE(receiveCatalog.empty());
+}
+
 TEST_P(TestProtocol, SendAndReceiveConnectWithEmptyNames) {
     // Arrange
     uint32_t sendVersion = GenerateU32();
@@ -553,9 +783,10 @@ TEST_P(TestProtocol, SendAndReceiveConnectOkWithEmptyLists) {
     Mode sendMode{};
     SimulationTime sendStepSize = GenerateSimulationTime();
     constexpr SimulationState sendSimulationState{};
+    uint32_t sendMaxFrameSize = GenerateU32();
 
     // Act
-    AssertOk(_protocol->SendConnectOk(_senderChannel->GetWriter(), sendProtocolVersion, sendMode, sendStepSize, sendSimulationState, {}, {}, {}, {}, {}, {}));
+    AssertOk(_protocol->SendConnectOk(_senderChannel->GetWriter(), sendProtocolVersion, sendMode, sendStepSize, sendSimulationState, {}, {}, {}, {}, {}, {}, sendMaxFrameSize));
 
     // Assert
     AssertFrame(FrameKind::ConnectOk);
@@ -570,6 +801,7 @@ TEST_P(TestProtocol, SendAndReceiveConnectOkWithEmptyLists) {
     std::vector<EthControllerContainer> receiveEthControllers;
     std::vector<LinControllerContainer> receiveLinControllers;
     std::vector<FrControllerContainer> receiveFrControllers;
+    uint32_t receiveMaxFrameSize{};
     AssertOk(_protocol->ReadConnectOkVersion(_receiverChannel->GetReader(), receiveProtocolVersion));
     AssertOk(_protocol->ReadConnectOk(_receiverChannel->GetReader(),
                                       receiveMode,
@@ -580,10 +812,12 @@ TEST_P(TestProtocol, SendAndReceiveConnectOkWithEmptyLists) {
                                       receiveCanControllers,
                                       receiveEthControllers,
                                       receiveLinControllers,
-                                      receiveFrControllers));
+                                      receiveFrControllers,
+                                      receiveMaxFrameSize));
     EXPECT_EQ(sendProtocolVersion, receiveProtocolVersion);
     EXPECT_EQ(sendMode, receiveMode);
     EXPECT_EQ(sendStepSize, receiveStepSize);
+    EXPECT_EQ(sendMaxFrameSize, receiveMaxFrameSize);
     EXPECT_TRUE(receiveIncomingSignals.empty());
     EXPECT_TRUE(receiveOutgoingSignals.empty());
     EXPECT_TRUE(receiveCanControllers.empty());
@@ -598,6 +832,7 @@ TEST_P(TestProtocol, SendAndReceiveConnectOkWithManyControllers) {
     Mode sendMode{};
     SimulationTime sendStepSize = GenerateSimulationTime();
     constexpr SimulationState sendSimulationState{};
+    uint32_t sendMaxFrameSize = GenerateU32();
     std::vector<IoSignalContainer> sendIncomingSignals = CreateSignals(20);
     std::vector<IoSignalContainer> sendOutgoingSignals = CreateSignals(20);
     std::vector<CanControllerContainer> sendCanControllers = CreateCanControllers(20);
@@ -616,7 +851,8 @@ TEST_P(TestProtocol, SendAndReceiveConnectOkWithManyControllers) {
                                       sendCanControllers,
                                       sendEthControllers,
                                       sendLinControllers,
-                                      sendFrControllers));
+                                      sendFrControllers,
+                                      sendMaxFrameSize));
 
     // Assert
     AssertFrame(FrameKind::ConnectOk);
@@ -631,6 +867,7 @@ TEST_P(TestProtocol, SendAndReceiveConnectOkWithManyControllers) {
     std::vector<EthControllerContainer> receiveEthControllers;
     std::vector<LinControllerContainer> receiveLinControllers;
     std::vector<FrControllerContainer> receiveFrControllers;
+    uint32_t receiveMaxFrameSize{};
     AssertOk(_protocol->ReadConnectOkVersion(_receiverChannel->GetReader(), receiveProtocolVersion));
     AssertOk(_protocol->ReadConnectOk(_receiverChannel->GetReader(),
                                       receiveMode,
@@ -641,10 +878,12 @@ TEST_P(TestProtocol, SendAndReceiveConnectOkWithManyControllers) {
                                       receiveCanControllers,
                                       receiveEthControllers,
                                       receiveLinControllers,
-                                      receiveFrControllers));
+                                      receiveFrControllers,
+                                      receiveMaxFrameSize));
     EXPECT_EQ(sendProtocolVersion, receiveProtocolVersion);
     EXPECT_EQ(sendMode, receiveMode);
     EXPECT_EQ(sendStepSize, receiveStepSize);
+    EXPECT_EQ(sendMaxFrameSize, receiveMaxFrameSize);
     EXPECT_THAT(receiveIncomingSignals, ContainerEq(sendIncomingSignals));
     EXPECT_THAT(receiveOutgoingSignals, ContainerEq(sendOutgoingSignals));
     EXPECT_THAT(receiveCanControllers, ContainerEq(sendCanControllers));
@@ -3,6 +3,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -143,6 +144,42 @@ protected:
 
         ASSERT_TRUE(expectedCallbacks.empty()) << "Not all expected callbacks were called.";
     }
+
+    static void TransferWithBatchEvent(SignalExchange& writerSignalExchange,
+                                       SignalExchange& readerSignalExchange,
+                                       const std::vector<EventData>& expectedChanges) {
+        ChannelReader& reader = _receiverChannel->GetReader();
+        ChannelWriter& writer = _senderChannel->GetWriter();
+
+        SimulationTime simulationTime = GenerateSimulationTime();
+
+        size_t callCount = 0;
+        Callbacks callbacks{};
+        callbacks.incomingSignalsChangedCallback = [&](SimulationTime simTime, const IncomingSignalChange* changes, uint32_t count) {
+            ASSERT_EQ(simTime, simulationTime);
+            ASSERT_EQ(expectedChanges.size(), count);
+            for (uint32_t i = 0; i < count; i++) {
+                auto& [signal, data] = expectedChanges[i];
+                ASSERT_EQ(signal.id, changes[i].signal->id);
+                ASSERT_EQ(signal.length, changes[i].length);
+                std::vector<uint8_t> receivedData(changes[i].length * GetDataTypeSize(changes[i].signal->dataType));
+                memcpy(receivedData.data(), changes[i].value, receivedData.size());
+                ASSERT_THAT(receivedData, ContainerEq(data));
+            }
+
+            callCount++;
+        };
+        callbacks.incomingSignalChangedCallback = [](SimulationTime, const IoSignal&, uint32_t, const void*) {
+            FAIL() << "Single signal callback must not be called if the batch callback is set.";
+        };
+
+        AssertOk(writerSignalExchange.Serialize(writer));
+        AssertOk(writer.EndWrite());
+
+        AssertOk(readerSignalExchange.Deserialize(reader, simulationTime, callbacks));
+
+        ASSERT_EQ(expectedChanges.empty() ? 0U : 1U, callCount);
+    }
 };
 
 std::unique_ptr<Channel> TestSignalExchange::_senderChannel;
@@ -250,6 +287,122 @@ TEST_P(TestSignalExchange, WriteFixedSizedDataAndRead) {
     ASSERT_THAT(readValue, ContainerEq(writeValue));
 }
 
+TEST_P(TestSignalExchange, WriteByHandleAndReadByHandle) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal1 = CreateSignal(dataType, SizeKind::Fixed);
+    IoSignalContainer signal2 = CreateSignal(dataType, SizeKind::Variable);
+    IoSignalContainer signal3 = CreateSignal(dataType, SizeKind::Fixed);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal1.Convert(), signal2.Convert(), signal3.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    IoSignalHandle writeHandle2{};
+    IoSignalHandle writeHandle3{};
+    AssertOk(writerSignalExchange->ResolveWriteSignal(signal2.id, writeHandle2));
+    AssertOk(writerSignalExchange->ResolveWriteSignal(signal3.id, writeHandle3));
+
+    IoSignalHandle readHandle2{};
+    IoSignalHandle readHandle3{};
+    AssertOk(readerSignalExchange->ResolveReadSignal(signal2.id, readHandle2));
+    AssertOk(readerSignalExchange->ResolveReadSignal(signal3.id, readHandle3));
+
+    std::vector<uint8_t> writeValue2 = GenerateIoData(signal2);
+    std::vector<uint8_t> writeValue3 = GenerateIoData(signal3);
+    AssertOk(writerSignalExchange->Write(writeHandle2, signal2.length, writeValue2.data()));
+    AssertOk(writerSignalExchange->Write(writeHandle3, signal3.length, writeValue3.data()));
+
+    Transfer(*writerSignalExchange, *readerSignalExchange);
+
+    uint32_t readLength2{};
+    std::vector<uint8_t> readValue2 = CreateZeroedIoData(signal2);
+    uint32_t readLength3{};
+    const void* readValue3{};
+
+    // Act
+    AssertOk(readerSignalExchange->Read(readHandle2, readLength2, readValue2.data()));
+    AssertOk(readerSignalExchange->Read(readHandle3, readLength3, &readValue3));
+
+    // Assert
+    ASSERT_EQ(signal2.length, readLength2);
+    ASSERT_THAT(readValue2, ContainerEq(writeValue2));
+    ASSERT_EQ(signal3.length, readLength3);
+    ASSERT_EQ(0, memcmp(writeValue3.data(), readValue3, writeValue3.size()));
+}
+
+TEST_P(TestSignalExchange, WriteMultipleSignalsAtOnceAndReadAtOnce) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal1 = CreateSignal(dataType, SizeKind::Fixed);
+    IoSignalContainer signal2 = CreateSignal(dataType, SizeKind::Variable);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal1.Convert(), signal2.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    std::vector<uint8_t> writeValue1 = GenerateIoData(signal1);
+    std::vector<uint8_t> writeValue2 = GenerateIoData(signal2);
+    std::vector<OutgoingSignalValue> writeValues(2);
+    AssertOk(writerSignalExchange->ResolveWriteSignal(signal1.id, writeValues[0].signalHandle));
+    AssertOk(writerSignalExchange->ResolveWriteSignal(signal2.id, writeValues[1].signalHandle));
+    writeValues[0].length = signal1.length;
+    writeValues[0].value = writeValue1.data();
+    writeValues[1].length = signal2.length;
+    writeValues[1].value = writeValue2.data();
+
+    AssertOk(writerSignalExchange->Write(writeValues.data(), writeValues.size()));
+
+    Transfer(*writerSignalExchange, *readerSignalExchange);
+
+    std::vector<uint8_t> readValue1 = CreateZeroedIoData(signal1);
+    std::vector<uint8_t> readValue2 = CreateZeroedIoData(signal2);
+    std::vector<IncomingSignalValue> readValues(2);
+    AssertOk(readerSignalExchange->ResolveReadSignal(signal1.id, readValues[0].signalHandle));
+    AssertOk(readerSignalExchange->ResolveReadSignal(signal2.id, readValues[1].signalHandle));
+    readValues[0].value = readValue1.data();
+    readValues[1].value = readValue2.data();
+
+    // Act
+    AssertOk(readerSignalExchange->Read(readValues.data(), readValues.size()));
+
+    // Assert
+    ASSERT_EQ(signal1.length, readValues[0].length);
+    ASSERT_THAT(readValue1, ContainerEq(writeValue1));
+    ASSERT_EQ(signal2.length, readValues[1].length);
+    ASSERT_THAT(readValue2, ContainerEq(writeValue2));
+}
+
 TEST_P(TestSignalExchange, WriteFixedSizedDataTwiceAndReadLatestValue) {
     // Arrange
     auto [coSimType, connectionKind, dataType] = GetParam();
@@ -483,6 +636,46 @@ TEST_P(TestSignalExchange, WriteVariableSizedDataTwiceAndReadLatestValue) {
     ASSERT_THAT(readValue, ContainerEq(writeValue));
 }
 
+TEST_P(TestSignalExchange, WriteVariableSizedDataAndReadInitialDataAfterClear) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Variable);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    std::vector<uint8_t> writeValue = GenerateIoData(signal);
+    AssertOk(writerSignalExchange->Write(signal.id, signal.length, writeValue.data()));
+
+    Transfer(*writerSignalExchange, *readerSignalExchange);
+
+    uint32_t readLength{};
+    const void* readValue{};
+
+    // Act
+    readerSignalExchange->ClearData();
+
+    // Assert
+    AssertOk(readerSignalExchange->Read(signal.id, readLength, &readValue));
+    ASSERT_EQ(0U, readLength);
+}
+
 TEST_P(TestSignalExchange, WriteVariableSizedDataAndReceiveEvent) {
     // Arrange
     auto [coSimType, connectionKind, dataType] = GetParam();
@@ -590,6 +783,100 @@ TEST_P(TestSignalExchange, WriteVariableSizedDataWhereOnlyOneElementChangedAndRe
     TransferWithEvents(*writerSignalExchange, *readerSignalExchange, {{signal, writeValue}});
 }
 
+TEST_P(TestSignalExchange, WriteLargeFixedSizedDataWhereOnlyOneCacheLineChangedAndReceiveEvent) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+    signal.length = GenerateRandom(1000U, 2000U);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    std::vector<uint8_t> writeValue = GenerateIoData(signal);
+    AssertOk(writerSignalExchange->Write(signal.id, signal.length, writeValue.data()));
+
+    TransferWithEvents(*writerSignalExchange, *readerSignalExchange, {{signal, writeValue}});
+
+    // Act and assert
+    ++writeValue[writeValue.size() / 2];
+    ++writeValue.back();  // Partial last cache line
+    AssertOk(writerSignalExchange->Write(signal.id, signal.length, writeValue.data()));
+
+    TransferWithEvents(*writerSignalExchange, *readerSignalExchange, {{signal, writeValue}});
+
+    AssertOk(writerSignalExchange->Write(signal.id, signal.length, writeValue.data()));
+
+    TransferWithEvents(*writerSignalExchange, *readerSignalExchange, {});
+}
+
+TEST_P(TestSignalExchange, WriteLargeDataAfterReaderClearedAndReadWholeValue) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+    if (connectionKind == ConnectionKind::Local) {
+        GTEST_SKIP() << "Both sides share the values, so only one side cannot clear them.";
+    }
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+    signal.length = GenerateRandom(1000U, 2000U);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    std::vector<uint8_t> writeValue = GenerateIoData(signal);
+    AssertOk(writerSignalExchange->Write(signal.id, signal.length, writeValue.data()));
+
+    Transfer(*writerSignalExchange, *readerSignalExchange);
+
+    readerSignalExchange->ClearData();
+    writerSignalExchange->RequireFullValues();
+
+    ++writeValue[writeValue.size() / 2];
+    AssertOk(writerSignalExchange->Write(signal.id, signal.length, writeValue.data()));
+
+    Transfer(*writerSignalExchange, *readerSignalExchange);
+
+    uint32_t readLength{};
+    std::vector<uint8_t> readValue = CreateZeroedIoData(signal);
+
+    // Act
+    AssertOk(readerSignalExchange->Read(signal.id, readLength, readValue.data()));
+
+    // Assert
+    ASSERT_EQ(signal.length, readLength);
+    ASSERT_THAT(readValue, ContainerEq(writeValue));
+}
+
 TEST_P(TestSignalExchange, WriteVariableSizedDataWithOnlyChangedLengthAndReceiveEventWithSharedMemory) {
     // Arrange
     auto [coSimType, connectionKind, dataType] = GetParam();
@@ -700,6 +987,130 @@ TEST_P(TestSignalExchange, WriteMultipleSignalsAndReceiveMultipleEvents) {
     TransferWithEvents(*writerSignalExchange, *readerSignalExchange, {{signal1, value1}, {signal2, value2}, {signal3, value3}});
 }
 
+TEST_P(TestSignalExchange, WriteMultipleSignalsAndReceiveOneBatchEvent) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal1 = CreateSignal(dataType, SizeKind::Fixed);
+    IoSignalContainer signal2 = CreateSignal(dataType, SizeKind::Variable);
+    IoSignalContainer signal3 = CreateSignal(dataType, SizeKind::Fixed);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal1.Convert(), signal2.Convert(), signal3.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    std::vector<uint8_t> value1 = GenerateIoData(signal1);
+    std::vector<uint8_t> value3 = GenerateIoData(signal3);
+
+    // Act and assert
+    AssertOk(writerSignalExchange->Write(signal1.id, signal1.length, value1.data()));
+    AssertOk(writerSignalExchange->Write(signal3.id, signal3.length, value3.data()));
+
+    TransferWithBatchEvent(*writerSignalExchange, *readerSignalExchange, {{signal1, value1}, {signal3, value3}});
+    TransferWithBatchEvent(*writerSignalExchange, *readerSignalExchange, {});
+}
+
+TEST_P(TestSignalExchange, WriteFewOfManySignalsAndReceiveEvents) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    std::vector<IoSignalContainer> signals;
+    std::vector<IoSignal> incomingSignals;
+    std::vector<IoSignal> outgoingSignals;
+    for (size_t i = 0; i < 20; i++) {
+        signals.push_back(CreateSignal(dataType, i % 2 == 0 ? SizeKind::Fixed : SizeKind::Variable));
+        outgoingSignals.push_back(signals.back().Convert());
+    }
+
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    std::vector<uint8_t> value1 = GenerateIoData(signals[3]);
+    std::vector<uint8_t> value2 = GenerateIoData(signals[16]);
+
+    // Act and assert
+    AssertOk(writerSignalExchange->Write(signals[3].id, signals[3].length, value1.data()));
+    AssertOk(writerSignalExchange->Write(signals[16].id, signals[16].length, value2.data()));
+
+    TransferWithEvents(*writerSignalExchange, *readerSignalExchange, {{signals[3], value1}, {signals[16], value2}});
+}
+
+TEST_P(TestSignalExchange, WriteMostOfManySignalsAndReceiveEvents) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    std::vector<IoSignalContainer> signals;
+    std::vector<IoSignal> incomingSignals;
+    std::vector<IoSignal> outgoingSignals;
+    for (size_t i = 0; i < 20; i++) {
+        signals.push_back(CreateSignal(dataType, i % 2 == 0 ? SizeKind::Fixed : SizeKind::Variable));
+        outgoingSignals.push_back(signals.back().Convert());
+    }
+
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> writerSignalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, writerSignalExchange));
+
+    std::unique_ptr<SignalExchange> readerSignalExchange;
+    AssertOk(CreateSignalExchange(GetCounterPart(coSimType),
+                                  connectionKind,
+                                  GetCounterPart(name, connectionKind),
+                                  incomingSignals,
+                                  outgoingSignals,
+                                  *_protocol,
+                                  readerSignalExchange));
+
+    std::deque<EventData> expectedCallbacks;
+    for (size_t i = 0; i < signals.size(); i++) {
+        if (i == 7) {
+            continue;
+        }
+
+        std::vector<uint8_t> value = GenerateIoData(signals[i]);
+        AssertOk(writerSignalExchange->Write(signals[i].id, signals[i].length, value.data()));
+        expectedCallbacks.push_back({signals[i], value});
+    }
+
+    // Act and assert
+    TransferWithEvents(*writerSignalExchange, *readerSignalExchange, expectedCallbacks);
+
+    uint32_t readLength{};
+    std::vector<uint8_t> readValue(signals[19].length * GetDataTypeSize(dataType));
+    AssertOk(readerSignalExchange->Read(signals[19].id, readLength, readValue.data()));
+    ASSERT_EQ(signals[19].length, readLength);
+    ASSERT_THAT(readValue, ContainerEq(expectedCallbacks.back().data));
+}
+
 TEST_P(TestSignalExchange, WriteToInvalidSignalIdShouldFail) {
     // Arrange
     auto [coSimType, connectionKind, dataType] = GetParam();
@@ -725,6 +1136,117 @@ TEST_P(TestSignalExchange, WriteToInvalidSignalIdShouldFail) {
     AssertError(result);
 }
 
+TEST_P(TestSignalExchange, ResolveInvalidSignalIdShouldFail) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> signalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, signalExchange));
+
+    IoSignalId invalidId{99999};  // Non-existent ID
+    IoSignalHandle signalHandle{};
+
+    // Act
+    Result result = signalExchange->ResolveWriteSignal(invalidId, signalHandle);
+
+    // Assert
+    AssertError(result);
+}
+
+TEST_P(TestSignalExchange, WriteToInvalidSignalHandleShouldFail) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer signal = CreateSignal(dataType, SizeKind::Fixed);
+
+    std::vector<IoSignal> incomingSignals;
+    std::vector outgoingSignals = {signal.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> signalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, signalExchange));
+
+    std::vector<uint8_t> writeValue = GenerateIoData(signal);
+    IoSignalHandle invalidHandle{1};  // Only one signal
+
+    // Act
+    Result result = signalExchange->Write(invalidHandle, signal.length, writeValue.data());
+
+    // Assert
+    AssertError(result);
+}
+
+TEST_P(TestSignalExchange, WriteWithHandleOfReadSignalShouldFail) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer readSignal = CreateSignal(dataType, SizeKind::Fixed);
+    IoSignalContainer writeSignal = CreateSignal(dataType, SizeKind::Fixed);
+    writeSignal.length = readSignal.length;
+
+    std::vector incomingSignals = {readSignal.Convert()};
+    std::vector outgoingSignals = {writeSignal.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> signalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, signalExchange));
+
+    // Both signals have the same index within their direction
+    IoSignalHandle readHandle{};
+    AssertOk(signalExchange->ResolveReadSignal(readSignal.id, readHandle));
+
+    std::vector<uint8_t> writeValue = GenerateIoData(writeSignal);
+
+    // Act
+    Result result = signalExchange->Write(readHandle, writeSignal.length, writeValue.data());
+
+    // Assert
+    AssertError(result);
+}
+
+TEST_P(TestSignalExchange, ReadWithHandleOfWrittenSignalShouldFail) {
+    // Arrange
+    auto [coSimType, connectionKind, dataType] = GetParam();
+
+    std::string name = GenerateString("SignalExchange名前");
+
+    IoSignalContainer readSignal = CreateSignal(dataType, SizeKind::Fixed);
+    IoSignalContainer writeSignal = CreateSignal(dataType, SizeKind::Fixed);
+    writeSignal.length = readSignal.length;
+
+    std::vector incomingSignals = {readSignal.Convert()};
+    std::vector outgoingSignals = {writeSignal.Convert()};
+    SwitchSignals(incomingSignals, outgoingSignals, coSimType);
+
+    std::unique_ptr<SignalExchange> signalExchange;
+    AssertOk(CreateSignalExchange(coSimType, connectionKind, name, incomingSignals, outgoingSignals, *_protocol, signalExchange));
+
+    // Both signals have the same index within their direction
+    IoSignalHandle writeHandle{};
+    AssertOk(signalExchange->ResolveWriteSignal(writeSignal.id, writeHandle));
+
+    std::vector<uint8_t> readValue(readSignal.length * GetDataTypeSize(dataType));
+    uint32_t readLength{};
+
+    // Act
+    Result result = signalExchange->Read(writeHandle, readLength, readValue.data());
+
+    // Assert
+    AssertError(result);
+}
+
 TEST_P(TestSignalExchange, ReadFromInvalidSignalIdShouldFail) {
     // Arrange
     auto [coSimType, connectionKind, dataType] = GetParam();
@@ -0,0 +1,163 @@
+// Copyright dSPACE SE & Co. KG. All rights reserved.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "Channel.hpp"
+#include "CoSimTypes.hpp"
+#include "Helper.hpp"
+#include "StepCodec.hpp"
+#include "TestHelper.hpp"
+
+using namespace DsVeosCoSim;
+using namespace testing;
+
+namespace {
+
+class TestStepCodec : public TestWithParam<StepEncoding> {
+protected:
+    std::unique_ptr<Channel> _senderChannel;
+    std::unique_ptr<Channel> _receiverChannel;
+
+    void SetUp() override {
+        std::unique_ptr<ChannelServer> server;
+        AssertOk(CreateTcpChannelServer(0, true, server));
+        uint16_t port = server->GetLocalPort();
+
+        AssertOk(TryConnectToTcpChannel("127.0.0.1", port, 0, DefaultTimeoutInMilliseconds, _senderChannel));
+        AssertOk(server->TryAccept(_receiverChannel));
+    }
+
+    void TearDown() override {
+        _senderChannel->Disconnect();
+        _receiverChannel->Disconnect();
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(,
+                         TestStepCodec,
+                         Values(StepEncoding::Fixed, StepEncoding::Varint),
+                         [](const TestParamInfo<StepEncoding>& info) {
+                             return info.param == StepEncoding::Fixed ? "Fixed" : "Varint";
+                         });
+
+TEST_P(TestStepCodec, WriteAndReadSignalIds) {
+    // Arrange
+    std::vector<IoSignalId> sendSignalIds = {IoSignalId{5}, IoSignalId{3}, IoSignalId{UINT32_MAX}, IoSignalId{}, GenerateIoSignalId()};
+    uint32_t sendLength = GenerateU32();
+
+    // Act
+    AssertOk(WithStepCodec(GetParam(), SimulationTime{}, [&](auto& codec) {
+        CheckResult(codec.WriteSize(_senderChannel->GetWriter(), sendSignalIds.size()));
+        for (IoSignalId signalId : sendSignalIds) {
+            CheckResult(codec.WriteSignalId(_senderChannel->GetWriter(), signalId));
+        }
+
+        CheckResult(codec.WriteLength(_senderChannel->GetWriter(), sendLength));
+        return _senderChannel->GetWriter().EndWrite();
+    }));
+
+    // Assert
+    std::vector<IoSignalId> receiveSignalIds;
+    uint32_t receiveLength{};
+    AssertOk(WithStepCodec(GetParam(), SimulationTime{}, [&](auto& codec) {
+        size_t size{};
+        CheckResult(codec.ReadSize(_receiverChannel->GetReader(), size));
+        receiveSignalIds.resize(size);
+        for (IoSignalId& signalId : receiveSignalIds) {
+            CheckResult(codec.ReadSignalId(_receiverChannel->GetReader(), signalId));
+        }
+
+        return codec.ReadLength(_receiverChannel->GetReader(), receiveLength);
+    }));
+    _receiverChannel->GetReader().EndRead();
+
+    ASSERT_THAT(receiveSignalIds, ContainerEq(sendSignalIds));
+    ASSERT_EQ(sendLength, receiveLength);
+}
+
+TEST_P(TestStepCodec, WriteAndReadSignalIdsBetweenLengths) {
+    // Arrange
+    std::vector<IoSignalId> sendSignalIds = {IoSignalId{7}, IoSignalId{9}, IoSignalId{4}, GenerateIoSignalId()};
+    std::vector<uint32_t> sendLengths = {GenerateU32(), 0, UINT32_MAX, GenerateU32()};
+
+    // Act
+    AssertOk(WithStepCodec(GetParam(), SimulationTime{}, [&](auto& codec) {
+        for (size_t i = 0; i < sendSignalIds.size(); i++) {
+            CheckResult(codec.WriteSignalId(_senderChannel->GetWriter(), sendSignalIds[i]));
+            CheckResult(codec.WriteLength(_senderChannel->GetWriter(), sendLengths[i]));
+        }
+
+        return _senderChannel->GetWriter().EndWrite();
+    }));
+
+    // Assert
+    std::vector<IoSignalId> receiveSignalIds(sendSignalIds.size());
+    std::vector<uint32_t> receiveLengths(sendLengths.size());
+    AssertOk(WithStepCodec(GetParam(), SimulationTime{}, [&](auto& codec) {
+        for (size_t i = 0; i < receiveSignalIds.size(); i++) {
+            CheckResult(codec.ReadSignalId(_receiverChannel->GetReader(), receiveSignalIds[i]));
+            CheckResult(codec.ReadLength(_receiverChannel->GetReader(), receiveLengths[i]));
+        }
+
+        return CreateOk();
+    }));
+    _receiverChannel->GetReader().EndRead();
+
+    ASSERT_THAT(receiveSignalIds, ContainerEq(sendSignalIds));
+    ASSERT_THAT(receiveLengths, ContainerEq(sendLengths));
+}
+
+TEST_P(TestStepCodec, WriteAndReadMessages) {
+    // Arrange
+    SimulationTime referenceTime = GenerateSimulationTime();
+
+    CanMessageContainer sendCanMessageContainer;
+    FillWithRandom(sendCanMessageContainer, GenerateBusControllerId());
+    sendCanMessageContainer.timestamp = referenceTime - SimulationTime(GenerateU32());
+
+    EthMessageContainer sendEthMessageContainer;
+    FillWithRandom(sendEthMessageContainer, GenerateBusControllerId());
+
+    LinMessageContainer sendLinMessageContainer;
+    FillWithRandom(sendLinMessageContainer, GenerateBusControllerId());
+
+    FrMessageContainer sendFrMessageContainer;
+    FillWithRandom(sendFrMessageContainer, GenerateBusControllerId());
+    sendFrMessageContainer.timestamp = referenceTime + SimulationTime(GenerateU32());
+
+    // Act
+    AssertOk(WithStepCodec(GetParam(), referenceTime, [&](auto& codec) {
+        CheckResult(codec.WriteMessage(_senderChannel->GetWriter(), sendCanMessageContainer));
+        CheckResult(codec.WriteMessage(_senderChannel->GetWriter(), sendEthMessageContainer));
+        CheckResult(codec.WriteMessage(_senderChannel->GetWriter(), sendLinMessageContainer));
+        CheckResult(codec.WriteMessage(_senderChannel->GetWriter(), sendFrMessageContainer));
+        return _senderChannel->GetWriter().EndWrite();
+    }));
+
+    // Assert
+    CanMessageContainer receiveCanMessageContainer;
+    EthMessageContainer receiveEthMessageContainer;
+    LinMessageContainer receiveLinMessageContainer;
+    FrMessageContainer receiveFrMessageContainer;
+    AssertOk(WithStepCodec(GetParam(), referenceTime, [&](auto& codec) {
+        CheckResult(codec.ReadMessage(_receiverChannel->GetReader(), receiveCanMessageContainer));
+        CheckResult(codec.ReadMessage(_receiverChannel->GetReader(), receiveEthMessageContainer));
+        CheckResult(codec.ReadMessage(_receiverChannel->GetReader(), receiveLinMessageContainer));
+        return codec.ReadMessage(_receiverChannel->GetReader(), receiveFrMessageContainer);
+    }));
+    _receiverChannel->GetReader().EndRead();
+
+    ASSERT_EQ(sendCanMessageContainer, receiveCanMessageContainer);
+    ASSERT_EQ(sendEthMessageContainer, receiveEthMessageContainer);
+    ASSERT_EQ(sendLinMessageContainer, receiveLinMessageContainer);
+    ASSERT_EQ(sendFrMessageContainer, receiveFrMessageContainer);
+}
+
+}  // namespace